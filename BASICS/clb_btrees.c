@@ -0,0 +1,796 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_btrees.c
+
+Author: The E developers
+
+Contents
+
+  B-trees with long keys and pointer values (the classical algorithm
+  with preemptive splitting on insertion and preemptive refilling on
+  deletion), and pointer sets based on them.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 13:20:07 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <string.h>
+#include "clb_btrees.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_node_alloc()
+//
+//   Allocate an empty node.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static BTreeNode_p btree_node_alloc(bool leaf)
+{
+   BTreeNode_p handle = SizeMalloc(leaf?BTREE_LEAF_SIZE:BTREE_INNER_SIZE);
+
+   handle->key_no = 0;
+   handle->leaf   = leaf;
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_node_free()
+//
+//   Free a single node.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void btree_node_free(BTreeNode_p junk)
+{
+   SizeFree(junk, junk->leaf?BTREE_LEAF_SIZE:BTREE_INNER_SIZE);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_free_rec()
+//
+//   Free a node and all its descendents.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void btree_free_rec(BTreeNode_p junk)
+{
+   int i;
+
+   if(!junk->leaf)
+   {
+      for(i=0; i<=junk->key_no; i++)
+      {
+         btree_free_rec(junk->children[i]);
+      }
+   }
+   btree_node_free(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_lower_bound()
+//
+//   Return the index of the first key in node not smaller than key
+//   (or key_no, if there is none).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline int btree_lower_bound(BTreeNode_p node, long key)
+{
+   int i;
+
+   for(i=0; i<node->key_no && node->keys[i]<key; i++)
+   {
+      /* Search */
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_split_child()
+//
+//   The i-th child of node is full. Split it into two nodes and move
+//   its median key up into node (which must not be full).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void btree_split_child(BTreeNode_p node, int i)
+{
+   BTreeNode_p full = node->children[i];
+   BTreeNode_p new  = btree_node_alloc(full->leaf);
+   const int   t    = BTREE_MIN_DEGREE;
+
+   assert(full->key_no == BTREE_MAX_KEYS);
+   assert(node->key_no < BTREE_MAX_KEYS);
+
+   new->key_no = t-1;
+   memcpy(new->keys, full->keys+t, (t-1)*sizeof(long));
+   memcpy(new->vals, full->vals+t, (t-1)*sizeof(void*));
+   if(!full->leaf)
+   {
+      memcpy(new->children, full->children+t, t*sizeof(BTreeNode_p));
+   }
+   full->key_no = t-1;
+
+   memmove(node->keys+i+1, node->keys+i, (node->key_no-i)*sizeof(long));
+   memmove(node->vals+i+1, node->vals+i, (node->key_no-i)*sizeof(void*));
+   memmove(node->children+i+2, node->children+i+1,
+           (node->key_no-i)*sizeof(BTreeNode_p));
+   node->keys[i]       = full->keys[t-1];
+   node->vals[i]       = full->vals[t-1];
+   node->children[i+1] = new;
+   node->key_no++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_borrow_from_prev()
+//
+//   Move a key from the (i-1)th child of node via node into the i-th
+//   child.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree
+//
+/----------------------------------------------------------------------*/
+
+static void btree_borrow_from_prev(BTreeNode_p node, int i)
+{
+   BTreeNode_p child = node->children[i];
+   BTreeNode_p sib   = node->children[i-1];
+
+   memmove(child->keys+1, child->keys, child->key_no*sizeof(long));
+   memmove(child->vals+1, child->vals, child->key_no*sizeof(void*));
+   if(!child->leaf)
+   {
+      memmove(child->children+1, child->children,
+              (child->key_no+1)*sizeof(BTreeNode_p));
+      child->children[0] = sib->children[sib->key_no];
+   }
+   child->keys[0] = node->keys[i-1];
+   child->vals[0] = node->vals[i-1];
+   child->key_no++;
+
+   node->keys[i-1] = sib->keys[sib->key_no-1];
+   node->vals[i-1] = sib->vals[sib->key_no-1];
+   sib->key_no--;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_borrow_from_next()
+//
+//   Move a key from the (i+1)th child of node via node into the i-th
+//   child.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree
+//
+/----------------------------------------------------------------------*/
+
+static void btree_borrow_from_next(BTreeNode_p node, int i)
+{
+   BTreeNode_p child = node->children[i];
+   BTreeNode_p sib   = node->children[i+1];
+
+   child->keys[child->key_no] = node->keys[i];
+   child->vals[child->key_no] = node->vals[i];
+   if(!child->leaf)
+   {
+      child->children[child->key_no+1] = sib->children[0];
+      memmove(sib->children, sib->children+1,
+              sib->key_no*sizeof(BTreeNode_p));
+   }
+   child->key_no++;
+
+   node->keys[i] = sib->keys[0];
+   node->vals[i] = sib->vals[0];
+   memmove(sib->keys, sib->keys+1, (sib->key_no-1)*sizeof(long));
+   memmove(sib->vals, sib->vals+1, (sib->key_no-1)*sizeof(void*));
+   sib->key_no--;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_merge_children()
+//
+//   Merge the i-th child of node, the i-th key of node, and the
+//   (i+1)th child of node into a single node.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void btree_merge_children(BTreeNode_p node, int i)
+{
+   BTreeNode_p child = node->children[i];
+   BTreeNode_p sib   = node->children[i+1];
+
+   assert(child->key_no+sib->key_no+1 <= BTREE_MAX_KEYS);
+
+   child->keys[child->key_no] = node->keys[i];
+   child->vals[child->key_no] = node->vals[i];
+   memcpy(child->keys+child->key_no+1, sib->keys, sib->key_no*sizeof(long));
+   memcpy(child->vals+child->key_no+1, sib->vals, sib->key_no*sizeof(void*));
+   if(!child->leaf)
+   {
+      memcpy(child->children+child->key_no+1, sib->children,
+             (sib->key_no+1)*sizeof(BTreeNode_p));
+   }
+   child->key_no += sib->key_no+1;
+
+   memmove(node->keys+i, node->keys+i+1, (node->key_no-i-1)*sizeof(long));
+   memmove(node->vals+i, node->vals+i+1, (node->key_no-i-1)*sizeof(void*));
+   memmove(node->children+i+1, node->children+i+2,
+           (node->key_no-i-1)*sizeof(BTreeNode_p));
+   node->key_no--;
+   btree_node_free(sib);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_fill_child()
+//
+//   The i-th child of node has the minimal number of keys. Give it
+//   another one, either from a sibling or by merging it with a
+//   sibling. Return the index of the child that now covers the key
+//   range of the original i-th child.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static int btree_fill_child(BTreeNode_p node, int i)
+{
+   if(i>0 && node->children[i-1]->key_no >= BTREE_MIN_DEGREE)
+   {
+      btree_borrow_from_prev(node, i);
+   }
+   else if(i<node->key_no && node->children[i+1]->key_no >= BTREE_MIN_DEGREE)
+   {
+      btree_borrow_from_next(node, i);
+   }
+   else if(i<node->key_no)
+   {
+      btree_merge_children(node, i);
+   }
+   else
+   {
+      btree_merge_children(node, i-1);
+      i--;
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_delete_rec()
+//
+//   Delete key from the subtree rooted at node, which has more than
+//   the minimal number of keys (or is the root). Return the
+//   associated value in *val. Return true if the key was found.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool btree_delete_rec(BTreeNode_p node, long key, void** val)
+{
+   int         i;
+   BTreeNode_p handle;
+   void*       dummy;
+
+   while(true)
+   {
+      i = btree_lower_bound(node, key);
+      if(i<node->key_no && node->keys[i]==key)
+      {
+         *val = node->vals[i];
+         if(node->leaf)
+         {
+            memmove(node->keys+i, node->keys+i+1,
+                    (node->key_no-i-1)*sizeof(long));
+            memmove(node->vals+i, node->vals+i+1,
+                    (node->key_no-i-1)*sizeof(void*));
+            node->key_no--;
+            return true;
+         }
+         if(node->children[i]->key_no >= BTREE_MIN_DEGREE)
+         {
+            /* Replace by predecessor */
+            for(handle = node->children[i];
+                !handle->leaf;
+                handle = handle->children[handle->key_no])
+            {
+            }
+            node->keys[i] = handle->keys[handle->key_no-1];
+            node->vals[i] = handle->vals[handle->key_no-1];
+            return btree_delete_rec(node->children[i], node->keys[i], &dummy);
+         }
+         if(node->children[i+1]->key_no >= BTREE_MIN_DEGREE)
+         {
+            /* Replace by successor */
+            for(handle = node->children[i+1];
+                !handle->leaf;
+                handle = handle->children[0])
+            {
+            }
+            node->keys[i] = handle->keys[0];
+            node->vals[i] = handle->vals[0];
+            return btree_delete_rec(node->children[i+1], node->keys[i], &dummy);
+         }
+         btree_merge_children(node, i);
+         node = node->children[i];
+         continue;
+      }
+      if(node->leaf)
+      {
+         return false;
+      }
+      if(node->children[i]->key_no < BTREE_MIN_DEGREE)
+      {
+         i = btree_fill_child(node, i);
+      }
+      node = node->children[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: btree_shrink_root()
+//
+//   If the root of tree has become empty, remove it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void btree_shrink_root(NumBTree_p tree)
+{
+   BTreeNode_p old = tree->root;
+
+   if(old && !old->key_no)
+   {
+      tree->root = old->leaf?NULL:old->children[0];
+      btree_node_free(old);
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeAlloc()
+//
+//   Allocate an empty tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+NumBTree_p NumBTreeAlloc(void)
+{
+   NumBTree_p handle = NumBTreeCellAlloc();
+
+   handle->size = 0;
+   handle->root = NULL;
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeFree()
+//
+//   Free a tree. Values are not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void NumBTreeFree(NumBTree_p junk)
+{
+   if(junk->root)
+   {
+      btree_free_rec(junk->root);
+   }
+   NumBTreeCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeGetRef()
+//
+//   Return a reference to the value associated with key, inserting
+//   key with value NULL if it is not yet in the tree. *created is set
+//   to true in the latter case. The reference is valid until the
+//   tree is modified.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void** NumBTreeGetRef(NumBTree_p tree, long key, bool *created)
+{
+   BTreeNode_p node, new;
+   int         i;
+
+   if(!tree->root)
+   {
+      tree->root = btree_node_alloc(true);
+   }
+   else if(tree->root->key_no == BTREE_MAX_KEYS)
+   {
+      new = btree_node_alloc(false);
+      new->children[0] = tree->root;
+      btree_split_child(new, 0);
+      tree->root = new;
+   }
+   node = tree->root;
+   while(true)
+   {
+      i = btree_lower_bound(node, key);
+      if(i<node->key_no && node->keys[i]==key)
+      {
+         *created = false;
+         return &(node->vals[i]);
+      }
+      if(node->leaf)
+      {
+         memmove(node->keys+i+1, node->keys+i, (node->key_no-i)*sizeof(long));
+         memmove(node->vals+i+1, node->vals+i, (node->key_no-i)*sizeof(void*));
+         node->keys[i] = key;
+         node->vals[i] = NULL;
+         node->key_no++;
+         tree->size++;
+         *created = true;
+         return &(node->vals[i]);
+      }
+      if(node->children[i]->key_no == BTREE_MAX_KEYS)
+      {
+         btree_split_child(node, i);
+         if(node->keys[i] == key)
+         {
+            *created = false;
+            return &(node->vals[i]);
+         }
+         if(node->keys[i] < key)
+         {
+            i++;
+         }
+      }
+      node = node->children[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeStore()
+//
+//   Insert key with value val into tree. Return false (and leave the
+//   tree unchanged) if key already is in the tree, true otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool NumBTreeStore(NumBTree_p tree, long key, void* val)
+{
+   bool   created;
+   void** ref = NumBTreeGetRef(tree, key, &created);
+
+   if(created)
+   {
+      *ref = val;
+   }
+   return created;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeDelete()
+//
+//   Delete key from tree. If it was found, return true and the
+//   associated value in *val (if val is not NULL), otherwise return
+//   false.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool NumBTreeDelete(NumBTree_p tree, long key, void** val)
+{
+   void* dummy;
+   bool  res;
+
+   if(!tree->root)
+   {
+      return false;
+   }
+   res = btree_delete_rec(tree->root, key, val?val:&dummy);
+   if(res)
+   {
+      tree->size--;
+   }
+   btree_shrink_root(tree);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeMinKey()
+//
+//   Return the smallest key in the (non-empty) tree.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long NumBTreeMinKey(NumBTree_p tree)
+{
+   BTreeNode_p node = tree->root;
+
+   assert(node);
+   while(!node->leaf)
+   {
+      node = node->children[0];
+   }
+   return node->keys[0];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeMaxKey()
+//
+//   Return the largest key in the (non-empty) tree.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long NumBTreeMaxKey(NumBTree_p tree)
+{
+   BTreeNode_p node = tree->root;
+
+   assert(node);
+   while(!node->leaf)
+   {
+      node = node->children[node->key_no];
+   }
+   return node->keys[node->key_no-1];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeIterInit()
+//
+//   Initialize iter for an ascending traversal of all keys in tree
+//   that are at least lower_key. tree may be NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void NumBTreeIterInit(BTreeIter_p iter, NumBTree_p tree, long lower_key)
+{
+   BTreeNode_p node = tree?tree->root:NULL;
+   int         i;
+
+   iter->depth = 0;
+   while(node)
+   {
+      assert(iter->depth < BTREE_MAX_DEPTH);
+      i = btree_lower_bound(node, lower_key);
+      iter->node[iter->depth] = node;
+      iter->pos[iter->depth]  = i;
+      iter->depth++;
+      if(node->leaf || (i<node->key_no && node->keys[i]==lower_key))
+      {
+         break;
+      }
+      node = node->children[i];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PBTreeFree()
+//
+//   Free a (possibly empty) set of pointers.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PBTreeFree(PBTree_p junk)
+{
+   if(junk)
+   {
+      NumBTreeFree(junk);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PBTreeStore()
+//
+//   Insert key into the set *root. Return true if it was new.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool PBTreeStore(PBTree_p *root, void* key)
+{
+   if(!*root)
+   {
+      *root = NumBTreeAlloc();
+   }
+   return NumBTreeStore(*root, PBTreeKey(key), key);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PBTreeDeleteEntry()
+//
+//   Delete key from the set *root. Return true if it was found. Frees
+//   the set if it becomes empty.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool PBTreeDeleteEntry(PBTree_p *root, void* key)
+{
+   bool res;
+
+   if(!*root)
+   {
+      return false;
+   }
+   res = NumBTreeDelete(*root, PBTreeKey(key), NULL);
+   if(!(*root)->size)
+   {
+      NumBTreeFree(*root);
+      *root = NULL;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PBTreeExtractFirstKey()
+//
+//   Remove the smallest element from the non-empty set *root and
+//   return it. Frees the set if it becomes empty.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void* PBTreeExtractFirstKey(PBTree_p *root)
+{
+   void* res = NULL;
+   bool  found;
+
+   assert(*root);
+   found = NumBTreeDelete(*root, NumBTreeMinKey(*root), &res);
+   UNUSED(found); assert(found);
+   if(!(*root)->size)
+   {
+      NumBTreeFree(*root);
+      *root = NULL;
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
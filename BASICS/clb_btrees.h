@@ -0,0 +1,253 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_btrees.h
+
+Author: The E developers
+
+Contents
+
+  B-trees with long integer keys and pointer values, and sets of
+  pointers built on top of them. Unlike the splay trees in
+  clb_numtrees.h and clb_ptrees.h, lookups do not restructure the
+  tree, and keys are stored in small, contiguous arrays, so that
+  searches and traversals touch few cache lines.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 13:20:07 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_BTREES
+
+#define CLB_BTREES
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <clb_memory.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Every node but the root has between BTREE_MIN_DEGREE-1 and
+   BTREE_MAX_KEYS keys. With 8, the keys of a node fit into two cache
+   lines. */
+#define BTREE_MIN_DEGREE 8
+#define BTREE_MAX_KEYS   (2*BTREE_MIN_DEGREE-1)
+
+/* Maximal height of a tree. Since every inner node has at least
+   BTREE_MIN_DEGREE children, this is never reached in practice. */
+#define BTREE_MAX_DEPTH  32
+
+/* Keys and values are kept in separate arrays so that a search only
+   reads the keys. Leaves are allocated without the children array. */
+
+typedef struct btree_node_cell
+{
+   int                    key_no;
+   bool                   leaf;
+   long                   keys[BTREE_MAX_KEYS];
+   void*                  vals[BTREE_MAX_KEYS];
+   struct btree_node_cell *children[BTREE_MAX_KEYS+1];
+}BTreeNodeCell, *BTreeNode_p;
+
+#define BTREE_LEAF_SIZE  offsetof(BTreeNodeCell, children)
+#define BTREE_INNER_SIZE sizeof(BTreeNodeCell)
+
+typedef struct numbtree_cell
+{
+   long        size;   /* Number of keys */
+   BTreeNode_p root;   /* NULL for the empty tree */
+}NumBTreeCell, *NumBTree_p;
+
+/* A set of pointers is a NumBTree with the (order-preserving) image
+   of the pointer as key and the pointer itself as value. The empty
+   set is represented by NULL. */
+
+typedef NumBTreeCell PBTreeCell, *PBTree_p;
+
+/* Iterators keep the path to the current position explicitly. They
+   become invalid if the tree is modified. */
+
+typedef struct btree_iter_cell
+{
+   int         depth;
+   BTreeNode_p node[BTREE_MAX_DEPTH];
+   int         pos[BTREE_MAX_DEPTH];
+}BTreeIterCell, *BTreeIter_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define NumBTreeCellAlloc()    (NumBTreeCell*)SizeMalloc(sizeof(NumBTreeCell))
+#define NumBTreeCellFree(junk) SizeFree(junk, sizeof(NumBTreeCell))
+#define BTreeIterCellAlloc()    (BTreeIterCell*)SizeMalloc(sizeof(BTreeIterCell))
+#define BTreeIterCellFree(junk) SizeFree(junk, sizeof(BTreeIterCell))
+
+/* Estimated memory per stored key, assuming nodes are a bit more than
+   half full */
+#ifdef CONSTANT_MEM_ESTIMATE
+#define NUMBTREE_ENTRY_MEM 24
+#else
+#define NUMBTREE_ENTRY_MEM (MEMSIZE(BTreeNodeCell)/BTREE_MIN_DEGREE)
+#endif
+
+NumBTree_p NumBTreeAlloc(void);
+void       NumBTreeFree(NumBTree_p junk);
+#define    NumBTreeSize(tree) ((tree)->size)
+static inline void** NumBTreeFindRef(NumBTree_p tree, long key);
+void**     NumBTreeGetRef(NumBTree_p tree, long key, bool *created);
+bool       NumBTreeStore(NumBTree_p tree, long key, void* val);
+bool       NumBTreeDelete(NumBTree_p tree, long key, void** val);
+long       NumBTreeMinKey(NumBTree_p tree);
+long       NumBTreeMaxKey(NumBTree_p tree);
+
+void       NumBTreeIterInit(BTreeIter_p iter, NumBTree_p tree, long lower_key);
+static inline bool NumBTreeIterNext(BTreeIter_p iter, long *key, void** val);
+
+#define PBTreeKey(p) ((long)(((uintptr_t)(p))^((uintptr_t)1<<(sizeof(uintptr_t)*CHAR_BIT-1))))
+
+#define PBTreeNodes(root) ((root)?(root)->size:0)
+#define PBTreeFind(root, key) \
+   ((root)&&NumBTreeFindRef((root), PBTreeKey(key))?(key):NULL)
+bool  PBTreeStore(PBTree_p *root, void* key);
+bool  PBTreeDeleteEntry(PBTree_p *root, void* key);
+void* PBTreeExtractFirstKey(PBTree_p *root);
+void  PBTreeFree(PBTree_p junk);
+
+#define PBTreeIterInit(iter, root) \
+   NumBTreeIterInit((iter), (root), LONG_MIN)
+static inline void* PBTreeIterNext(BTreeIter_p iter);
+
+
+/*---------------------------------------------------------------------*/
+/*                       Inline-Functions                              */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeFindRef()
+//
+//   Return a reference to the value associated with key in tree, or
+//   NULL if key is not in the tree. The reference is valid until the
+//   tree is modified.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline void** NumBTreeFindRef(NumBTree_p tree, long key)
+{
+   BTreeNode_p node = tree->root;
+   int         i;
+
+   while(node)
+   {
+      for(i=0; i<node->key_no && node->keys[i]<key; i++)
+      {
+         /* Linear search is fastest for nodes of this size */
+      }
+      if(i<node->key_no && node->keys[i]==key)
+      {
+         return &(node->vals[i]);
+      }
+      node = node->leaf?NULL:node->children[i];
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NumBTreeIterNext()
+//
+//   Return the next key/value pair of the traversal in *key and
+//   *val. Return false if the traversal is finished.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes iter
+//
+/----------------------------------------------------------------------*/
+
+static inline bool NumBTreeIterNext(BTreeIter_p iter, long *key, void** val)
+{
+   BTreeNode_p node;
+   int         i;
+
+   while(iter->depth)
+   {
+      node = iter->node[iter->depth-1];
+      i    = iter->pos[iter->depth-1];
+      if(i < node->key_no)
+      {
+         *key = node->keys[i];
+         *val = node->vals[i];
+         iter->pos[iter->depth-1] = i+1;
+         if(!node->leaf)
+         {
+            node = node->children[i+1];
+            while(true)
+            {
+               assert(iter->depth < BTREE_MAX_DEPTH);
+               iter->node[iter->depth] = node;
+               iter->pos[iter->depth]  = 0;
+               iter->depth++;
+               if(node->leaf)
+               {
+                  break;
+               }
+               node = node->children[0];
+            }
+         }
+         return true;
+      }
+      iter->depth--;
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PBTreeIterNext()
+//
+//   Return the next pointer in the traversal of a PBTree, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes iter
+//
+/----------------------------------------------------------------------*/
+
+static inline void* PBTreeIterNext(BTreeIter_p iter)
+{
+   long  key;
+   void* res;
+
+   if(NumBTreeIterNext(iter, &key, &res))
+   {
+      return res;
+   }
+   return NULL;
+}
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
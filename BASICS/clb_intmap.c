@@ -106,19 +106,18 @@ static bool switch_to_tree(long old_min, long old_max, long new_key, long entrie
 //
 /----------------------------------------------------------------------*/
 
-static NumTree_p add_new_tree_node(IntMap_p map, long key, void* val)
+static void** add_new_tree_node(IntMap_p map, long key, void* val)
 {
-   NumTree_p handle, check;
+   void** ref;
+   bool   created;
    assert(map->type == IMTree);
 
-   handle = NumTreeCellAlloc();
-   handle->key = key;
-   handle->val1.p_val = val;
-   check = NumTreeInsert(&(map->values.tree), handle);
-   UNUSED(check); assert(!check);
+   ref = NumBTreeGetRef(map->values.tree, key, &created);
+   UNUSED(created); assert(created);
+   *ref = val;
    map->entry_no++;
 
-   return handle;
+   return ref;
 }
 
 
@@ -138,7 +137,7 @@ static NumTree_p add_new_tree_node(IntMap_p map, long key, void* val)
 static void array_to_tree(IntMap_p map)
 {
    PDRangeArr_p  tmp_arr;
-   IntOrP        tmp_val;
+   void*         tmp_val;
    long          i;
    long          max_key = map->min_key;
    long          min_key = map->max_key;
@@ -146,16 +145,16 @@ static void array_to_tree(IntMap_p map)
    assert(map->type == IMArray);
 
    tmp_arr = map->values.array;
-   map->values.tree = NULL;
+   map->values.tree = NumBTreeAlloc();
    map->type = IMTree;
    map->entry_no = 0;
 
    for(i=PDRangeArrLowKey(tmp_arr); i<=map->max_key; i++)
    {
-      tmp_val.p_val = PDRangeArrElementP(tmp_arr, i);
-      if(tmp_val.p_val)
+      tmp_val = PDRangeArrElementP(tmp_arr, i);
+      if(tmp_val)
       {
-         NumTreeStore(&(map->values.tree), i, tmp_val, tmp_val);
+         NumBTreeStore(map->values.tree, i, tmp_val);
          map->entry_no++;
          max_key = i;
          min_key = MIN(min_key, i);
@@ -185,26 +184,26 @@ static void tree_to_array(IntMap_p map)
    PDRangeArr_p  tmp_arr;
    long          max_key = map->min_key;
    long          min_key = map->max_key;
-   PStack_p      tree_iterator;
-   NumTree_p     handle;
+   BTreeIterCell tree_iterator;
+   long          key;
+   void*         val;
 
    assert(map->type == IMTree);
 
    map->entry_no = 0;
    tmp_arr = PDRangeArrAlloc(map->min_key, IM_ARRAY_SIZE);
-   tree_iterator = NumTreeTraverseInit(map->values.tree);
-   while((handle = NumTreeTraverseNext(tree_iterator)))
+   NumBTreeIterInit(&tree_iterator, map->values.tree, LONG_MIN);
+   while(NumBTreeIterNext(&tree_iterator, &key, &val))
    {
-      if(handle->val1.p_val)
+      if(val)
       {
-         PDRangeArrAssignP(tmp_arr, handle->key, handle->val1.p_val);
+         PDRangeArrAssignP(tmp_arr, key, val);
          map->entry_no++;
-         max_key = handle->key;
-         min_key = MIN(min_key, handle->key);
+         max_key = key;
+         min_key = MIN(min_key, key);
       }
    }
-   NumTreeTraverseExit(tree_iterator);
-   NumTreeFree(map->values.tree);
+   NumBTreeFree(map->values.tree);
    map->max_key = max_key;
    map->min_key = MIN(min_key, max_key);
    map->values.array = tmp_arr;
@@ -264,7 +263,7 @@ void IntMapFree(IntMap_p map)
          PDRangeArrFree(map->values.array);
          break;
    case IMTree:
-         NumTreeFree(map->values.tree);
+         NumBTreeFree(map->values.tree);
          break;
    default:
          assert(false && "Unknown IntMap type.");
@@ -313,10 +312,10 @@ void* IntMapGetVal(IntMap_p map, long key)
    case IMTree:
          if(key <= map->max_key)
          {
-            NumTree_p entry = NumTreeFind(&(map->values.tree), key);
+            void** entry = NumBTreeFindRef(map->values.tree, key);
             if(entry)
             {
-               res = entry->val1.p_val;
+               res = *entry;
             }
          }
          break;
@@ -346,8 +345,7 @@ void** IntMapGetRef(IntMap_p map, long key)
 {
    void      **res = NULL;
    void      *val;
-   NumTree_p handle;
-   IntOrP tmp;
+   void      **ref;
 
    assert(map);
 
@@ -385,11 +383,9 @@ void** IntMapGetRef(IntMap_p map, long key)
          {
             map->type = IMTree;
             val = map->values.value;
-            map->values.tree = NULL;
-            tmp.p_val = val;
-            NumTreeStore(&(map->values.tree),map->max_key, tmp, tmp);
-            handle = add_new_tree_node(map, key, NULL);
-            res = &(handle->val1.p_val);
+            map->values.tree = NumBTreeAlloc();
+            NumBTreeStore(map->values.tree, map->max_key, val);
+            res = add_new_tree_node(map, key, NULL);
             map->entry_no = 2;
          }
          map->min_key = MIN(map->min_key, key);
@@ -414,10 +410,10 @@ void** IntMapGetRef(IntMap_p map, long key)
          map->max_key=MAX(map->max_key, key);
          break;
    case IMTree:
-         handle = NumTreeFind(&(map->values.tree), key);
-         if(handle)
+         ref = NumBTreeFindRef(map->values.tree, key);
+         if(ref)
          {
-            res = &(handle->val1.p_val);
+            res = ref;
          }
          else
          {
@@ -428,10 +424,9 @@ void** IntMapGetRef(IntMap_p map, long key)
             }
             else
             {
-               handle = add_new_tree_node(map, key, NULL);
+               res = add_new_tree_node(map, key, NULL);
                map->max_key=MAX(map->max_key, key);
                map->min_key=MIN(map->min_key, key);
-               res = &(handle->val1.p_val);
             }
          }
          break;
@@ -486,7 +481,6 @@ void IntMapAssign(IntMap_p map, long key, void* value)
 void* IntMapDelKey(IntMap_p map, long key)
 {
    void* res = NULL;
-   NumTree_p   handle;
 
    assert(map);
 
@@ -522,16 +516,14 @@ void* IntMapDelKey(IntMap_p map, long key)
          }
          break;
    case IMTree:
-         handle = NumTreeExtractEntry(&(map->values.tree), key);
-         if(handle)
+         if(NumBTreeDelete(map->values.tree, key, &res))
          {
             map->entry_no--;
-            res = handle->val1.p_val;
-            if(handle->key == map->max_key)
+            if(key == map->max_key)
             {
-               if(map->values.tree)
+               if(NumBTreeSize(map->values.tree))
                {
-                  map->max_key = NumTreeMaxKey(map->values.tree);
+                  map->max_key = NumBTreeMaxKey(map->values.tree);
                }
                else
                {
@@ -542,7 +534,6 @@ void* IntMapDelKey(IntMap_p map, long key)
                   tree_to_array(map);
                }
             }
-            NumTreeCellFree(handle);
          }
          break;
    default:
@@ -591,8 +582,9 @@ IntMapIter_p IntMapIterAlloc(IntMap_p map, long lower_key, long upper_key)
             handle->admin_data.current = lower_key;
             break;
       case IMTree:
-            handle->admin_data.tree_iter =
-               NumTreeLimitedTraverseInit(map->values.tree, lower_key);
+            handle->admin_data.tree_iter = BTreeIterCellAlloc();
+            NumBTreeIterInit(handle->admin_data.tree_iter,
+                             map->values.tree, lower_key);
             break;
       default:
             assert(false && "Unknown IntMap type.");
@@ -627,7 +619,7 @@ void IntMapIterFree(IntMapIter_p junk)
       case IMArray:
             break;
       case IMTree:
-            PStackFree(junk->admin_data.tree_iter);
+            BTreeIterCellFree(junk->admin_data.tree_iter);
          break;
       default:
             assert(false && "Unknown IntMap type.");
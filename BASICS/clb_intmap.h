@@ -29,6 +29,7 @@ Changes
 
 #include <limits.h>
 #include <clb_numtrees.h>
+#include <clb_btrees.h>
 #include <clb_pdrangearrays.h>
 
 
@@ -73,7 +74,7 @@ typedef struct intmap_cell
    {
       void*        value;   /* For IMSingle */
       PDRangeArr_p array;   /* For IMArray  */
-      NumTree_p    tree;    /* For IMTree   */
+      NumBTree_p   tree;    /* For IMTree   */
    }values;
 }IntMapCell, *IntMap_p;
 
@@ -88,7 +89,7 @@ typedef struct intmap_iter_cell
    {
       bool      seen;      /* For IMSingle */
       long      current;   /* For IMArray  */
-      PStack_p  tree_iter; /* For IMTree */
+      BTreeIter_p tree_iter; /* For IMTree */
    }admin_data;
 }IntMapIterCell, *IntMapIter_p;
 
@@ -123,7 +124,7 @@ void*    IntMapDelKey(IntMap_p map, long key);
 #define IntMapDStorage(map) (((map)->type == IMArray)?\
                              PDArrayStorage((map)->values.array):\
                              (((map)->type == IMTree)?\
-                              ((map)->entry_no*NUMTREECELL_MEM):0))
+                              ((map)->entry_no*NUMBTREE_ENTRY_MEM):0))
 
 #define IntMapStorage(map) (INTMAPCELL_MEM+IntMapDStorage(map))
 
@@ -159,7 +160,6 @@ static inline void* IntMapIterNext(IntMapIter_p iter, long *key)
 {
    void* res = NULL;
    long  i;
-   NumTree_p handle;
 
    assert(iter);
    assert(key);
@@ -198,22 +198,19 @@ static inline void* IntMapIterNext(IntMapIter_p iter, long *key)
          break;
    case IMTree:
          // printf("Case IMTree\n");
-         while((handle = NumTreeTraverseNext(iter->admin_data.tree_iter)))
+         while(NumBTreeIterNext(iter->admin_data.tree_iter, &i, &res))
          {
-            if(handle)
+            if(i > iter->upper_key)
             {
-               if(handle->key > iter->upper_key)
-               {
-                  /* Overrun limit */
-                  break;
-               }
-               if(handle->val1.p_val)
-               {
-                  /* Found real value */
-                  *key = handle->key;
-                  res = handle->val1.p_val;
-                  break;
-               }
+               /* Overrun limit */
+               res = NULL;
+               break;
+            }
+            if(res)
+            {
+               /* Found real value */
+               *key = i;
+               break;
             }
          }
          break;
@@ -23,8 +23,10 @@ Changes
 
 #include <unistd.h>
 #include <time.h>
+#include <sys/wait.h>
 
 #include "clb_os_wrapper.h"
+#include "clb_memory.h"
 
 
 
@@ -42,6 +44,29 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: fork_map_chunk()
+//
+//   Compute results[i] = fun(data,i) for start <= i < end.
+//
+// Global Variables: -
+//
+// Side Effects    : By fun
+//
+/----------------------------------------------------------------------*/
+
+static void fork_map_chunk(long start, long end, ForkMapFun_p fun,
+                           void* data, long* results)
+{
+   long i;
+
+   for(i=start; i<end; i++)
+   {
+      results[i] = fun(data, i);
+   }
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -467,6 +492,112 @@ void StrideMemory(char* mem, long size)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ForkMapLong()
+//
+//   Compute results[i] = fun(data, i) for all 0 <= i < items, using
+//   up to workers fork()ed processes that each handle one contiguous
+//   chunk and send back the results via a pipe. Since the children
+//   work on a private copy of the address space, fun() may freely use
+//   (and modify) global state, but all changes except for the results
+//   are lost. The results are the same as for sequential evaluation
+//   if fun() is deterministic. If a worker cannot be created or
+//   fails, its chunk is computed in the calling process.
+//
+// Global Variables: -
+//
+// Side Effects    : Creates and reaps processes, calls fun().
+//
+/----------------------------------------------------------------------*/
+
+void ForkMapLong(long items, int workers, ForkMapFun_p fun,
+                 void* data, long* results)
+{
+   long   chunk, start, end, size;
+   int    i, fds[2];
+   pid_t  *pids;
+   int    *pipes;
+   char   *buf;
+   size_t todo;
+   ssize_t done;
+
+   if(workers > items)
+   {
+      workers = items;
+   }
+   if(workers <= 1)
+   {
+      fork_map_chunk(0, items, fun, data, results);
+      return;
+   }
+   chunk = (items+workers-1)/workers;
+   pids  = SizeMalloc(workers*sizeof(pid_t));
+   pipes = SizeMalloc(workers*sizeof(int));
+
+   /* Unflushed output would otherwise be duplicated by the children */
+   fflush(stdout);
+   fflush(stderr);
+   for(i=0; i<workers; i++)
+   {
+      pids[i] = -1;
+      start = MIN(i*chunk, items);
+      end   = MIN(start+chunk, items);
+      if(start==end || pipe(fds) == -1)
+      {
+         continue;
+      }
+      pids[i] = fork();
+      if(pids[i] == 0)
+      {
+         close(fds[0]);
+         fork_map_chunk(start, end, fun, data, results);
+         buf  = (char*)(results+start);
+         todo = (end-start)*sizeof(long);
+         while(todo && (done = write(fds[1], buf, todo)) > 0)
+         {
+            buf  += done;
+            todo -= done;
+         }
+         _exit(todo?EXIT_FAILURE:EXIT_SUCCESS);
+      }
+      close(fds[1]);
+      if(pids[i] == -1)
+      {
+         close(fds[0]);
+      }
+      else
+      {
+         pipes[i] = fds[0];
+      }
+   }
+   for(i=0; i<workers; i++)
+   {
+      start = MIN(i*chunk, items);
+      end   = MIN(start+chunk, items);
+      size  = (end-start)*sizeof(long);
+      todo  = size;
+      if(pids[i] != -1)
+      {
+         buf = (char*)(results+start);
+         while(todo && (done = read(pipes[i], buf, todo)) > 0)
+         {
+            buf  += done;
+            todo -= done;
+         }
+         close(pipes[i]);
+         waitpid(pids[i], NULL, 0);
+      }
+      if(todo)
+      {
+         fork_map_chunk(start, end, fun, data, results);
+      }
+   }
+   SizeFree(pids, workers*sizeof(pid_t));
+   SizeFree(pipes, workers*sizeof(int));
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SecureFOpen()
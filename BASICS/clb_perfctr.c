@@ -0,0 +1,462 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_perfctr.c
+
+Author: The E developers
+
+Contents
+
+  Performance counters with call counts and latency histograms, and
+  per-iteration tracing of registered counters.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 11:02:45 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <string.h>
+#include <unistd.h>
+
+#include "clb_perfctr.h"
+#include "clb_os_wrapper.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Minimal time (in microseconds) between the reference points used to
+   convert ticks into time */
+#define PERF_CTR_CALIBRATION_USEC 10000
+
+PerfCtrTraceFormat PerfCtrTraceType = PCTraceNone;
+
+static PerfCtr_p registered[PERF_CTR_MAX_REGISTERED];
+static int       registered_no = 0;
+
+static long long ref_ticks = 0;
+static long long ref_usec  = 0;
+
+static FILE      *trace_out = NULL;
+static long long trace_last = 0;
+static long      trace_events = 0;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ticks_per_usec()
+//
+//   Return the number of ticks per microsecond, measured against the
+//   wall clock since PerfCtrInit(). If that was too recently (or
+//   never), wait for a short time to get a reliable estimate.
+//
+// Global Variables: ref_ticks, ref_usec
+//
+// Side Effects    : May initialize the reference point and busy-wait.
+//
+/----------------------------------------------------------------------*/
+
+static double ticks_per_usec(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+   long long usec;
+
+   if(!ref_usec)
+   {
+      PerfCtrInit();
+   }
+   while((usec = GetUSecTime()-ref_usec) < PERF_CTR_CALIBRATION_USEC)
+   {
+      /* Busy wait */
+   }
+   return (double)(PerfCtrTicks()-ref_ticks)/(double)usec;
+#else
+   return 1000.0;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: trace_event_start()
+//
+//   Print the separator before a new event in the Chrome trace.
+//
+// Global Variables: trace_out, trace_events
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void trace_event_start(void)
+{
+   if(trace_events++)
+   {
+      fputs(",\n", trace_out);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: trace_json_line()
+//
+//   Print the counters that changed since the last snapshot as a
+//   single JSON object.
+//
+// Global Variables: trace_out, registered, registered_no
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void trace_json_line(long iteration, double ts, double dur,
+                            double tpu)
+{
+   int       i;
+   bool      first = true;
+   PerfCtr_p ctr;
+
+   fprintf(trace_out, "{\"iter\":%ld,\"ts\":%.3f,\"dur\":%.3f,\"ctrs\":{",
+           iteration, ts, dur);
+   for(i=0; i<registered_no; i++)
+   {
+      ctr = registered[i];
+      if(ctr->calls != ctr->snap_calls)
+      {
+         fprintf(trace_out, "%s\"%s\":{\"calls\":%lld,\"us\":%.3f}",
+                 first?"":",",
+                 ctr->name,
+                 ctr->calls-ctr->snap_calls,
+                 (ctr->ticks-ctr->snap_ticks)/tpu);
+         first = false;
+      }
+   }
+   fputs("}}\n", trace_out);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: trace_chrome_events()
+//
+//   Print one complete event for the iteration and one counter event
+//   for each counter that changed since the last snapshot.
+//
+// Global Variables: trace_out, registered, registered_no
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void trace_chrome_events(long iteration, double ts, double dur,
+                                double tpu)
+{
+   int       i;
+   PerfCtr_p ctr;
+   long      pid = getpid();
+
+   trace_event_start();
+   fprintf(trace_out,
+           "{\"name\":\"iteration\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+           "\"pid\":%ld,\"tid\":1,\"args\":{\"iter\":%ld}}",
+           ts, dur, pid, iteration);
+   for(i=0; i<registered_no; i++)
+   {
+      ctr = registered[i];
+      if(ctr->calls != ctr->snap_calls)
+      {
+         trace_event_start();
+         fprintf(trace_out,
+                 "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,"
+                 "\"pid\":%ld,\"tid\":1,"
+                 "\"args\":{\"us\":%.3f,\"calls\":%lld}}",
+                 ctr->name, ts, pid,
+                 (ctr->ticks-ctr->snap_ticks)/tpu,
+                 ctr->calls-ctr->snap_calls);
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrInit()
+//
+//   Set the reference point for converting ticks into time. Should
+//   be called once at program start.
+//
+// Global Variables: ref_ticks, ref_usec
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrInit(void)
+{
+   ref_ticks = PerfCtrTicks();
+   ref_usec  = GetUSecTime();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTicksToUSec()
+//
+//   Convert a tick count into microseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : See ticks_per_usec()
+//
+/----------------------------------------------------------------------*/
+
+double PerfCtrTicksToUSec(long long ticks)
+{
+   return ticks/ticks_per_usec();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrReset()
+//
+//   Reset all values of ctr.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrReset(PerfCtr_p ctr)
+{
+   char* name = ctr->name;
+
+   memset(ctr, 0, sizeof(PerfCtrCell));
+   ctr->name = name;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrPrint()
+//
+//   Print the total time (in seconds), the number of calls, and the
+//   non-empty buckets of the latency histogram of ctr as
+//   <log2(ticks)>:<calls>.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrPrint(FILE* out, PerfCtr_p ctr)
+{
+   int  i;
+   char label[80];
+
+   snprintf(label, 80, "(%s)", ctr->name);
+   fprintf(out, "# PC%-34s : %f\n", label,
+           PerfCtrTicksToUSec(ctr->ticks)/1000000.0);
+   snprintf(label, 80, "(%s) calls", ctr->name);
+   fprintf(out, "# PC%-34s : %lld\n", label, ctr->calls);
+   if(ctr->calls)
+   {
+      snprintf(label, 80, "(%s) histogram", ctr->name);
+      fprintf(out, "# PC%-34s :", label);
+      for(i=0; i<PERF_CTR_BUCKETS; i++)
+      {
+         if(ctr->hist[i])
+         {
+            fprintf(out, " %d:%lld", i, ctr->hist[i]);
+         }
+      }
+      fputc('\n', out);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrRegister()
+//
+//   Add ctr to the counters that are printed by
+//   PerfCtrPrintRegistered() and traced by PerfCtrTraceSnapshot().
+//
+// Global Variables: registered, registered_no
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrRegister(PerfCtr_p ctr)
+{
+   int i;
+
+   for(i=0; i<registered_no; i++)
+   {
+      if(registered[i] == ctr)
+      {
+         return;
+      }
+   }
+   if(registered_no < PERF_CTR_MAX_REGISTERED)
+   {
+      registered[registered_no++] = ctr;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrPrintRegistered()
+//
+//   Print all registered counters.
+//
+// Global Variables: registered, registered_no
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrPrintRegistered(FILE* out)
+{
+   int i;
+
+   for(i=0; i<registered_no; i++)
+   {
+      PerfCtrPrint(out, registered[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTraceOpen()
+//
+//   Start writing snapshots of the registered counters to the file
+//   name in the given format.
+//
+// Global Variables: PerfCtrTraceType, trace_out, trace_last
+//
+// Side Effects    : Opens file, output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrTraceOpen(char* name, PerfCtrTraceFormat format)
+{
+   int i;
+
+   assert(format != PCTraceNone);
+
+   trace_out        = SecureFOpen(name, "w");
+   PerfCtrTraceType = format;
+   trace_events     = 0;
+   if(format == PCTraceChrome)
+   {
+      fputs("[\n", trace_out);
+   }
+   for(i=0; i<registered_no; i++)
+   {
+      registered[i]->snap_ticks = registered[i]->ticks;
+      registered[i]->snap_calls = registered[i]->calls;
+   }
+   ticks_per_usec(); /* Calibrate now, not in the first iteration */
+   trace_last = PerfCtrTicks();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTraceSnapshot()
+//
+//   Write the changes of all registered counters since the last
+//   snapshot (or PerfCtrTraceOpen()) to the trace, tagged with
+//   iteration.
+//
+// Global Variables: trace_out, trace_last, registered, registered_no
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrTraceSnapshot(long iteration)
+{
+   long long now = PerfCtrTicks();
+   double    tpu = ticks_per_usec(),
+      ts  = (trace_last-ref_ticks)/tpu,
+      dur = (now-trace_last)/tpu;
+   int       i;
+
+   if(PerfCtrTraceType == PCTraceJSON)
+   {
+      trace_json_line(iteration, ts, dur, tpu);
+   }
+   else
+   {
+      trace_chrome_events(iteration, ts, dur, tpu);
+   }
+   for(i=0; i<registered_no; i++)
+   {
+      registered[i]->snap_ticks = registered[i]->ticks;
+      registered[i]->snap_calls = registered[i]->calls;
+   }
+   trace_last = now;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTraceClose()
+//
+//   Finish and close the trace (if any).
+//
+// Global Variables: PerfCtrTraceType, trace_out
+//
+// Side Effects    : Output, closes file
+//
+/----------------------------------------------------------------------*/
+
+void PerfCtrTraceClose(void)
+{
+   if(!trace_out)
+   {
+      return;
+   }
+   if(PerfCtrTraceType == PCTraceChrome)
+   {
+      fputs("\n]\n", trace_out);
+   }
+   SecureFClose(trace_out);
+   trace_out = NULL;
+   PerfCtrTraceType = PCTraceNone;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
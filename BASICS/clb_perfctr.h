@@ -0,0 +1,175 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_perfctr.h
+
+Author: The E developers
+
+Contents
+
+  Low-overhead performance counters for hot code paths. Each counter
+  records the number of calls, the total time, and a log-scale
+  histogram of the individual call latencies, all measured in
+  processor ticks. Registered counters can be printed as statistics
+  and can be written as a per-iteration trace (JSON lines or Chrome
+  trace event format).
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 11:02:45 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_PERFCTR
+
+#define CLB_PERFCTR
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Bucket i counts calls taking [2^(i-1), 2^i) ticks, the last bucket
+   everything larger. */
+#define PERF_CTR_BUCKETS 48
+
+/* Maximal number of counters that can be registered for printing and
+   tracing */
+#define PERF_CTR_MAX_REGISTERED 64
+
+typedef struct perf_ctr_cell
+{
+   char      *name;
+   long long ticks;      /* Total time spent */
+   long long calls;
+   long long start;      /* Tick count at last entry */
+   long long hist[PERF_CTR_BUCKETS];
+   long long snap_ticks; /* Values at the last trace snapshot */
+   long long snap_calls;
+}PerfCtrCell, *PerfCtr_p;
+
+typedef enum
+{
+   PCTraceNone,
+   PCTraceJSON,      /* One JSON object per line and iteration */
+   PCTraceChrome     /* Chrome trace event format */
+}PerfCtrTraceFormat;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern PerfCtrTraceFormat PerfCtrTraceType;
+
+static inline long long PerfCtrTicks(void);
+static inline void      PerfCtrAdd(PerfCtr_p ctr, long long ticks);
+
+#ifndef NO_PERF_CTR
+#define PERF_CTR_DEFINE(name)  PerfCtrCell name = {#name}
+#define PERF_CTR_DECL(name)    extern PerfCtrCell name
+#define PERF_CTR_RESET(name)   PerfCtrReset(&(name))
+#define PERF_CTR_ENTRY(name)   (name).start = PerfCtrTicks()
+#define PERF_CTR_EXIT(name)    PerfCtrAdd(&(name), PerfCtrTicks()-(name).start)
+#define PERF_CTR_PRINT(out, name) PerfCtrPrint((out), &(name))
+#define PERF_CTR_REGISTER(name) PerfCtrRegister(&(name))
+#else
+#define PERF_CTR_DEFINE(name)  enum { name##_store } // Used to silence compiler warnings
+#define PERF_CTR_DECL(name)    enum { name }         // about extra semicolons.
+#define PERF_CTR_RESET(name)
+#define PERF_CTR_ENTRY(name)
+#define PERF_CTR_EXIT(name)
+#define PERF_CTR_PRINT(out, name)
+#define PERF_CTR_REGISTER(name)
+#endif
+
+void   PerfCtrInit(void);
+double PerfCtrTicksToUSec(long long ticks);
+void   PerfCtrReset(PerfCtr_p ctr);
+void   PerfCtrPrint(FILE* out, PerfCtr_p ctr);
+void   PerfCtrRegister(PerfCtr_p ctr);
+void   PerfCtrPrintRegistered(FILE* out);
+
+void   PerfCtrTraceOpen(char* name, PerfCtrTraceFormat format);
+void   PerfCtrTraceSnapshot(long iteration);
+void   PerfCtrTraceClose(void);
+
+#define PerfCtrTracing() (PerfCtrTraceType != PCTraceNone)
+
+/*---------------------------------------------------------------------*/
+/*                       Inline-Functions                              */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrTicks()
+//
+//   Return the current value of a cheap, monotonic tick counter (the
+//   time stamp counter where available, nanoseconds otherwise).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline long long PerfCtrTicks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+   return (long long)__rdtsc();
+#else
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec*1000000000ll+ts.tv_nsec;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PerfCtrAdd()
+//
+//   Record a call of duration ticks in ctr.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline void PerfCtrAdd(PerfCtr_p ctr, long long ticks)
+{
+   int bucket = 0;
+
+   if(ticks > 0)
+   {
+      bucket = 64-__builtin_clzll((unsigned long long)ticks);
+      if(bucket >= PERF_CTR_BUCKETS)
+      {
+         bucket = PERF_CTR_BUCKETS-1;
+      }
+   }
+   ctr->ticks += ticks;
+   ctr->calls++;
+   ctr->hist[bucket]++;
+}
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
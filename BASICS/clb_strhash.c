@@ -0,0 +1,358 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.c
+
+Author: The E developers
+
+Contents
+
+  Open addressing (linear probing) hash tables for interned strings
+  with arena storage for the keys.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 21:40:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <string.h>
+#include "clb_strhash.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Marker for slots of deleted entries. Only its address is used. */
+char StrHashDeleted[] = "";
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_copy_key()
+//
+//   Copy key (of length len) into the arena and return the copy.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* strhash_copy_key(StrHash_p hash, const char* key, long len)
+{
+   char *res;
+   long block_size;
+
+   if(len+1 > hash->left)
+   {
+      block_size = MAX(STRHASH_BLOCK_SIZE, len+1);
+      hash->top  = SecureMalloc(block_size);
+      hash->left = block_size;
+      PStackPushP(hash->blocks, hash->top);
+   }
+   res = hash->top;
+   memcpy(res, key, len+1);
+   hash->top  += len+1;
+   hash->left -= len+1;
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_resize()
+//
+//   Rehash all entries into a table with new_size slots, dropping
+//   the slots of deleted entries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void strhash_resize(StrHash_p hash, long new_size)
+{
+   StrHashEntryCell *old = hash->table;
+   long             old_size = hash->size, i, j, mask = new_size-1;
+
+   hash->table = SecureMalloc(new_size*sizeof(StrHashEntryCell));
+   memset(hash->table, 0, new_size*sizeof(StrHashEntryCell));
+   hash->size    = new_size;
+   hash->deleted = 0;
+
+   for(i=0; i<old_size; i++)
+   {
+      if(StrHashEntryIsUsed(&old[i]))
+      {
+         for(j = old[i].hash & mask; hash->table[j].key; j = (j+1) & mask)
+         {
+            /* Find a free slot */
+         }
+         hash->table[j] = old[i];
+      }
+   }
+   FREE(old);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashAlloc()
+//
+//   Allocate an empty table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHash_p StrHashAlloc(void)
+{
+   StrHash_p handle = StrHashCellAlloc();
+
+   handle->size    = STRHASH_MIN_SIZE;
+   handle->members = 0;
+   handle->deleted = 0;
+   handle->table   = SecureMalloc(STRHASH_MIN_SIZE*sizeof(StrHashEntryCell));
+   memset(handle->table, 0, STRHASH_MIN_SIZE*sizeof(StrHashEntryCell));
+   handle->blocks  = PStackAlloc();
+   handle->top     = NULL;
+   handle->left    = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFree()
+//
+//   Free the table and all key copies.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StrHashFree(StrHash_p junk)
+{
+   char *block;
+
+   while(!PStackEmpty(junk->blocks))
+   {
+      block = PStackPopP(junk->blocks);
+      FREE(block);
+   }
+   PStackFree(junk->blocks);
+   FREE(junk->table);
+   StrHashCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashValue()
+//
+//   Return the hash value of a string (64 bit FNV-1a, with the high
+//   bits folded into the low ones used for the slot index).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long StrHashValue(const char* key)
+{
+   unsigned long res = 14695981039346656037ul;
+
+   while(*key)
+   {
+      res ^= (unsigned char)*key;
+      res *= 1099511628211ul;
+      key++;
+   }
+   return res ^ (res >> 31);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFind()
+//
+//   Return the entry for key, or NULL if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashFind(StrHash_p hash, const char* key)
+{
+   unsigned long  h    = StrHashValue(key);
+   long           mask = hash->size-1, i;
+   StrHashEntry_p entry;
+
+   for(i = h & mask; (entry = &(hash->table[i]))->key; i = (i+1) & mask)
+   {
+      if(entry->hash == h && entry->key != StrHashDeleted &&
+         strcmp(entry->key, key) == 0)
+      {
+         return entry;
+      }
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashStore()
+//
+//   Insert a copy of key with value val. Return the new entry, or
+//   NULL if key is already in the table (which is left unchanged).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashStore(StrHash_p hash, const char* key, long val)
+{
+   unsigned long  h = StrHashValue(key);
+   long           mask, i, len;
+   StrHashEntry_p entry, free_slot = NULL;
+
+   if(10*(hash->members+hash->deleted+1) > 7*hash->size)
+   {
+      strhash_resize(hash, (2*(hash->members+1) > hash->size)?
+                     2*hash->size : hash->size);
+   }
+   mask = hash->size-1;
+   for(i = h & mask; (entry = &(hash->table[i]))->key; i = (i+1) & mask)
+   {
+      if(entry->key == StrHashDeleted)
+      {
+         if(!free_slot)
+         {
+            free_slot = entry;
+         }
+      }
+      else if(entry->hash == h && strcmp(entry->key, key) == 0)
+      {
+         return NULL;
+      }
+   }
+   if(free_slot)
+   {
+      entry = free_slot;
+      hash->deleted--;
+   }
+   len = strlen(key);
+   entry->key  = strhash_copy_key(hash, key, len);
+   entry->hash = h;
+   entry->val  = val;
+   hash->members++;
+
+   return entry;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashDelete()
+//
+//   Delete the entry for key. Return true if there was one. The
+//   key copy becomes invalid.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool StrHashDelete(StrHash_p hash, const char* key)
+{
+   StrHashEntry_p entry = StrHashFind(hash, key);
+   long           len;
+
+   if(!entry)
+   {
+      return false;
+   }
+   len = strlen(entry->key);
+   if(entry->key >= (char*)PStackTopP(hash->blocks) &&
+      entry->key+len+1 == hash->top)
+   {
+      hash->top  -= len+1;
+      hash->left += len+1;
+   }
+   entry->key = StrHashDeleted;
+   hash->members--;
+   hash->deleted++;
+
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashIterNext()
+//
+//   Return the next entry at or after slot *pos and set *pos behind
+//   it, or return NULL if there is none. Start with *pos = 0. Entries
+//   are returned in no particular order.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashIterNext(StrHash_p hash, long *pos)
+{
+   StrHashEntry_p entry;
+
+   while(*pos < hash->size)
+   {
+      entry = &(hash->table[*pos]);
+      (*pos)++;
+      if(StrHashEntryIsUsed(entry))
+      {
+         return entry;
+      }
+   }
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
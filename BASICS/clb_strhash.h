@@ -0,0 +1,93 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.h
+
+Author: The E developers
+
+Contents
+
+  Hash tables for interning strings: Each key is copied once into an
+  arena of large blocks and mapped to a long value. Lookups compare
+  the precomputed hash of a slot before the string, so that a probe
+  usually touches only the (open addressing) slot array. The table is
+  kept at most 70% full. Key copies
+  never move, so they can be shared by the user for as long as the
+  entry is in the table.
+
+  Deleting an entry only reclaims the key bytes if it was the most
+  recently copied key (i.e. if entries are deleted in LIFO order, as
+  when backtracking a signature).
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 21:40:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_STRHASH
+
+#define CLB_STRHASH
+
+#include <clb_pstacks.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define STRHASH_MIN_SIZE   64        /* Initial number of slots */
+#define STRHASH_BLOCK_SIZE (64*1024) /* Default arena block size */
+
+typedef struct str_hash_entry_cell
+{
+   char          *key;  /* NULL for empty, StrHashDeleted for free slots */
+   unsigned long hash;
+   long          val;
+}StrHashEntryCell, *StrHashEntry_p;
+
+typedef struct str_hash_cell
+{
+   long             size;     /* Number of slots, always a power of 2 */
+   long             members;
+   long             deleted;  /* Slots freed by deletions */
+   StrHashEntryCell *table;
+   PStack_p         blocks;   /* Arena blocks holding the keys */
+   char             *top;     /* Next free byte in the current block */
+   long             left;     /* Free bytes in the current block */
+}StrHashCell, *StrHash_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern char StrHashDeleted[];
+
+#define StrHashCellAlloc()    (StrHashCell*)SizeMalloc(sizeof(StrHashCell))
+#define StrHashCellFree(junk) SizeFree(junk, sizeof(StrHashCell))
+
+#define StrHashEntryIsUsed(entry) \
+   ((entry)->key && (entry)->key != StrHashDeleted)
+
+StrHash_p      StrHashAlloc(void);
+void           StrHashFree(StrHash_p junk);
+#define        StrHashMembers(hash) ((hash)->members)
+
+unsigned long  StrHashValue(const char* key);
+StrHashEntry_p StrHashFind(StrHash_p hash, const char* key);
+StrHashEntry_p StrHashStore(StrHash_p hash, const char* key, long val);
+bool           StrHashDelete(StrHash_p hash, const char* key);
+StrHashEntry_p StrHashIterNext(StrHash_p hash, long *pos);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
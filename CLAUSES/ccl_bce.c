@@ -23,6 +23,9 @@ Changes
 #include "ccl_bce.h"
 #include <clb_min_heap.h>
 
+/* Number of tasks per worker that are handed out in one batch */
+#define BCE_BATCH_FACTOR 16
+
 #define OCC_CNT(n) ((n) ? PStackGetSP( (PStack_p) ((n)->val1.p_val)) : 0)
 #define IS_BLOCKED(n) ((n) && PStackGetSP((PStack_p) ((n)->val1.p_val)) == 0)
 
@@ -43,6 +46,17 @@ typedef BCE_task* BCE_task_p;
 
 typedef bool (*BlockednessChecker)(BCE_task_p, Clause_p, TB_p);
 
+// Everything a (forked) worker needs to check a batch of tasks
+typedef struct
+{
+   PStack_p           tasks;
+   ClauseSet_p        archive;
+   BlockednessChecker checker;
+   TB_p               tmp_bank;
+} BCE_batch;
+
+typedef BCE_batch* BCE_batch_p;
+
 #define BCETaskFree(t) SizeFree((t), sizeof(BCE_task))
 
 /*---------------------------------------------------------------------*/
@@ -122,7 +136,9 @@ NumTree_p make_sym_map(ClauseSet_p set, int occ_limit, bool* eq_found)
 {
    NumTree_p res = NULL;
    IntOrP dummy = {.p_val = NULL};
-   for(Clause_p cl = set->anchor->succ; cl!=set->anchor; cl = cl->succ)
+   for(Clause_p cl = ClauseSucc(set->anchor);
+       cl!=set->anchor;
+       cl = ClauseSucc(cl))
    {
       for(Eqn_p lit=cl->literals; lit; lit = lit->next)
       {
@@ -199,7 +215,9 @@ NumTree_p make_sym_map(ClauseSet_p set, int occ_limit, bool* eq_found)
 MinHeap_p make_bce_queue(ClauseSet_p set, NumTree_p* sym_map, PStack_p fresh_clauses)
 {
    MinHeap_p res = MinHeapAlloc(compare_taks);
-   for(Clause_p cl = set->anchor->succ; cl!=set->anchor; cl = cl->succ)
+   for(Clause_p cl = ClauseSucc(set->anchor);
+       cl!=set->anchor;
+       cl = ClauseSucc(cl))
    {
       assert(cl->set);
       Clause_p f_cl = ClauseCopyDisjoint(cl);
@@ -501,9 +519,9 @@ void resume_task(MinHeap_p task_queue, BCE_task_p task)
 
 /*-----------------------------------------------------------------------
 //
-// Function: do_eliminate_clauses()
+// Function: free_blocker()
 // 
-//   Performs actual clause elimination
+//   Free the tasks waiting for a blocking clause to be removed.
 //
 // Global Variables: -
 //
@@ -522,57 +540,176 @@ void free_blocker(void *key, void* val)
    PStackFree(blocked_tasks);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: check_bce_batch_task()
+// 
+//   ForkMapLong() callback: Check the candidates of the idx-th task of
+//   the batch and return how far the check got. Tasks only read the
+//   clause set, so they are independent of each other (clauses
+//   archived by earlier tasks of the same batch are dealt with in the
+//   parent).
+//
+// Global Variables: -
+//
+// Side Effects    : Modifies the task (in the worker's copy)
+//
+/----------------------------------------------------------------------*/
+
+long check_bce_batch_task(void* data, long idx)
+{
+   BCE_batch_p batch = data;
+   BCE_task_p  t = PStackElementP(batch->tasks, idx);
+
+   check_candidates(t, batch->archive, batch->checker, batch->tmp_bank);
+   return t->processed_cands;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: check_batch()
+// 
+//   Check the candidates of all tasks in the batch, using up to
+//   workers processes. Afterwards each task has been forwarded to the
+//   first candidate that was non-blocking at the start of the batch
+//   (or past the last candidate).
+//
+// Global Variables: -
+//
+// Side Effects    : Forks worker processes
+//
+/----------------------------------------------------------------------*/
+
+void check_batch(BCE_batch_p batch, int workers)
+{
+   long size = PStackGetSP(batch->tasks);
+   long *res = SizeMalloc(size*sizeof(long));
+
+   ForkMapLong(size, workers, check_bce_batch_task, batch, res);
+   for(long i=0; i<size; i++)
+   {
+      BCE_task_p t = PStackElementP(batch->tasks, i);
+      t->processed_cands = res[i];
+   }
+   SizeFree(res, size*sizeof(long));
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: continue_checking()
+// 
+//   Return true if the task, which has been checked in a batch, needs
+//   to be checked further because the offending candidate has since
+//   been removed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline bool continue_checking(BCE_task_p t, ClauseSet_p archive)
+{
+   Clause_p cand;
+
+   if(!t->candidates || t->processed_cands == PStackGetSP(t->candidates))
+   {
+      return false;
+   }
+   cand = PStackElementP(t->candidates, t->processed_cands);
+   return cand->set == archive;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: do_eliminate_clauses()
+// 
+//   Performs actual clause elimination. Tasks are taken from the
+//   queue in batches of up to BCE_BATCH_FACTOR*workers tasks. The
+//   (expensive) candidate checks of a batch are done by forked
+//   workers, the (cheap) bookkeeping is done sequentially in queue
+//   order, so that the result is deterministic. With a single
+//   worker, tasks are processed one by one.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
 long do_eliminate_clauses(MinHeap_p task_queue, ClauseSet_p archive, 
-                          bool has_eq, TB_p tmp_bank)
+                          bool has_eq, int workers, TB_p tmp_bank)
 {
    PObjMap_p blocker_map = NULL;
    BlockednessChecker checker = 
       has_eq ? check_blockedness_eq : check_blockedness_neq;
    long eliminated = 0;
+   long batch_limit = workers > 1 ? BCE_BATCH_FACTOR*workers : 1;
+   BCE_batch batch = {PStackAlloc(), archive, checker, tmp_bank};
+   bool batch_checked;
+
    while(MinHeapSize(task_queue))
    {
-      BCE_task_p min_task = MinHeapPopMinP(task_queue);
-      if(min_task->orig_cl->set != archive)
+      PStackReset(batch.tasks);
+      while(MinHeapSize(task_queue) && PStackGetSP(batch.tasks) < batch_limit)
       {
-         // clause is not archived, we can go on
-         check_candidates(min_task, archive, checker, tmp_bank);
-         if(!min_task->candidates ||
-            min_task->processed_cands == PStackGetSP(min_task->candidates))
+         PStackPushP(batch.tasks, MinHeapPopMinP(task_queue));
+      }
+      batch_checked = PStackGetSP(batch.tasks) > 1;
+      if(batch_checked)
+      {
+         check_batch(&batch, workers);
+      }
+
+      for(PStackPointer i=0; i<PStackGetSP(batch.tasks); i++)
+      {
+         BCE_task_p min_task = PStackElementP(batch.tasks, i);
+         if(min_task->orig_cl->set != archive)
          {
-            // all candidates are processed, clause is blocked
-            ClauseSetMoveClause(archive, min_task->orig_cl);
-            eliminated++;
+            // clause is not archived, we can go on
+            if(!batch_checked || continue_checking(min_task, archive))
+            {
+               check_candidates(min_task, archive, checker, tmp_bank);
+            }
+            if(!min_task->candidates ||
+               min_task->processed_cands == PStackGetSP(min_task->candidates))
+            {
+               // all candidates are processed, clause is blocked
+               ClauseSetMoveClause(archive, min_task->orig_cl);
+               eliminated++;
 
-            PStack_p blocked = PObjMapExtract(&blocker_map, min_task->orig_cl, PCmpFun);
-            if(blocked)
+               PStack_p blocked = PObjMapExtract(&blocker_map, min_task->orig_cl, PCmpFun);
+               if(blocked)
+               {
+                  while(!PStackEmpty(blocked))
+                  {
+                     resume_task(task_queue, PStackPopP(blocked));
+                  }
+                  PStackFree(blocked);
+               }
+               BCETaskFree(min_task);
+            }
+            else
             {
-               while(!PStackEmpty(blocked))
+               // because of the last checked candidate, clause is not blocked.
+               // remember that checking of candidates needs to be continued
+               // once the clause which prevented blocking is removed
+               Clause_p offending_cl = PStackElementP(min_task->candidates, min_task->processed_cands);
+               PStack_p* blocked = (PStack_p*)PObjMapGetRef(&blocker_map, offending_cl, PCmpFun, NULL);
+               if(!*blocked)
                {
-                  resume_task(task_queue, PStackPopP(blocked));
+                  *blocked = PStackAlloc();
                }
-               PStackFree(blocked);
+               PStackPushP(*blocked, min_task);
             }
-            BCETaskFree(min_task);
          }
          else
          {
-            // because of the last checked candidate, clause is not blocked.
-            // remember that checking of candidates needs to be continued
-            // once the clause which prevented blocking is removed
-            Clause_p offending_cl = PStackElementP(min_task->candidates, min_task->processed_cands);
-            PStack_p* blocked = (PStack_p*)PObjMapGetRef(&blocker_map, offending_cl, PCmpFun, NULL);
-            if(!*blocked)
-            {
-               *blocked = PStackAlloc();
-            }
-            PStackPushP(*blocked, min_task);
+            BCETaskFree(min_task);
          }
       }
-      else
-      {
-         BCETaskFree(min_task);
-      }
    }
+   PStackFree(batch.tasks);
    PObjMapFreeWDeleter(blocker_map, free_blocker);
    return eliminated;
 }
@@ -587,7 +724,9 @@ long do_eliminate_clauses(MinHeap_p task_queue, ClauseSet_p archive,
 // 
 //   Performs the elimination of blocked clauses by moving them
 //   from passive to archive. Tracking a predicate symbol will be stopped
-//   after it reaches max_occs occurrences.
+//   after it reaches max_occs occurrences. If workers is greater than
+//   1, candidate checks are distributed over that many forked
+//   processes.
 //
 // Global Variables: -
 //
@@ -596,7 +735,7 @@ long do_eliminate_clauses(MinHeap_p task_queue, ClauseSet_p archive,
 /----------------------------------------------------------------------*/
 
 void EliminateBlockedClauses(ClauseSet_p passive, ClauseSet_p archive,
-                             int max_occs, TB_p tmp_bank)
+                             int max_occs, int workers, TB_p tmp_bank)
 {
    fprintf(stdout, "%% BCE start: %ld\n", ClauseSetCardinality(passive));
 
@@ -605,7 +744,7 @@ void EliminateBlockedClauses(ClauseSet_p passive, ClauseSet_p archive,
    PStack_p fresh_cls = PStackAlloc();
    MinHeap_p task_queue = make_bce_queue(passive, &sym_occs, fresh_cls);
    long num_eliminated = 
-      do_eliminate_clauses(task_queue, archive, eq_found, tmp_bank);
+      do_eliminate_clauses(task_queue, archive, eq_found, workers, tmp_bank);
    
    fprintf(stdout, "%% BCE eliminated: %ld.\n", num_eliminated);
 
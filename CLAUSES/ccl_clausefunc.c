@@ -291,8 +291,8 @@ long ClauseSetRemoveSuperfluousLiterals(ClauseSet_p set)
    Clause_p handle;
    long res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseRemoveSuperfluousLiterals(handle);
    }
@@ -318,8 +318,8 @@ void ClauseSetCanonize(ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!= set->anchor;
-       handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor;
+       handle = ClauseSucc(handle))
    {
       ClauseRemoveSuperfluousLiterals(handle);
       ClauseCanonize(handle);
@@ -467,9 +467,9 @@ Clause_p ClauseArchiveCopy(ClauseSet_p archive, Clause_p clause)
 
    archclause = ClauseFlatCopy(clause);
 
-   archclause->info = clause->info;
+   ClauseSetSourceInfo(archclause, ClauseSourceInfo(clause));
    archclause->derivation = clause->derivation;
-   clause->info       = NULL;
+   ClauseSetSourceInfo(clause, NULL);
    clause->derivation = NULL;
    ClausePushDerivation(clause, DCCnfQuote, archclause, NULL);
    ClauseSetInsert(archive, archclause);
@@ -499,8 +499,8 @@ void ClauseSetArchiveCopy(ClauseSet_p archive, ClauseSet_p set)
    assert(archive);
    assert(set);
 
-   for(handle = set->anchor->succ; handle!= set->anchor;
-       handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor;
+       handle = ClauseSucc(handle))
    {
       ClauseArchiveCopy(archive, handle);
    }
@@ -599,7 +599,7 @@ long ClauseSetDeleteOrphans(ClauseSet_p set)
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
       if(ClauseIsOrphaned(handle))
@@ -610,7 +610,7 @@ long ClauseSetDeleteOrphans(ClauseSet_p set)
       {
          ClauseDelProp(handle,CPDeleteClause);
       }
-      handle = handle->succ;
+      handle = ClauseSucc(handle);
    }
    return ClauseSetDeleteMarkedEntries(set);
 }
@@ -962,7 +962,7 @@ bool ClauseSetInjectivityIsDefined(ClauseSet_p all_defs, Clause_p inj_def)
    Term_p lhs = TBInsertDisjoint(bank, inj_def->literals->lterm);
    Term_p rhs = TBInsertDisjoint(bank, inj_def->literals->rterm);
    
-   Clause_p iter = all_defs->anchor->succ;
+   Clause_p iter = ClauseSucc(all_defs->anchor);
    while(!res && iter != all_defs->anchor)
    {
       assert(iter);
@@ -992,7 +992,7 @@ bool ClauseSetInjectivityIsDefined(ClauseSet_p all_defs, Clause_p inj_def)
          SubstDelete(subst);
       }      
       
-      iter = iter->succ;
+      iter = ClauseSucc(iter);
    }
 
 
@@ -1021,11 +1021,11 @@ long ClauseSetReplaceInjectivityDefs(ClauseSet_p set, ClauseSet_p archive, TB_p
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
       assert(handle);
-      next = handle->succ;
+      next = ClauseSucc(handle);
 
       Clause_p repl = ClauseRecognizeInjectivity(terms, handle);
 
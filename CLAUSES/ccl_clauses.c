@@ -15,6 +15,8 @@
   Run "eprover -h" for contact information.
 
   Created: Thu Apr 16 19:38:16 MET DST 1998
+  Mon Oct 19 04:12:37 CEST 2026: Source info side table (COMPACT_CLAUSES)
+  Mon Oct 19 04:12:37 CEST 2026: Exact key for cached maximality marks
 
   -----------------------------------------------------------------------*/
 
@@ -56,6 +58,29 @@ static long clause_perm_ident_counter = 0; /* Used to generate new
                                               the fly. */
 #endif
 
+/* Layout of clause->max_key: OCB ident and GC sweeps of the bank,
+   then literal cell, lterm, rterm and relevant properties for each
+   literal */
+#define CLAUSE_MAX_KEY_HEADER 2
+#define CLAUSE_MAX_KEY_LIT    4
+
+#ifdef COMPACT_CLAUSES
+/* Side table for the source info of clauses. It is made of chunks
+   of CLAUSE_META_CHUNK entries, slots of freed clauses are
+   recycled. Slot 0 is never handed out, so that clause->meta == 0
+   means "no info". */
+
+static PStack_p clause_meta_chunks = NULL; /* Of ClauseInfo_p arrays */
+static PStack_p clause_meta_free   = NULL; /* Of free slots */
+static long     clause_meta_slots  = 1;    /* Slots handed out */
+static long     clause_meta_live   = 0;    /* Slots in use */
+
+#define clause_meta_entry(slot)                                         \
+   (((ClauseInfo_p*)PStackElementP(clause_meta_chunks,                  \
+                                   (slot)/CLAUSE_META_CHUNK))           \
+    [(slot)%CLAUSE_META_CHUNK])
+#endif
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -65,6 +90,109 @@ static long clause_perm_ident_counter = 0; /* Used to generate new
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_max_key_valid()
+//
+//   Return true if the maximality marks of the literals of clause
+//   have been computed with ocb for exactly the current literal
+//   list, i.e. the key stored by clause_max_key_store() still
+//   matches. The key records the OCB ident, the number of garbage
+//   collections of the term bank (so that term addresses cannot have
+//   been reused) and, in order, each literal cell with its (shared)
+//   terms, sign and pseudo-literal flag. Clauses with selected
+//   literals never match, as LiteralCompare() treats selected
+//   literals as bigger and the selection is not part of the key.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool clause_max_key_valid(OCB_p ocb, Clause_p clause)
+{
+   PStack_p      key = clause->max_key;
+   PStackPointer i;
+   Eqn_p         handle;
+
+   if(!key || PStackEmpty(key) ||
+      PStackGetSP(key) != CLAUSE_MAX_KEY_HEADER+
+      CLAUSE_MAX_KEY_LIT*ClauseLiteralNumber(clause) ||
+      PStackElementInt(key, 0) != ocb->ident ||
+      (clause->literals &&
+       PStackElementInt(key, 1) !=
+       (long)clause->literals->bank->gc_sweeps))
+   {
+      return false;
+   }
+   i = CLAUSE_MAX_KEY_HEADER;
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(EqnIsSelected(handle) ||
+         PStackElementP(key, i) != handle ||
+         PStackElementP(key, i+1) != handle->lterm ||
+         PStackElementP(key, i+2) != handle->rterm ||
+         PStackElementInt(key, i+3) !=
+         (handle->properties & (EPIsPositive|EPPseudoLit)))
+      {
+         return false;
+      }
+      i += CLAUSE_MAX_KEY_LIT;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_max_key_store()
+//
+//   Record the key for the maximality marks just computed for clause
+//   with ocb (see clause_max_key_valid()). If a literal is selected,
+//   the key is only cleared.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void clause_max_key_store(OCB_p ocb, Clause_p clause)
+{
+   Eqn_p handle;
+
+   if(clause->max_key)
+   {
+      PStackReset(clause->max_key);
+   }
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(EqnIsSelected(handle))
+      {
+         return;
+      }
+   }
+   if(!clause->max_key)
+   {
+      clause->max_key = PStackVarAlloc(CLAUSE_MAX_KEY_HEADER+
+                                       CLAUSE_MAX_KEY_LIT*
+                                       ClauseLiteralNumber(clause));
+   }
+   PStackPushInt(clause->max_key, ocb->ident);
+   PStackPushInt(clause->max_key,
+                 clause->literals?clause->literals->bank->gc_sweeps:0);
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      PStackPushP(clause->max_key, handle);
+      PStackPushP(clause->max_key, handle->lterm);
+      PStackPushP(clause->max_key, handle->rterm);
+      PStackPushInt(clause->max_key,
+                    handle->properties & (EPIsPositive|EPPseudoLit));
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: foundEqLitLater
@@ -118,15 +246,20 @@ Clause_p clause_copy_meta(Clause_p clause)
    handle->evaluations = NULL;
    handle->set         = NULL;
    handle->properties  = clause->properties;
-   handle->info        = NULL;
+   ClauseSetSourceInfo(handle, NULL);
    handle->derivation  = NULL;
+#ifndef COMPACT_CLAUSES
    handle->feature_vec = NULL;
+#endif
+   handle->max_key     = NULL;
    handle->create_date = clause->create_date;
    handle->date        = clause->date;
    handle->proof_depth = clause->proof_depth;
    handle->proof_size  = clause->proof_size;
+#ifndef COMPACT_CLAUSES
    handle->pred        = NULL;
    handle->succ        = NULL;
+#endif
 
    return handle;
 }
@@ -216,7 +349,9 @@ void ClauseSetTPTPType(Clause_p clause, FormulaProperties type)
 // Function: ClauseCellAlloc()
 //
 //   Allocate a clause cell. This is a thin wrapper only relevant when
-//   perm-idents are enabled for debugging.
+//   perm-idents are enabled for debugging or when clauses are
+//   compact (the side table slot and set position need to be
+//   valid from the start).
 //
 // Global Variables: -
 //
@@ -231,11 +366,114 @@ Clause_p ClauseCellAlloc(void)
 #ifdef CLAUSE_PERM_IDENT
    handle->perm_ident = clause_perm_ident_counter++;
 #endif
-
+#ifdef COMPACT_CLAUSES
+   handle->meta    = 0;
+   handle->set     = NULL;
+   handle->set_pos = -1;
+#endif
 
    return handle;
 }
 
+
+#ifdef COMPACT_CLAUSES
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSourceInfo()
+//
+//   Return the source info of clause (NULL if it has none).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+ClauseInfo_p ClauseSourceInfo(Clause_p clause)
+{
+   if(!clause->meta)
+   {
+      return NULL;
+   }
+   return clause_meta_entry(clause->meta);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetSourceInfo()
+//
+//   Set the source info of clause. Allocates a slot in the side
+//   table if necessary, and releases it if info is NULL. Does not
+//   free the old info.
+//
+// Global Variables: clause_meta_chunks, clause_meta_free,
+//                   clause_meta_slots, clause_meta_live
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetSourceInfo(Clause_p clause, ClauseInfo_p info)
+{
+   ClauseInfo_p *chunk;
+   long         slot;
+
+   if(!info)
+   {
+      if(clause->meta)
+      {
+         PStackPushInt(clause_meta_free, clause->meta);
+         clause->meta = 0;
+         clause_meta_live--;
+         if(!clause_meta_live)
+         {
+            /* Release the table, so that it does not show up as
+               garbage at the end */
+            while(!PStackEmpty(clause_meta_chunks))
+            {
+               chunk = PStackPopP(clause_meta_chunks);
+               SizeFree(chunk, CLAUSE_META_CHUNK*sizeof(ClauseInfo_p));
+            }
+            PStackFree(clause_meta_chunks);
+            PStackFree(clause_meta_free);
+            clause_meta_chunks = NULL;
+            clause_meta_free   = NULL;
+            clause_meta_slots  = 1;
+         }
+      }
+      return;
+   }
+   if(!clause->meta)
+   {
+      if(!clause_meta_chunks)
+      {
+         clause_meta_chunks = PStackAlloc();
+         clause_meta_free   = PStackAlloc();
+      }
+      if(!PStackEmpty(clause_meta_free))
+      {
+         slot = PStackPopInt(clause_meta_free);
+      }
+      else
+      {
+         slot = clause_meta_slots++;
+         if(slot/CLAUSE_META_CHUNK >= PStackGetSP(clause_meta_chunks))
+         {
+            chunk = SizeMalloc(CLAUSE_META_CHUNK*sizeof(ClauseInfo_p));
+            PStackPushP(clause_meta_chunks, chunk);
+         }
+      }
+      assert(slot <= UINT32_MAX);
+      clause->meta = slot;
+      clause_meta_live++;
+   }
+   clause_meta_entry(clause->meta) = info;
+}
+
+#endif
+
 /*-----------------------------------------------------------------------
 //
 // Function: EmptyClauseAlloc()
@@ -257,18 +495,21 @@ Clause_p EmptyClauseAlloc(void)
    handle->neg_lit_no  = 0;
    handle->pos_lit_no  = 0;
    handle->weight      = 0;
+   handle->max_key     = NULL;
    handle->evaluations = NULL;
    handle->properties  = CPIgnoreProps;
-   handle->info        = NULL;
+   ClauseSetSourceInfo(handle, NULL);
    handle->derivation  = NULL;
    handle->create_date = 0;
    handle->date        = SysDateCreationTime();
    handle->proof_depth = 0;
    handle->proof_size  = 0;
-   handle->feature_vec = NULL;
    handle->set         = NULL;
+#ifndef COMPACT_CLAUSES
+   handle->feature_vec = NULL;
    handle->pred        = NULL;
    handle->succ        = NULL;
+#endif
 
    return handle;
 }
@@ -687,15 +928,22 @@ void ClauseFree(Clause_p junk)
    assert(!junk->set);
    EvalsFree(junk->evaluations);
    EqnListFree(junk->literals);
-   ClauseInfoFree(junk->info);
+   ClauseInfoFree(ClauseSourceInfo(junk));
+   ClauseSetSourceInfo(junk, NULL);
    if(junk->derivation)
    {
       PStackFree(junk->derivation);
    }
+   if(junk->max_key)
+   {
+      PStackFree(junk->max_key);
+   }
+#ifndef COMPACT_CLAUSES
    if(junk->feature_vec)
    {
       FixedDArrayFree(junk->feature_vec);
    }
+#endif
    ClauseCellFree(junk);
 }
 
@@ -1778,7 +2026,7 @@ Clause_p ClauseParse(Scanner_p in, TB_p bank)
    handle = ClauseAlloc(concl);
    ClauseSetTPTPType(handle, type);
    ClauseSetProp(handle, CPInitial|input);
-   handle->info = info;
+   ClauseSetSourceInfo(handle, info);
    return handle;
 }
 
@@ -1823,7 +2071,9 @@ Clause_p ClausePCLParse(Scanner_p in, TB_p bank)
 //
 // Function: ClauseMarkMaximalTerms()
 //
-//   Orient literals, mark maximal literals.
+//   Orient literals, mark maximal literals. Orientation is cached in
+//   the literals, maximality is only recomputed if the literals (or
+//   the ordering) changed since it was last computed for clause.
 //
 // Global Variables: -
 //
@@ -1835,7 +2085,11 @@ void ClauseMarkMaximalTerms(OCB_p ocb, Clause_p clause)
 {
    EqnListOrient(ocb, clause->literals);
    // printf("Litno: %d\n", ClauseLiteralNumber(clause));
-   EqnListMaximalLiterals(ocb, clause->literals);
+   if(!clause_max_key_valid(ocb, clause))
+   {
+      EqnListMaximalLiterals(ocb, clause->literals);
+      clause_max_key_store(ocb, clause);
+   }
    ClauseSetProp(clause, CPIsOriented);
 }
 
@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created:  Thu Apr 16 19:38:16 MET DST 1998
+  Mon Oct 19 04:12:37 CEST 2026: Compact clause cells (COMPACT_CLAUSES)
 
   -----------------------------------------------------------------------*/
 
@@ -132,6 +133,13 @@ typedef enum
 }FormulaProperties;
 
 
+/* With COMPACT_CLAUSES, the source info (only set for input clauses)
+   lives in a side table and is accessed via ClauseSourceInfo() and
+   ClauseSetSourceInfo(), create_date and proof_depth are 32 bit
+   counters, and clause sets keep their members in a vector of slots
+   instead of a doubly linked list (use ClauseSucc() and ClausePred()
+   to traverse them). */
+
 typedef struct clause_cell
 {
    long                  ident;       /* Hopefully unique ident for
@@ -148,27 +156,48 @@ typedef struct clause_cell
    int                   pos_lit_no;  /* Positive literals */
    FormulaProperties     properties;  /* Anything we want to note at
                                          the clause? */
+#ifdef COMPACT_CLAUSES
+   uint32_t              meta;        /* Slot of the source info in
+                                         the side table, 0 if none */
+   int32_t               create_date; /* As below, but 32 bit */
+   int32_t               proof_depth;
+#endif
    long                  weight;      /* ClauseStandardWeight()
                                          precomputed at some points in
                                          the program */
+   PStack_p              max_key;     /* Literals and ordering the
+                                         maximality marks were
+                                         computed for, NULL or empty
+                                         if none */
    Eval_p                evaluations; /* List of evaluations */
+#ifndef COMPACT_CLAUSES
    ClauseInfo_p          info;        /* Currently about source in
                                          input, NULL for derived clauses */
+#endif
    PStack_p              derivation;  /* Derivation of the clause for
                                          proof reconstruction. */
+#ifndef COMPACT_CLAUSES
    long                  create_date; /* At what iteration of the
                                          main loop has this
                                          clause been created? */
    long                  proof_depth; /* How long is the longest
                                          derivation chain from this
                                          clause to an axiom? */
+#endif
    long                  proof_size;  /* How many (generating)
                                          inferences were necessary to
                                          create this clause? */
+#ifndef COMPACT_CLAUSES
    FixedDArray_p         feature_vec; /* For subsumption indexing */
+#endif
    struct clausesetcell* set;         /* Is the clause in a set? */
+#ifdef COMPACT_CLAUSES
+   long                  set_pos;     /* Slot in set->slots, -1 for
+                                         the anchor and free clauses */
+#else
    struct clause_cell*   pred;        /* For clause sets = doubly  */
    struct clause_cell*   succ;        /* linked lists */
+#endif
 }ClauseCell, *Clause_p;
 
 /*---------------------------------------------------------------------*/
@@ -215,6 +244,22 @@ void ClauseSetTPTPType(Clause_p clause, FormulaProperties type);
 #define CLAUSECELL_MEM (MEMSIZE(ClauseCell)+PSTACK_AVG_MEM)
 #endif
 
+#ifdef COMPACT_CLAUSES
+#define CLAUSE_META_CHUNK 1024
+
+ClauseInfo_p ClauseSourceInfo(Clause_p clause);
+void         ClauseSetSourceInfo(Clause_p clause, ClauseInfo_p info);
+
+/* Inline functions from ccl_clausesets.h */
+#define ClauseSucc(clause) ClauseSetMemberSucc(clause)
+#define ClausePred(clause) ClauseSetMemberPred(clause)
+#else
+#define ClauseSourceInfo(clause) ((clause)->info)
+#define ClauseSetSourceInfo(clause, new_info) ((clause)->info = (new_info))
+#define ClauseSucc(clause) ((clause)->succ)
+#define ClausePred(clause) ((clause)->pred)
+#endif
+
 Clause_p ClauseCellAlloc(void);
 Clause_p EmptyClauseAlloc(void);
 Clause_p ClauseAlloc(Eqn_p literals);
@@ -325,6 +370,9 @@ Clause_p          ClauseParse(Scanner_p in, TB_p bank);
 Clause_p          ClausePCLParse(Scanner_p in, TB_p bank);
 
 void     ClauseMarkMaximalTerms(OCB_p ocb, Clause_p clause);
+#define  ClauseMaxCacheInvalidate(clause)                \
+   if((clause)->max_key)                                \
+   {PStackReset((clause)->max_key);}
 #define  ClauseCondMarkMaximalTerms(ocb, clause)        \
    if(!ClauseQueryProp(clause, CPIsOriented))           \
    {ClauseMarkMaximalTerms(ocb,clause);}
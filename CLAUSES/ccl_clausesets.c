@@ -16,6 +16,8 @@
   Run "eprover -h" for contact information.
 
   Created: Sun May 10 03:03:20 MET DST 1998
+  Mon Oct 19 04:12:37 CEST 2026: Optional slot vector representation
+  (COMPACT_CLAUSES)
 
   -----------------------------------------------------------------------*/
 
@@ -253,6 +255,51 @@ static void tptp_eq_pred_axiom_print(FILE* out, char* symbol, int arity,
 }
 
 
+#ifdef COMPACT_CLAUSES
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_set_compact_slots()
+//
+//   Move the members of set to the front of the slot vector, closing
+//   all gaps left by removed clauses, and release surplus chunks.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, updates set_pos of members, memory
+//                   operations.
+//
+/----------------------------------------------------------------------*/
+
+static void clause_set_compact_slots(ClauseSet_p set)
+{
+   long     i, j = 0;
+   Clause_p handle, *chunk;
+   long     chunks;
+
+   for(i=set->first; i<set->slot_no; i++)
+   {
+      handle = ClauseSetSlot(set, i);
+      if(handle)
+      {
+         ClauseSetSlot(set, j) = handle;
+         handle->set_pos = j;
+         j++;
+      }
+   }
+   assert(j == set->members);
+   set->slot_no = j;
+   set->first   = 0;
+   chunks = (j+CLAUSE_SET_CHUNK-1)/CLAUSE_SET_CHUNK;
+   while(PStackGetSP(set->slots) > chunks)
+   {
+      chunk = PStackPopP(set->slots);
+      SizeFree(chunk, CLAUSE_SET_CHUNK*sizeof(Clause_p));
+   }
+}
+
+#endif
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_set_extract_entry()
@@ -269,6 +316,9 @@ static void clause_set_extract_entry(Clause_p clause)
 {
    int     i;
    Eval_p *root;
+#ifdef COMPACT_CLAUSES
+   ClauseSet_p set;
+#endif
 
    assert(clause);
    assert(clause->set);
@@ -286,6 +336,32 @@ static void clause_set_extract_entry(Clause_p clause)
                               i);
       }
    }
+#ifdef COMPACT_CLAUSES
+   set = clause->set;
+   assert(ClauseSetSlot(set, clause->set_pos) == clause);
+   ClauseSetSlot(set, clause->set_pos) = NULL;
+   clause->set_pos = -1;
+   set->literals-=ClauseLiteralNumber(clause);
+   set->members--;
+   clause->set = NULL;
+   if(!set->members)
+   {
+      set->slot_no = 0;
+      set->first   = 0;
+   }
+   else
+   {
+      while(!ClauseSetSlot(set, set->slot_no-1))
+      {
+         set->slot_no--;
+      }
+      if((set->slot_no >= CLAUSE_SET_CHUNK) &&
+         (set->slot_no-set->members > set->members))
+      {
+         clause_set_compact_slots(set);
+      }
+   }
+#else
    clause->pred->succ = clause->succ;
    clause->succ->pred = clause->pred;
    clause->set->literals-=ClauseLiteralNumber(clause);
@@ -293,6 +369,7 @@ static void clause_set_extract_entry(Clause_p clause)
    clause->set = NULL;
    clause->succ = NULL;
    clause->pred = NULL;
+#endif
 }
 
 
@@ -323,11 +400,21 @@ ClauseSet_p ClauseSetAlloc(void)
    handle->literals = 0;
    handle->anchor = ClauseCellAlloc();
    handle->anchor->literals = NULL;
+#ifdef COMPACT_CLAUSES
+   handle->anchor->set = handle;
+   handle->slots   = PStackAlloc();
+   handle->slot_no = 0;
+   handle->first   = 0;
+#else
    handle->anchor->pred = handle->anchor->succ = handle->anchor;
+#endif
    handle->date = SysDateCreationTime();
    SysDateInc(&handle->date);
    handle->demod_index = NULL;
    handle->fvindex = NULL;
+   handle->csr_index = NULL;
+   handle->ground_cc = NULL;
+   handle->nf_cache  = NULL;
 
    handle->eval_indices = PDArrayAlloc(4,4);
    handle->eval_no = 0;
@@ -378,6 +465,10 @@ void ClauseSetFreeClauses(ClauseSet_p set)
 
 void ClauseSetFree(ClauseSet_p junk)
 {
+#ifdef COMPACT_CLAUSES
+   Clause_p *chunk;
+#endif
+
    assert(junk);
 
    ClauseSetFreeClauses(junk);
@@ -390,7 +481,19 @@ void ClauseSetFree(ClauseSet_p junk)
    {
       FVIAnchorFree(junk->fvindex);
    }
+   if(junk->csr_index)
+   {
+      CSRIndexFree(junk->csr_index);
+   }
    PDArrayFree(junk->eval_indices);
+#ifdef COMPACT_CLAUSES
+   while(!PStackEmpty(junk->slots))
+   {
+      chunk = PStackPopP(junk->slots);
+      SizeFree(chunk, CLAUSE_SET_CHUNK*sizeof(Clause_p));
+   }
+   PStackFree(junk->slots);
+#endif
    ClauseCellFree(junk->anchor);
    DStrFree(junk->identifier);
    ClauseSetCellFree(junk);
@@ -443,13 +546,121 @@ void ClauseSetGCMarkTerms(ClauseSet_p set)
 {
    Clause_p handle;
 
+#ifdef COMPACT_CLAUSES
+   long i;
+
+   for(i=set->first; i<set->slot_no; i++)
+   {
+      handle = ClauseSetSlot(set, i);
+      if(handle)
+      {
+         ClauseGCMarkTerms(handle);
+      }
+   }
+#else
    for(handle = set->anchor->succ; handle!=set->anchor; handle =
           handle->succ)
    {
       ClauseGCMarkTerms(handle);
    }
+#endif
 }
 
+#ifdef COMPACT_CLAUSES
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetScanSucc()
+//
+//   Return the clause following clause in its set (or the anchor, if
+//   clause is the last one). If clause is the anchor, return the
+//   first clause of the set (or the anchor for an empty set). This is
+//   the general case of ClauseSetMemberSucc(), skipping empty slots.
+//   Every slot passed triggers the prefetch of the slot
+//   CLAUSE_SET_PREFETCH positions ahead, as in the inline case.
+//
+// Global Variables: -
+//
+// Side Effects    : May advance the first-slot hint of the set,
+//                   prefetches.
+//
+/----------------------------------------------------------------------*/
+
+Clause_p ClauseSetScanSucc(Clause_p clause)
+{
+   ClauseSet_p set = clause->set;
+   Clause_p    handle;
+   long        i;
+
+   assert(set);
+   if(clause == set->anchor)
+   {
+      for(i=set->first; i<set->slot_no; i++)
+      {
+         handle = ClauseSetSlot(set, i);
+         ClauseSetPrefetchSlot(set, i+CLAUSE_SET_PREFETCH);
+         if(handle)
+         {
+            set->first = i;
+            return handle;
+         }
+      }
+      return set->anchor;
+   }
+   assert(ClauseSetSlot(set, clause->set_pos) == clause);
+   for(i=clause->set_pos+1; i<set->slot_no; i++)
+   {
+      handle = ClauseSetSlot(set, i);
+      ClauseSetPrefetchSlot(set, i+CLAUSE_SET_PREFETCH);
+      if(handle)
+      {
+         return handle;
+      }
+   }
+   return set->anchor;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetScanPred()
+//
+//   Return the clause preceding clause in its set (or the anchor, if
+//   clause is the first one). If clause is the anchor, return the last
+//   clause of the set (or the anchor for an empty set). This is the
+//   general case of ClauseSetMemberPred(), skipping empty slots.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+Clause_p ClauseSetScanPred(Clause_p clause)
+{
+   ClauseSet_p set = clause->set;
+   Clause_p    handle;
+   long        i;
+
+   assert(set);
+   if(clause == set->anchor)
+   {
+      return set->slot_no? ClauseSetSlot(set, set->slot_no-1) : set->anchor;
+   }
+   assert(ClauseSetSlot(set, clause->set_pos) == clause);
+   for(i=clause->set_pos-1; i>=set->first; i--)
+   {
+      handle = ClauseSetSlot(set, i);
+      if(handle)
+      {
+         return handle;
+      }
+   }
+   return set->anchor;
+}
+
+#endif
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetInsert()
@@ -472,10 +683,21 @@ void ClauseSetInsert(ClauseSet_p set, Clause_p newclause)
 
    assert(!newclause->set);
 
+#ifdef COMPACT_CLAUSES
+   if(set->slot_no == PStackGetSP(set->slots)*CLAUSE_SET_CHUNK)
+   {
+      PStackPushP(set->slots,
+                  SizeMalloc(CLAUSE_SET_CHUNK*sizeof(Clause_p)));
+   }
+   ClauseSetSlot(set, set->slot_no) = newclause;
+   newclause->set_pos = set->slot_no;
+   set->slot_no++;
+#else
    newclause->succ = set->anchor;
    newclause->pred = set->anchor->pred;
    set->anchor->pred->succ = newclause;
    set->anchor->pred = newclause;
+#endif
    newclause->set = set;
    set->members++;
    set->literals+=ClauseLiteralNumber(newclause);
@@ -599,6 +821,18 @@ void ClauseSetIndexedInsert(ClauseSet_p set, FVPackedClause_p newclause)
       FVIndexInsert(set->fvindex, newclause);
       ClauseSetProp(newclause->clause, CPIsSIndexed);
    }
+   if(set->csr_index)
+   {
+      CSRIndexInsertClause(set->csr_index, newclause->clause);
+   }
+   if(set->ground_cc && GroundCCUnit(newclause->clause))
+   {
+      GroundCCAddUnit(set->ground_cc, newclause->clause);
+   }
+   if(set->nf_cache && set->demod_index)
+   {
+      NFCacheAddDemodulator(set->nf_cache, newclause->clause);
+   }
 }
 
 
@@ -690,6 +924,14 @@ Clause_p ClauseSetExtractEntry(Clause_p clause)
       FVIndexDelete(clause->set->fvindex, clause);
       ClauseDelProp(clause, CPIsSIndexed);
    }
+   if(clause->set->csr_index)
+   {
+      CSRIndexDeleteClause(clause->set->csr_index, clause);
+   }
+   if(clause->set->ground_cc)
+   {
+      GroundCCRemoveUnit(clause->set->ground_cc, clause);
+   }
    clause_set_extract_entry(clause);
    return clause;
 }
@@ -716,7 +958,7 @@ Clause_p ClauseSetExtractFirst(ClauseSet_p set)
    {
       return NULL;
    }
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    assert(handle->set == set);
    ClauseSetExtractEntry(handle);
 
@@ -768,7 +1010,7 @@ Clause_p ClauseSetFindBest(ClauseSet_p set, int idx)
 
    if(!evaluation)
    {
-      assert(set->anchor->succ == set->anchor);
+      assert(ClauseSucc(set->anchor) == set->anchor);
       return NULL;
    }
    assert(evaluation->object);
@@ -796,8 +1038,8 @@ void ClauseSetPrint(FILE* out, ClauseSet_p set, bool fullterms)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClausePrint(out, handle, fullterms);
       fputc('\n', out);
@@ -821,8 +1063,8 @@ void ClauseSetTSTPPrint(FILE* out, ClauseSet_p set, bool fullterms)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseTSTPPrint(out, handle, fullterms, true);
       fputc('\n', out);
@@ -846,8 +1088,8 @@ void ClauseSetPrintPrefix(FILE* out, char* prefix, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       fputs(prefix, out);
       ClausePrint(out, handle, true);
@@ -915,8 +1157,8 @@ void ClauseSetSetProp(ClauseSet_p set, FormulaProperties prop)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseSetProp(handle, prop);
    }
@@ -939,8 +1181,8 @@ void ClauseSetDelProp(ClauseSet_p set, FormulaProperties prop)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseDelProp(handle, prop);
    }
@@ -963,8 +1205,8 @@ void ClauseSetSetTPTPType(ClauseSet_p set, FormulaProperties type)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseSetTPTPType(handle, type);
    }
@@ -996,8 +1238,8 @@ long ClauseSetMarkCopies(ClauseSet_p set)
 
    assert(set);
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if((exists = PTreeObjStore(&store, handle,
                                  ClauseCompareFun)))
@@ -1039,12 +1281,12 @@ long ClauseSetDeleteMarkedEntries(ClauseSet_p set)
 
    assert(set);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
 
    while(handle != set->anchor)
    {
       clause = handle;
-      handle = handle->succ;
+      handle = ClauseSucc(handle);
 
       if(ClauseQueryProp(clause, CPDeleteClause))
       {
@@ -1103,7 +1345,7 @@ long ClauseSetDeleteNonUnits(ClauseSet_p set)
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
       if(ClauseLiteralNumber(handle)>1)
@@ -1114,7 +1356,7 @@ long ClauseSetDeleteNonUnits(ClauseSet_p set)
       {
          ClauseDelProp(handle,CPDeleteClause);
       }
-      handle = handle->succ;
+      handle = ClauseSucc(handle);
    }
    return ClauseSetDeleteMarkedEntries(set);
 }
@@ -1140,8 +1382,8 @@ long ClauseSetGetTermNodes(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseWeight(handle, 1, 1, 1, 1, 1, 1, true);
    }
@@ -1166,8 +1408,8 @@ long ClauseSetMarkSOS(ClauseSet_p set, bool tptp_types)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       if((tptp_types && (ClauseQueryTPTPType(handle) == CPTypeConjecture))||
          (!tptp_types && (ClauseIsGoal(handle))))
@@ -1200,8 +1442,8 @@ void ClauseSetTermSetProp(ClauseSet_p set, TermProperties prop)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseTermSetProp(handle, prop);
    }
@@ -1224,8 +1466,8 @@ long ClauseSetTBTermPropDelCount(ClauseSet_p set, TermProperties prop)
    Clause_p handle;
    long res = 0;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseTBTermDelPropCount(handle, prop);
    }
@@ -1302,8 +1544,8 @@ void ClauseSetMarkMaximalTerms(OCB_p ocb, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseMarkMaximalTerms(ocb, handle);
    }
@@ -1326,8 +1568,8 @@ void ClauseSetSortLiterals(ClauseSet_p set, ComparisonFunctionType cmp_fun)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseSortLiterals(handle, cmp_fun);
    }
@@ -1361,6 +1603,42 @@ SysDate ClauseSetListGetMaxDate(ClauseSet_p *demodulators, int limit)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetListGetNFCache()
+//
+//   Return the normal form cache shared by the first limit elements
+//   of demodulators if there is one for terms from bank, NULL
+//   otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+NFCache_p ClauseSetListGetNFCache(ClauseSet_p *demodulators, int limit,
+                                  TB_p bank)
+{
+   int i;
+   NFCache_p res;
+
+   if(!limit)
+   {
+      return NULL;
+   }
+   res = demodulators[0]->nf_cache;
+   for(i=1; i<limit; i++)
+   {
+      if(demodulators[i]->nf_cache != res)
+      {
+         return NULL;
+      }
+   }
+   return (res && (res->bank == bank))?res:NULL;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetFind()
@@ -1382,8 +1660,8 @@ Clause_p ClauseSetFind(ClauseSet_p set, Clause_p clause)
    assert(set);
    assert(clause);
 
-   for(handle = set->anchor->succ; handle!=set->anchor;
-       handle=handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor;
+       handle=ClauseSucc(handle))
    {
       if(handle == clause)
       {
@@ -1415,8 +1693,8 @@ Clause_p ClauseSetFindById(ClauseSet_p set, long ident)
 
    assert(set);
 
-   for(handle = set->anchor->succ; handle!=set->anchor;
-       handle=handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor;
+       handle=ClauseSucc(handle))
    {
       if(handle->ident == ident)
       {
@@ -1449,8 +1727,8 @@ void ClauseSetRemoveEvaluations(ClauseSet_p set)
    {
       PDArrayAssignP(set->eval_indices, i, NULL);
    }
-   for(handle = set->anchor->succ; handle!=set->anchor;
-       handle=handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor;
+       handle=ClauseSucc(handle))
    {
       EvalsFree(handle->evaluations);
       handle->evaluations = NULL;
@@ -1479,10 +1757,10 @@ long ClauseSetFilterTrivial(ClauseSet_p set)
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
-      next = handle->succ;
+      next = ClauseSucc(handle);
 
       assert(handle);
 
@@ -1518,10 +1796,10 @@ long ClauseSetFilterTautologies(ClauseSet_p set, TB_p work_bank)
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
-      next = handle->succ;
+      next = ClauseSucc(handle);
 
       assert(handle);
 
@@ -1555,7 +1833,7 @@ Clause_p ClauseSetFindMaxStandardWeight(ClauseSet_p set)
 
    assert(set);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
       weight = ClauseStandardWeight(handle);
@@ -1564,7 +1842,7 @@ Clause_p ClauseSetFindMaxStandardWeight(ClauseSet_p set)
          res = handle;
          max_weight = weight;
       }
-      handle = handle->succ;
+      handle = ClauseSucc(handle);
    }
    return res;
 }
@@ -1593,12 +1871,12 @@ ClausePos_p ClauseSetFindEqDefinition(ClauseSet_p set, int min_arity,
 
    if(!start)
    {
-      start = set->anchor->succ;
+      start = ClauseSucc(set->anchor);
    }
 
    for(handle = start;
        handle!=set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       side = ClauseIsEqDefinition(handle, min_arity);
       if(side!=NoSide)
@@ -1638,8 +1916,8 @@ void ClauseSetDocInital(FILE* out, long level, ClauseSet_p set)
 
    if(level>=2)
    {
-      for(handle = set->anchor->succ; handle!=set->anchor; handle =
-             handle->succ)
+      for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+             ClauseSucc(handle))
       {
          DocClauseCreation(out, OutputLevel, handle,
                            inf_initial, NULL, NULL,
@@ -1668,8 +1946,8 @@ void ClauseSetPropDocQuote(FILE* out, long level, FormulaProperties prop,
 
    if(level>=2)
    {
-      for(handle = set->anchor->succ; handle!=set->anchor; handle =
-             handle->succ)
+      for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+             ClauseSucc(handle))
       {
          if(ClauseQueryProp(handle, prop))
          {
@@ -1730,12 +2008,12 @@ bool ClauseSetVerifyDemod(ClauseSet_p demods, ClausePos_p pos)
 
 bool PDTreeVerifyIndex(PDTree_p tree, ClauseSet_p demods)
 {
-   PStack_p stack = PStackAlloc(), trav;
+   PStack_p stack = PStackAlloc();
    PDTNode_p handle;
    long             i;
    IntMapIter_p     iter;
    ClausePos_p      pos;
-   PTree_p          entry;
+   BTreeIterCell    trav;
    bool             res = true;
 
    PStackPushP(stack, tree->tree);
@@ -1773,10 +2051,9 @@ bool PDTreeVerifyIndex(PDTree_p tree, ClauseSet_p demods)
       }
       else
       {
-         trav = PTreeTraverseInit(handle->entries);
-         while((entry = PTreeTraverseNext(trav)))
+         PBTreeIterInit(&trav, handle->entries);
+         while((pos = PBTreeIterNext(&trav)))
          {
-            pos = entry->key;
             if(!ClauseSetFind(demods, pos->clause))
             {
                res = false;
@@ -1787,7 +2064,6 @@ bool PDTreeVerifyIndex(PDTree_p tree, ClauseSet_p demods)
                   printf("\n"); */
             }
          }
-         PTreeTraverseExit(trav);
       }
    }
    PStackFree(stack);
@@ -1888,8 +2164,8 @@ void ClauseSetAddSymbolDistribution(ClauseSet_p set, long *dist_array)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseAddSymbolDistribution(handle, dist_array);
    }
@@ -1911,8 +2187,8 @@ void ClauseSetAddTypeDistribution(ClauseSet_p set, long *type_array)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseAddTypeDistribution(handle, type_array);
    }
@@ -1935,8 +2211,8 @@ void ClauseSetAddConjSymbolDistribution(ClauseSet_p set, long *dist_array)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle))
       {
@@ -1962,8 +2238,8 @@ void ClauseSetAddAxiomSymbolDistribution(ClauseSet_p set, long *dist_array)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(!ClauseIsConjecture(handle))
       {
@@ -1991,8 +2267,8 @@ void ClauseSetComputeFunctionRanks(ClauseSet_p set, long *rank_array,
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseComputeFunctionRanks(handle, rank_array, count);
    }
@@ -2063,8 +2339,8 @@ long ClauseSetMaxVarNumber(ClauseSet_p set)
    PTree_p tree;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!= set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor; handle =
+          ClauseSucc(handle))
    {
       tree = NULL;
       tmp = ClauseCollectVariables(handle, &tree);
@@ -2101,9 +2377,9 @@ long ClauseSetFindCharFreqVectors(ClauseSet_p set, FreqVector_p fsum,
    FreqVectorInitialize(fmax, 0);
    FreqVectorInitialize(fmin, LONG_MAX);
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!= set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       current = VarFreqVectorCompute(handle, cspec);
       FreqVectorAdd(fsum, fsum, current);
@@ -2264,9 +2540,9 @@ long ClauseSetSplitConjectures(ClauseSet_p set,
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!=set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle))
       {
@@ -2298,9 +2574,9 @@ long long ClauseSetStandardWeight(ClauseSet_p set)
    Clause_p  handle;
    long long res = 0;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!=set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       res += ClauseStandardWeight(handle);
    }
@@ -2328,7 +2604,9 @@ void ClauseSetDerivationStackStatistics(ClauseSet_p set)
    PDArray_p dist = PDArrayAlloc(8,8);
    double    sum = 0.0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       if(handle->derivation)
       {
@@ -2368,7 +2646,9 @@ long ClauseSetPushClauses(PStack_p stack, ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       PStackPushP(stack, handle);
       res++;
@@ -2392,7 +2672,9 @@ void ClauseSetDefaultWeighClauses(ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       handle->weight = ClauseStandardWeight(handle);
    }
@@ -2418,9 +2700,9 @@ long ClauseSetCountConjectures(ClauseSet_p set, long* hypos)
    Clause_p handle;
 
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle != set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle))
       {
@@ -2451,9 +2733,9 @@ int ClauseConjectureOrder(ClauseSet_p set)
    int ord = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle != set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       for(Eqn_p lit = handle->literals; lit; lit = lit->next)
       {
@@ -2482,7 +2764,9 @@ bool ClauseSetIsUntyped(ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       if (!ClauseIsUntyped(handle))
       {
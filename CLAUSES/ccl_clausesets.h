@@ -15,6 +15,8 @@
   Run "eprover -h" for contact information.
 
   Created: Sat Jul  5 02:28:25 MET DST 1997
+  Mon Oct 19 04:12:37 CEST 2026: Slot vector members (COMPACT_CLAUSES)
+  Mon Oct 19 04:12:37 CEST 2026: Inline fast path for ClauseSucc()
 
 -----------------------------------------------------------------------*/
 
@@ -27,6 +29,9 @@
 #include <ccl_fcvindexing.h>
 #include <ccl_tautologies.h>
 #include <ccl_pdtrees.h>
+#include <ccl_csrindex.h>
+#include <ccl_groundcc.h>
+#include <ccl_nfcache.h>
 #include <clb_plist.h>
 #include <clb_objtrees.h>
 
@@ -35,7 +40,11 @@
 /*---------------------------------------------------------------------*/
 
 /* Clause sets are doubly linked lists of clauses with indices for the
-   various potential evaluations. */
+   various potential evaluations. With COMPACT_CLAUSES, the list is
+   replaced by a chunked vector of slots. Removing a clause leaves an
+   empty slot, the vector is compacted when more than half of the
+   slots are empty. Traversal via ClauseSucc()/ClausePred() works in
+   both cases, starting and ending at the anchor. */
 
 typedef struct clausesetcell
 {
@@ -48,11 +57,28 @@ typedef struct clausesetcell
           checking for irreducability. */
    PDTree_p  demod_index; /* If used for demodulators */
    FVIAnchor_p fvindex; /* Used for non-unit subsumption */
+   CSRIndex_p csr_index; /* Ground literals, for backward context-SR */
+   GroundCC_p ground_cc; /* Ground units (shared, not owned) */
+   NFCache_p  nf_cache;  /* Demodulator dates (shared, not owned) */
    PDArray_p eval_indices;
    long      eval_no;
    DStr_p     identifier;
+#ifdef COMPACT_CLAUSES
+   PStack_p  slots;    /* Chunks of CLAUSE_SET_CHUNK members in order
+                          of insertion, NULL for removed ones */
+   long      slot_no;  /* Slots in use (the last one is never NULL) */
+   long      first;    /* All slots before this one are NULL */
+#endif
 }ClauseSetCell, *ClauseSet_p;
 
+#define CLAUSE_SET_CHUNK 256
+
+/* Traversal prefetches the member this many slots ahead. The slot
+   vector makes its address known without touching the clauses in
+   between, which hides the cache misses a linked list has to wait
+   for one by one. */
+#define CLAUSE_SET_PREFETCH 8
+
 
 
 /*---------------------------------------------------------------------*/
@@ -73,8 +99,25 @@ typedef struct clausesetcell
 ClauseSet_p ClauseSetAlloc(void);
 void        ClauseSetFreeClauses(ClauseSet_p set);
 #define     ClauseSetCardinality(set) ((set)->members)
+#ifdef COMPACT_CLAUSES
+#define     ClauseSetEmpty(set) ((set)->members == 0)
+#define     ClauseSetSlotNo(set) ((set)->slot_no)
+#define     ClauseSetSlot(set, i)                                       \
+   (((Clause_p*)PStackElementP((set)->slots, (i)/CLAUSE_SET_CHUNK))      \
+    [(i)%CLAUSE_SET_CHUNK])
+Clause_p    ClauseSetScanSucc(Clause_p clause);
+Clause_p    ClauseSetScanPred(Clause_p clause);
+#define     ClauseSetPrefetchSlot(set, i)                               \
+   if((i) < (set)->slot_no && ClauseSetSlot((set), (i)))                \
+   {                                                                    \
+      __builtin_prefetch(&(ClauseSetSlot((set), (i))->set));            \
+   }
+static inline Clause_p ClauseSetMemberSucc(Clause_p clause);
+static inline Clause_p ClauseSetMemberPred(Clause_p clause);
+#else
 #define     ClauseSetEmpty(set)\
             ((set)->anchor->succ == (set)->anchor)
+#endif
 long        ClauseSetStackCardinality(PStack_p stack);
 void        ClauseSetFree(ClauseSet_p junk);
 void        ClauseSetGCMarkTerms(ClauseSet_p set);
@@ -118,6 +161,8 @@ void        ClauseSetSortLiterals(ClauseSet_p set, ComparisonFunctionType cmp_fu
 
 SysDate     ClauseSetListGetMaxDate(ClauseSet_p *demodulators, int
                 limit);
+NFCache_p   ClauseSetListGetNFCache(ClauseSet_p *demodulators, int
+                                    limit, TB_p bank);
 Clause_p    ClauseSetFind(ClauseSet_p set, Clause_p clause);
 Clause_p    ClauseSetFindById(ClauseSet_p set, long ident);
 void        ClauseSetRemoveEvaluations(ClauseSet_p set);
@@ -190,6 +235,71 @@ long         ClauseSetCountConjectures(ClauseSet_p set, long* hypos);
 int          ClauseConjectureOrder(ClauseSet_p set);
 
 bool         ClauseSetIsUntyped(ClauseSet_p set);
+
+
+#ifdef COMPACT_CLAUSES
+/*---------------------------------------------------------------------*/
+/*                Inline Functions                                     */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetMemberSucc()
+//
+//   Return the clause following clause in its set (or the anchor, see
+//   ClauseSetScanSucc()). Only the common case of an occupied next
+//   slot is handled inline.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline Clause_p ClauseSetMemberSucc(Clause_p clause)
+{
+   ClauseSet_p set  = clause->set;
+   long        next = clause->set_pos+1;
+   Clause_p    handle;
+
+   if(next > 0 && next < set->slot_no &&
+      (handle = ClauseSetSlot(set, next)))
+   {
+      ClauseSetPrefetchSlot(set, next+CLAUSE_SET_PREFETCH);
+      return handle;
+   }
+   return ClauseSetScanSucc(clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetMemberPred()
+//
+//   Return the clause preceding clause in its set (or the anchor, see
+//   ClauseSetScanPred()). Only the common case of an occupied
+//   previous slot is handled inline.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline Clause_p ClauseSetMemberPred(Clause_p clause)
+{
+   ClauseSet_p set  = clause->set;
+   long        prev = clause->set_pos-1;
+   Clause_p    handle;
+
+   if(prev >= set->first && (handle = ClauseSetSlot(set, prev)))
+   {
+      return handle;
+   }
+   return ClauseSetScanPred(clause);
+}
+#endif
+
 #endif
 
 /*---------------------------------------------------------------------*/
@@ -28,6 +28,8 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+PERF_CTR_DEFINE(ContextSRTimer);
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -38,6 +40,90 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: csr_index_candidates()
+//
+//   Return the smallest set of clauses in index that contain one of
+//   the ground literals of clause, or NULL if clause has no ground
+//   literals (in which case *ground is false) or one of them occurs
+//   in no clause (in which case *ground is true and nothing can be
+//   subsumed).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static NumBTree_p csr_index_candidates(CSRIndex_p index, Clause_p clause,
+                                       bool *ground)
+{
+   Eqn_p      handle;
+   NumBTree_p res = NULL, cands;
+
+   *ground = false;
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(!CSRIndexLiteral(handle))
+      {
+         continue;
+      }
+      cands = CSRIndexFindLiteral(index, handle);
+      if(!cands)
+      {
+         *ground = true;
+         return NULL;
+      }
+      if(!*ground || NumBTreeSize(cands) < NumBTreeSize(res))
+      {
+         res = cands;
+      }
+      *ground = true;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: csr_index_find_subsumed_clauses()
+//
+//   Find all clauses in set that are subsumed by subsumer (which has
+//   at least one ground literal) with the ground literal index of the
+//   set and push them onto res (in the order of their idents).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes index statistics
+//
+/----------------------------------------------------------------------*/
+
+static void csr_index_find_subsumed_clauses(ClauseSet_p set,
+                                            NumBTree_p cands,
+                                            Clause_p subsumer,
+                                            PStack_p res)
+{
+   BTreeIterCell iter;
+   long          ident;
+   void          *cand;
+
+   if(!cands)
+   {
+      return;
+   }
+   set->csr_index->candidates += NumBTreeSize(cands);
+   NumBTreeIterInit(&iter, cands, LONG_MIN);
+   while(NumBTreeIterNext(&iter, &ident, &cand))
+   {
+      if(ClauseSubsumesClause(subsumer, cand))
+      {
+         set->csr_index->hits++;
+         PStackPushP(res, cand);
+      }
+   }
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -110,9 +196,14 @@ int ClauseContextualSimplifyReflect(ClauseSet_p set, Clause_p clause)
 //   way will be pushed more than once onto the stack! Returns number
 //   of clauses pushed.
 //
+//   If the set has a ground literal index and the clause (with the
+//   literal negated) has a ground literal, only the clauses
+//   containing that literal are candidates, and the feature vector
+//   index is not used.
+//
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Changes index statistics
 //
 /----------------------------------------------------------------------*/
 
@@ -122,19 +213,34 @@ long ClauseSetFindContextSRClauses(ClauseSet_p set, Clause_p clause,
    Eqn_p handle;
    long old_sp = PStackGetSP(res);
    PStack_p lit_stack = ClauseToStack(clause);
+   NumBTree_p cands = NULL;
+   bool ground = false;
 
    assert(clause->weight == ClauseStandardWeight(clause));
 
-
+   PERF_CTR_ENTRY(ContextSRTimer);
    while(!PStackEmpty(lit_stack))
    {
       handle = PStackPopP(lit_stack);
       ClauseFlipLiteralSign(clause, handle);
       ClauseSubsumeOrderSortLits(clause);
-      ClauseSetFindSubsumedClauses(set, clause, res);
+      if(set->csr_index)
+      {
+         cands = csr_index_candidates(set->csr_index, clause, &ground);
+      }
+      if(ground)
+      {
+         set->csr_index->lookups++;
+         csr_index_find_subsumed_clauses(set, cands, clause, res);
+      }
+      else
+      {
+         ClauseSetFindSubsumedClauses(set, clause, res);
+      }
       ClauseFlipLiteralSign(clause, handle);
    }
    PStackFree(lit_stack);
+   PERF_CTR_EXIT(ContextSRTimer);
    return PStackGetSP(res) - old_sp;
 }
 
@@ -43,6 +43,7 @@ Changes
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+PERF_CTR_DECL(ContextSRTimer);
 
 int  ClauseContextualSimplifyReflect(ClauseSet_p set, Clause_p clause);
 long ClauseSetFindContextSRClauses(ClauseSet_p set, Clause_p clause,
@@ -0,0 +1,338 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_csrindex.c
+
+Author: The E developers
+
+Contents
+
+  Ground literal index for backward contextual simplify-reflect.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 17:10:04 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_csrindex.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: csr_lit_keys()
+//
+//   Compute the two keys of a literal (independent of its
+//   orientation).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void csr_lit_keys(Eqn_p lit, long *key1, long *key2)
+{
+   long l = lit->lterm->entry_no, r = lit->rterm->entry_no;
+
+   assert(TermIsShared(lit->lterm) && TermIsShared(lit->rterm));
+
+   *key1 = 2*MIN(l,r)+(EqnIsPositive(lit)?1:0);
+   *key2 = MAX(l,r);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: csr_insert_lit()
+//
+//   Register clause with lit. Return true if the pair is new.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+static bool csr_insert_lit(CSRIndex_p index, Eqn_p lit, Clause_p clause)
+{
+   long  key1, key2;
+   void  **ref;
+   bool  created;
+
+   csr_lit_keys(lit, &key1, &key2);
+   ref = NumBTreeGetRef(index->literals, key1, &created);
+   if(created)
+   {
+      *ref = NumBTreeAlloc();
+   }
+   ref = NumBTreeGetRef(*ref, key2, &created);
+   if(created)
+   {
+      *ref = NumBTreeAlloc();
+   }
+   return NumBTreeStore(*ref, clause->ident, clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: csr_delete_lit()
+//
+//   Remove the pair (lit, clause) from the index, freeing empty
+//   subtrees. Return true if it was present.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+static bool csr_delete_lit(CSRIndex_p index, Eqn_p lit, Clause_p clause)
+{
+   long       key1, key2;
+   void       **ref;
+   NumBTree_p second, leaf;
+
+   csr_lit_keys(lit, &key1, &key2);
+   ref = NumBTreeFindRef(index->literals, key1);
+   if(!ref)
+   {
+      return false;
+   }
+   second = *ref;
+   ref = NumBTreeFindRef(second, key2);
+   if(!ref)
+   {
+      return false;
+   }
+   leaf = *ref;
+   if(!NumBTreeDelete(leaf, clause->ident, NULL))
+   {
+      return false;
+   }
+   if(!NumBTreeSize(leaf))
+   {
+      NumBTreeDelete(second, key2, NULL);
+      NumBTreeFree(leaf);
+      if(!NumBTreeSize(second))
+      {
+         NumBTreeDelete(index->literals, key1, NULL);
+         NumBTreeFree(second);
+      }
+   }
+   return true;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexAlloc()
+//
+//   Allocate an empty index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+CSRIndex_p CSRIndexAlloc(void)
+{
+   CSRIndex_p handle = CSRIndexCellAlloc();
+
+   handle->literals   = NumBTreeAlloc();
+   handle->clauses    = 0;
+   handle->entries    = 0;
+   handle->lookups    = 0;
+   handle->candidates = 0;
+   handle->hits       = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexFree()
+//
+//   Free the index (but not the clauses).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void CSRIndexFree(CSRIndex_p junk)
+{
+   BTreeIterCell outer, inner;
+   long          key;
+   void          *second, *leaf;
+
+   NumBTreeIterInit(&outer, junk->literals, LONG_MIN);
+   while(NumBTreeIterNext(&outer, &key, &second))
+   {
+      NumBTreeIterInit(&inner, second, LONG_MIN);
+      while(NumBTreeIterNext(&inner, &key, &leaf))
+      {
+         NumBTreeFree(leaf);
+      }
+      NumBTreeFree(second);
+   }
+   NumBTreeFree(junk->literals);
+   CSRIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexInsertClause()
+//
+//   Add the ground literals of clause to the index.
+//
+// Global Variables: problemType (via CSRIndexLiteral())
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+void CSRIndexInsertClause(CSRIndex_p index, Clause_p clause)
+{
+   Eqn_p handle;
+   long  old_entries = index->entries;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(CSRIndexLiteral(handle) && csr_insert_lit(index, handle, clause))
+      {
+         index->entries++;
+      }
+   }
+   if(index->entries != old_entries)
+   {
+      index->clauses++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexDeleteClause()
+//
+//   Remove the ground literals of clause from the index. The clause
+//   must not have been changed (except for orientation) since it was
+//   inserted.
+//
+// Global Variables: problemType (via CSRIndexLiteral())
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+void CSRIndexDeleteClause(CSRIndex_p index, Clause_p clause)
+{
+   Eqn_p handle;
+   long  old_entries = index->entries;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(CSRIndexLiteral(handle) && csr_delete_lit(index, handle, clause))
+      {
+         index->entries--;
+      }
+   }
+   if(index->entries != old_entries)
+   {
+      index->clauses--;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexFindLiteral()
+//
+//   Return the tree (ident -> clause) of clauses containing lit (with
+//   either orientation), or NULL if there are none. lit has to be
+//   ground and shared. The tree is valid until the index is changed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+NumBTree_p CSRIndexFindLiteral(CSRIndex_p index, Eqn_p lit)
+{
+   long key1, key2;
+   void **ref;
+
+   assert(CSRIndexLiteral(lit));
+
+   csr_lit_keys(lit, &key1, &key2);
+   ref = NumBTreeFindRef(index->literals, key1);
+   if(!ref)
+   {
+      return NULL;
+   }
+   ref = NumBTreeFindRef(*ref, key2);
+   return ref?*ref:NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSRIndexPrintStatistics()
+//
+//   Print size and usage of the index.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void CSRIndexPrintStatistics(FILE* out, CSRIndex_p index)
+{
+   fprintf(out, "# Context-SR index clauses             : %ld\n",
+           index->clauses);
+   fprintf(out, "# Context-SR index entries             : %ld\n",
+           index->entries);
+   fprintf(out, "# Context-SR index lookups             : %ld\n",
+           index->lookups);
+   fprintf(out, "# ...candidates                        : %ld\n",
+           index->candidates);
+   fprintf(out, "# ...simplifiable                      : %ld\n",
+           index->hits);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
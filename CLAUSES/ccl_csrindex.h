@@ -0,0 +1,87 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_csrindex.h
+
+Author: The E developers
+
+Contents
+
+  Literal index for backward contextual simplify-reflect: Maps each
+  ground literal to the clauses of a set that contain it.
+
+  A clause D can backward contextual-simplify-reflect a clause C with
+  literal L of D if D with L negated subsumes C. If L is ground, C has
+  to contain the negation of L itself, so the candidates can be found
+  with a single lookup instead of a feature vector index traversal.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 17:10:04 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_CSRINDEX
+
+#define CCL_CSRINDEX
+
+#include <clb_btrees.h>
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Literals are identified by the entry numbers of their (shared)
+   sides and their sign. The smaller entry number (and the sign) is
+   the key of the first level, the larger one the key of the second
+   level, so that both orientations of an equation have the same
+   key. The leaves map clause idents to clauses, so that candidates
+   are found in a deterministic order. */
+
+typedef struct csr_index_cell
+{
+   NumBTree_p literals;  /* -> NumBTree_p -> NumBTree_p of clauses */
+   long       clauses;   /* Clauses with at least one indexed literal */
+   long       entries;   /* Indexed (literal, clause) pairs */
+   long       lookups;   /* Queries for ground literals */
+   long       candidates;/* Clauses returned by them */
+   long       hits;      /* ...that were simplifiable */
+}CSRIndexCell, *CSRIndex_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define CSRIndexCellAlloc()    (CSRIndexCell*)SizeMalloc(sizeof(CSRIndexCell))
+#define CSRIndexCellFree(junk) SizeFree(junk, sizeof(CSRIndexCell))
+
+/* Literals that are handled by the index. Higher-order terms may be
+   equal modulo more than identity, so the index is first-order
+   only. */
+#define CSRIndexLiteral(lit) \
+        ((problemType != PROBLEM_HO) && EqnIsGround(lit))
+
+CSRIndex_p CSRIndexAlloc(void);
+void       CSRIndexFree(CSRIndex_p junk);
+
+void       CSRIndexInsertClause(CSRIndex_p index, Clause_p clause);
+void       CSRIndexDeleteClause(CSRIndex_p index, Clause_p clause);
+
+NumBTree_p CSRIndexFindLiteral(CSRIndex_p index, Eqn_p lit);
+
+void       CSRIndexPrintStatistics(FILE* out, CSRIndex_p index);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -88,7 +88,9 @@ char *opids[] =
    PCL_PRIM_ENUM,
    PCL_CHOICE_INST,
    PCL_TRIGGER,
-   PCL_PRUNE_ARG
+   PCL_PRUNE_ARG,
+   /* Restored */
+   PCL_CHECKPOINT
 };
 
 char *optheory [] =
@@ -148,6 +150,8 @@ char *optheory [] =
    NULL,
    NULL,
    NULL,
+   NULL,
+   /* Restored */
    NULL
 };
 
@@ -209,7 +213,9 @@ char *opstatus [] =
    "thm",
    "thm",
    "thm",
-   "thm"
+   "thm",
+   /* Restored */
+   NULL
 };
 
 
@@ -1210,6 +1216,9 @@ void DerivationStackPCLPrint(FILE* out, Sig_p sig, PStack_p derivation)
          case DCIntroDef:
                fprintf(out, "%s", "introduced");
                break;
+         case DCCheckpoint:
+               fprintf(out, "%s", opids[DPOpGetOpCode(op)]);
+               break;
          case DCCnfAddArg:
                PStackPushP(arg_stack, PStackElementP(derivation, i+1));
                break;
@@ -1251,6 +1260,7 @@ void DerivationStackPCLPrint(FILE* out, Sig_p sig, PStack_p derivation)
             case DCFofQuote:
                   break;
             case DCIntroDef:
+            case DCCheckpoint:
                   break;
             case DCACRes:
                   ac_limit = PStackElementInt(derivation, i+1);
@@ -1333,6 +1343,7 @@ void DerivationStackTSTPPrint(FILE* out, Sig_p sig, PStack_p derivation)
          case DCFofQuote:
                break;
          case DCIntroDef:
+         case DCCheckpoint:
                fprintf(out, "%s", opids[DPOpGetOpCode(op)]);
                break;
          case DCCnfAddArg:
@@ -1379,6 +1390,7 @@ void DerivationStackTSTPPrint(FILE* out, Sig_p sig, PStack_p derivation)
             case DCFofQuote:
                   break;
             case DCIntroDef:
+            case DCCheckpoint:
                   break;
             case DCACRes:
                   ac_limit = PStackElementInt(derivation, i+1);
@@ -1438,9 +1450,9 @@ void DerivedPCLPrint(FILE* out, Sig_p sig, Derived_p derived)
       {
          DerivationStackPCLPrint(out, sig, derived->clause->derivation);
       }
-      else if(derived->clause->info)
+      else if(ClauseSourceInfo(derived->clause))
       {
-         ClauseSourceInfoPrintPCL(out, derived->clause->info);
+         ClauseSourceInfoPrintPCL(out, ClauseSourceInfo(derived->clause));
       }
       if(derived->is_root)
       {
@@ -1503,10 +1515,10 @@ void DerivedTSTPPrint(FILE* out, Sig_p sig, Derived_p derived)
       }
       else
       {
-         if(derived->clause->info)
+         if(ClauseSourceInfo(derived->clause))
          {
             fprintf(out, ", ");
-            ClauseSourceInfoPrintTSTP(out, derived->clause->info);
+            ClauseSourceInfoPrintTSTP(out, ClauseSourceInfo(derived->clause));
          }
       }
       if(derived->is_root)
@@ -1684,7 +1696,7 @@ void DerivedDotPrint(FILE* out, Sig_p sig, Derived_p derived,
    {
       id = derived->clause->ident;
       deriv = derived->clause->derivation;
-      info  = derived->clause->info;
+      info  = ClauseSourceInfo(derived->clause);
       if(ClauseIsEvalGC(derived->clause) &&
          ClauseQueryProp(derived->clause,CPIsProcessed))
       {
@@ -99,7 +99,9 @@ typedef enum
    DOPrimEnum,
    DOChoiceInst,
    DOTrigger,
-   DOPruneArg
+   DOPruneArg,
+   /* Clause restored from a saturation checkpoint (no inference) */
+   DOCheckpoint
 }OpCode;
 
 
@@ -173,7 +175,8 @@ typedef enum
    DCPrimEnum         = DOPrimEnum|Arg1Cnf|ArgIsHO,
    DCChoiceInst       = DOChoiceInst|Arg1Cnf|Arg2Cnf|ArgIsHO,
    DCTrigger          = DOTrigger|Arg1Cnf|Arg2Cnf|ArgIsHO,
-   DCPruneArg         = DOPruneArg|ArgIsHO
+   DCPruneArg         = DOPruneArg|ArgIsHO,
+   DCCheckpoint       = DOCheckpoint
 }DerivationCode;
 
 
@@ -394,9 +394,9 @@ void GenDistribAddClauseSet(GenDistrib_p dist,
 {
    Clause_p handle;
 
-   for(handle=set->anchor->succ;
+   for(handle=ClauseSucc(set->anchor);
        handle!=set->anchor;
-       handle=handle->succ)
+       handle=ClauseSucc(handle))
    {
       GenDistribAddClause(dist, handle, factor);
    }
@@ -618,6 +618,27 @@ int FunGenCGCmp(const FunGen_p fg1, const FunGen_p fg2)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GenDistribGenerality()
+//
+//   Return the generality of f_code under gentype.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long GenDistribGenerality(GenDistrib_p generality,
+                          GeneralityMeasure gentype,
+                          FunCode f_code)
+{
+   assert(f_code < generality->size);
+   return extract_generality(&(generality->dist_array[f_code]), gentype);
+}
+
+
 
 
 /*-----------------------------------------------------------------------
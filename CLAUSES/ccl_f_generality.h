@@ -109,6 +109,9 @@ void         GenDistPrint(FILE* out, GenDistrib_p dist);
 
 int          FunGenTGCmp(const FunGen_p fg1, const FunGen_p fg2);
 int          FunGenCGCmp(const FunGen_p fg1, const FunGen_p fg2);
+long         GenDistribGenerality(GenDistrib_p generality,
+                                  GeneralityMeasure gentype,
+                                  FunCode f_code);
 
 void        ClauseComputeDRel(GenDistrib_p generality,
                               GeneralityMeasure gentype,
@@ -211,9 +211,9 @@ void FIndexAddClauseSet(FIndex_p index, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!=set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       FIndexAddClause(index, handle);
    }
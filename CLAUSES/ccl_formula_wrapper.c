@@ -758,8 +758,8 @@ WFormula_p WFormClauseParse(Scanner_p in, TB_p terms)
    wform = WTFormulaAlloc(terms, form);
    wform->is_clause  = true;
    wform->properties = (FormulaProperties)handle->properties;
-   wform->info = handle->info;
-   handle->info = NULL;
+   wform->info = ClauseSourceInfo(handle);
+   ClauseSetSourceInfo(handle, NULL);
    ClauseFree(handle);
 
    //printf("# WFormClauseParse: ");
@@ -787,10 +787,10 @@ Clause_p WFormClauseToClause(WFormula_p form)
    res->properties = form->properties;
    if(form->info)
    {
-      res->info = ClauseInfoAlloc(form->info->name,
-                                  form->info->source,
-                                  form->info->line,
-                                  form->info->column);
+      ClauseSetSourceInfo(res, ClauseInfoAlloc(form->info->name,
+                                               form->info->source,
+                                               form->info->line,
+                                               form->info->column));
    }
    return res;
 }
@@ -1703,17 +1703,13 @@ long FormulaAndClauseSetParse(Scanner_p in, FormulaSet_p fset,
             }
             else
             {
-               printf("Parsing begins\n");
                if(TestInpId(in, "input_formula|fof|tff|thf|tcf"))
                {
                   if(TestInpId(in, "tff|thf|tcf"))
                   {
                      terms->sig->typed_symbols = true;
                   }
-                  printf("It's a formula\n");
                   form = WFormulaParse(in, terms);
-                  fprintf(stdout, "Parsed: ");
-                  WFormulaPrint(stdout, form, true);
                }
                else
                {
@@ -1751,11 +1747,11 @@ long FormulaAndClauseSetParse(Scanner_p in, FormulaSet_p fset,
          }
          form = nextform;
       }
-      clause = wlset->anchor->succ;
+      clause = ClauseSucc(wlset->anchor);
       while(clause != wlset->anchor)
       {
-         nextclause = clause->succ;
-         if(!verify_name(name_selector, clause->info))
+         nextclause = ClauseSucc(clause);
+         if(!verify_name(name_selector, ClauseSourceInfo(clause)))
          {
             ClauseSetDeleteEntry(clause);
          }
@@ -2574,7 +2570,9 @@ void ClauseSetLiftLambdas(ClauseSet_p set, FormulaSet_p archive, TB_p terms,
 
    VarBankSetVCountsToUsed(terms->vars);
 
-   for(Clause_p handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(Clause_p handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       bool cl_changed = false;
       for(Eqn_p lit = handle->literals; lit; lit = lit->next)
@@ -246,8 +246,8 @@ void LitHashInsertClauseSet(LitHash_p hash, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!= set->anchor; handle =
-     handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor; handle =
+     ClauseSucc(handle))
    {
       LitHashInsertClause(hash, handle);
    }
@@ -60,28 +60,34 @@ Changes
 
 long TBGCCollect(TB_p bank)
 {
-   PTree_p entry;
-   PStack_p trav;
+   BTreeIterCell trav;
+   void*         set;
 
    assert(bank);
    assert(bank->gc);
 
    //printf("# GCCollect(%p)\n", gc);
-   trav = PTreeTraverseInit(bank->gc->clause_sets);
-   while((entry = PTreeTraverseNext(trav)))
+   PBTreeIterInit(&trav, bank->gc->clause_sets);
+   while((set = PBTreeIterNext(&trav)))
    {
-      //printf("# Marking clause set %p\n", entry->key);
-      ClauseSetGCMarkTerms(entry->key);
+      //printf("# Marking clause set %p\n", set);
+      ClauseSetGCMarkTerms(set);
    }
-   PTreeTraverseExit(trav);
 
-   trav = PTreeTraverseInit(bank->gc->formula_sets);
-   while((entry = PTreeTraverseNext(trav)))
+   PBTreeIterInit(&trav, bank->gc->formula_sets);
+   while((set = PBTreeIterNext(&trav)))
    {
-      //printf("# Marking formula set %p\n", entry->key);
-      FormulaSetGCMarkCells(entry->key);
+      //printf("# Marking formula set %p\n", set);
+      FormulaSetGCMarkCells(set);
+   }
+
+   /* Caches go last, so that they can tell which of their terms
+      are not used anywhere else */
+   PBTreeIterInit(&trav, bank->gc->nf_caches);
+   while((set = PBTreeIterNext(&trav)))
+   {
+      NFCacheGCMarkTerms(set);
    }
-   PTreeTraverseExit(trav);
 
    return TBGCSweep(bank);
 }
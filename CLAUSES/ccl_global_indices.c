@@ -18,6 +18,8 @@ Changes
 
 <1> Fri May  7 21:19:48 CEST 2010
     New
+<2> Mon Oct 19 03:02:51 CEST 2026
+    Path index for backward rewriting
 
 -----------------------------------------------------------------------*/
 
@@ -63,6 +65,7 @@ PERF_CTR_DEFINE(BWRWIndexTimer);
 void GlobalIndicesNull(GlobalIndices_p indices)
 {
    indices->bw_rw_index   = NULL;
+   indices->bw_rw_paths   = NULL;
    indices->pm_into_index = NULL;
    indices->pm_negp_index = NULL;
    indices->pm_from_index = NULL;
@@ -76,6 +79,10 @@ void GlobalIndicesNull(GlobalIndices_p indices)
 // Function: GlobalIndicesInit()
 //
 //   Initialize the global indices as required by the parameters.
+//   The backward rewriting index PATH_INDEX_NAME is a path index
+//   that retrieves the candidate terms, combined with an FP0 index
+//   that only maps them to their occurrences. As path indexing is
+//   first-order only, FP7 is used instead for higher-order problems.
 //
 // Global Variables: -
 //
@@ -95,7 +102,20 @@ void GlobalIndicesInit(GlobalIndices_p indices,
    // fprintf(GlobalOut, "# GlobalIndicesInit(%p, <>, %s, %s, %s)\n", indices, rw_bw_index_type, pm_from_index_type, pm_into_index_type);
 
    indices->sig = sig;
+   indices->bw_rw_paths = NULL;
    indexfun = GetFPIndexFunction(rw_bw_index_type);
+   if(strcmp(rw_bw_index_type, PATH_INDEX_NAME)==0)
+   {
+      if(problemType == PROBLEM_HO)
+      {
+         indexfun = IndexFP7Create;
+      }
+      else
+      {
+         indexfun = IndexFP0Create;
+         indices->bw_rw_paths = PathIndexAlloc();
+      }
+   }
    strcpy(indices->rw_bw_index_type, rw_bw_index_type);
    if(indexfun)
    {
@@ -149,6 +169,11 @@ void GlobalIndicesFreeIndices(GlobalIndices_p indices)
       FPIndexFree(indices->bw_rw_index);
       indices->bw_rw_index = NULL;
    }
+   if(indices->bw_rw_paths)
+   {
+      PathIndexFree(indices->bw_rw_paths);
+      indices->bw_rw_paths = NULL;
+   }
    if(indices->pm_from_index)
    {
       FPIndexFree(indices->pm_from_index);
@@ -225,7 +250,8 @@ void GlobalIndicesInsertClause(GlobalIndices_p indices, Clause_p clause,
    if(indices->bw_rw_index)
    {
       PERF_CTR_ENTRY(BWRWIndexTimer);
-      SubtermIndexInsertClause(indices->bw_rw_index, clause, lambda_demod);
+      SubtermIndexInsertClause(indices->bw_rw_index, indices->bw_rw_paths,
+                               clause, lambda_demod);
       PERF_CTR_EXIT(BWRWIndexTimer);
    }
 
@@ -277,7 +303,8 @@ void GlobalIndicesDeleteClause(GlobalIndices_p indices, Clause_p clause, bool la
    if(indices->bw_rw_index)
    {
       PERF_CTR_ENTRY(BWRWIndexTimer);
-      SubtermIndexDeleteClause(indices->bw_rw_index, clause, lambda_demod);
+      SubtermIndexDeleteClause(indices->bw_rw_index, indices->bw_rw_paths,
+                               clause, lambda_demod);
       PERF_CTR_EXIT(BWRWIndexTimer);
    }
 
@@ -330,7 +357,9 @@ void GlobalIndicesInsertClauseSet(GlobalIndices_p indices,
    {
       return;
    }
-   for(handle=set->anchor->succ; handle!=set->anchor; handle=handle->succ)
+   for(handle=ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle=ClauseSucc(handle))
    {
       GlobalIndicesInsertClause(indices, handle, lambda_demod);
    }
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri May  7 21:13:39 CEST 2010
     New
+<2> Mon Oct 19 03:02:51 CEST 2026
+    Path index for backward rewriting
 
 -----------------------------------------------------------------------*/
 
@@ -44,6 +46,7 @@ typedef struct global_indices_cell
    char              pm_negp_index_type[MAX_PM_INDEX_NAME_LEN];
    Sig_p             sig;
    SubtermIndex_p    bw_rw_index;
+   PathIndex_p       bw_rw_paths;  /* Only with PATH_INDEX_NAME */
    OverlapIndex_p    pm_from_index;
    OverlapIndex_p    pm_into_index;
    OverlapIndex_p    pm_negp_index;
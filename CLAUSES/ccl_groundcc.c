@@ -0,0 +1,1039 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_groundcc.c
+
+Author: The E developers
+
+Contents
+
+  Proof-producing congruence closure for ground unit equations.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 18:02:37 CEST 2026
+    New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Detect garbage collection via bank->gc_sweeps
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_groundcc.h"
+#include <ccl_clausefunc.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define GCC_INIT_NODES  256
+#define GCC_INIT_TABLE  256
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+static long gcc_node(GroundCC_p cc, Term_p t);
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_find()
+//
+//   Return the representative of the class of node i (with path
+//   halving).
+//
+// Global Variables: -
+//
+// Side Effects    : Compresses paths
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_find(GroundCC_p cc, long i)
+{
+   GCCNodeCell *nodes = cc->nodes;
+
+   while(nodes[i].find != i)
+   {
+      nodes[i].find = nodes[nodes[i].find].find;
+      i = nodes[i].find;
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_arg_node()
+//
+//   Return the node of the argument arg of the term of node i (which
+//   has been created before node i).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_arg_node(GroundCC_p cc, long i, int arg)
+{
+   Term_p t = cc->nodes[i].term->args[arg];
+
+   assert(PDArrayElementInt(cc->term_nodes, t->entry_no));
+   return PDArrayElementInt(cc->term_nodes, t->entry_no)-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_hash()
+//
+//   Return the bucket for the signature (top symbol and classes of
+//   the arguments) of node i.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_sig_hash(GroundCC_p cc, long i)
+{
+   Term_p        t = cc->nodes[i].term;
+   unsigned long hash = t->f_code;
+   int           j;
+
+   for(j=0; j<t->arity; j++)
+   {
+      hash = hash*31+gcc_find(cc, gcc_arg_node(cc, i, j));
+   }
+   hash ^= hash>>17;
+   return hash&(cc->table_size-1);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_equal()
+//
+//   Return true if nodes i and j have the same signature.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool gcc_sig_equal(GroundCC_p cc, long i, long j)
+{
+   Term_p s = cc->nodes[i].term, t = cc->nodes[j].term;
+   int    k;
+
+   if(s->f_code != t->f_code)
+   {
+      return false;
+   }
+   assert(s->arity == t->arity);
+   for(k=0; k<s->arity; k++)
+   {
+      if(gcc_find(cc, gcc_arg_node(cc, i, k)) !=
+         gcc_find(cc, gcc_arg_node(cc, j, k)))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_table_find()
+//
+//   Return a node in the signature table with the same signature as
+//   node i, or -1.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_table_find(GroundCC_p cc, long i)
+{
+   long j;
+
+   for(j = cc->table[gcc_sig_hash(cc, i)]; j!=-1; j = cc->nodes[j].sig_next)
+   {
+      if(gcc_sig_equal(cc, i, j))
+      {
+         return j;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_table_insert()
+//
+//   Insert node i into the signature table, growing it if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes table
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_table_insert(GroundCC_p cc, long i)
+{
+   long bucket, j;
+
+   assert(!cc->nodes[i].in_table);
+
+   if(cc->table_entries >= 2*cc->table_size)
+   {
+      FREE(cc->table);
+      cc->table_size *= 2;
+      cc->table = SecureMalloc(cc->table_size*sizeof(long));
+      for(j=0; j<cc->table_size; j++)
+      {
+         cc->table[j] = -1;
+      }
+      for(j=0; j<cc->node_no; j++)
+      {
+         if(cc->nodes[j].in_table)
+         {
+            bucket = gcc_sig_hash(cc, j);
+            cc->nodes[j].sig_next = cc->table[bucket];
+            cc->table[bucket] = j;
+         }
+      }
+   }
+   bucket = gcc_sig_hash(cc, i);
+   cc->nodes[i].sig_next = cc->table[bucket];
+   cc->nodes[i].in_table = true;
+   cc->table[bucket] = i;
+   cc->table_entries++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_table_remove()
+//
+//   Remove node i from the signature table. Its signature has to be
+//   the same as when it was inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes table
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_table_remove(GroundCC_p cc, long i)
+{
+   long *ref;
+
+   assert(cc->nodes[i].in_table);
+
+   for(ref = &(cc->table[gcc_sig_hash(cc, i)]);
+       *ref != i;
+       ref = &(cc->nodes[*ref].sig_next))
+   {
+      assert(*ref != -1);
+   }
+   *ref = cc->nodes[i].sig_next;
+   cc->nodes[i].in_table = false;
+   cc->table_entries--;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_proof_reroot()
+//
+//   Reverse the proof forest edges on the path from node i to its
+//   root, so that i becomes the root of its proof tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes proof forest
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_proof_reroot(GroundCC_p cc, long i)
+{
+   long     prev = -1, next;
+   Clause_p prev_reason = NULL, next_reason;
+
+   while(i != -1)
+   {
+      next        = cc->nodes[i].proof;
+      next_reason = cc->nodes[i].reason;
+      cc->nodes[i].proof  = prev;
+      cc->nodes[i].reason = prev_reason;
+      prev        = i;
+      prev_reason = next_reason;
+      i           = next;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_push_merge()
+//
+//   Schedule the merge of nodes i and j because of reason (NULL for
+//   congruence).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes pending
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_push_merge(GroundCC_p cc, long i, long j, Clause_p reason)
+{
+   PStackPushInt(cc->pending, i);
+   PStackPushInt(cc->pending, j);
+   PStackPushP(cc->pending, reason);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_propagate()
+//
+//   Perform all pending merges and the merges of congruent terms
+//   that result from them.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_propagate(GroundCC_p cc)
+{
+   long          i, j, ri, rj, p, q;
+   Clause_p      reason;
+   PStack_p      uses;
+   PStackPointer k;
+
+   while(!PStackEmpty(cc->pending))
+   {
+      reason = PStackPopP(cc->pending);
+      j      = PStackPopInt(cc->pending);
+      i      = PStackPopInt(cc->pending);
+      ri     = gcc_find(cc, i);
+      rj     = gcc_find(cc, j);
+      if(ri == rj)
+      {
+         continue;
+      }
+      cc->merges++;
+      gcc_proof_reroot(cc, i);
+      cc->nodes[i].proof  = j;
+      cc->nodes[i].reason = reason;
+
+      if(cc->nodes[ri].size > cc->nodes[rj].size)
+      {
+         SWAP(ri, rj);
+      }
+      /* Merge class ri into rj. The signatures of all terms with an
+         argument in ri change. */
+      uses = cc->nodes[ri].uses;
+      cc->nodes[ri].uses = NULL;
+      if(uses)
+      {
+         for(k=0; k<PStackGetSP(uses); k++)
+         {
+            p = PStackElementInt(uses, k);
+            if(cc->nodes[p].in_table)
+            {
+               gcc_table_remove(cc, p);
+            }
+         }
+      }
+      cc->nodes[ri].find = rj;
+      cc->nodes[rj].size += cc->nodes[ri].size;
+      if(uses)
+      {
+         if(!cc->nodes[rj].uses)
+         {
+            cc->nodes[rj].uses = PStackAlloc();
+         }
+         for(k=0; k<PStackGetSP(uses); k++)
+         {
+            p = PStackElementInt(uses, k);
+            if(!cc->nodes[p].in_table)
+            {
+               q = gcc_table_find(cc, p);
+               if(q == -1)
+               {
+                  gcc_table_insert(cc, p);
+               }
+               else
+               {
+                  gcc_push_merge(cc, p, q, NULL);
+               }
+            }
+            PStackPushInt(cc->nodes[rj].uses, p);
+         }
+         PStackFree(uses);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_new_node()
+//
+//   Create the node for t, whose arguments already have nodes.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_new_node(GroundCC_p cc, Term_p t)
+{
+   long      i = cc->node_no, r, q;
+   int       j;
+   GCCNode_p node;
+
+   if(cc->node_no == cc->node_size)
+   {
+      cc->node_size *= 2;
+      cc->nodes = SecureRealloc(cc->nodes,
+                                cc->node_size*sizeof(GCCNodeCell));
+   }
+   cc->node_no++;
+   node = &(cc->nodes[i]);
+   node->term      = t;
+   node->entry_no  = t->entry_no;
+   node->find      = i;
+   node->size      = 1;
+   node->uses      = NULL;
+   node->sig_next  = -1;
+   node->in_table  = false;
+   node->proof     = -1;
+   node->reason    = NULL;
+   node->epoch     = 0;
+   node->explained = 0;
+   PDArrayAssignInt(cc->term_nodes, t->entry_no, i+1);
+
+   for(j=0; j<t->arity; j++)
+   {
+      r = gcc_find(cc, gcc_arg_node(cc, i, j));
+      if(!cc->nodes[r].uses)
+      {
+         cc->nodes[r].uses = PStackAlloc();
+      }
+      PStackPushInt(cc->nodes[r].uses, i);
+   }
+   if(t->arity)
+   {
+      q = gcc_table_find(cc, i);
+      if(q == -1)
+      {
+         gcc_table_insert(cc, i);
+      }
+      else
+      {
+         gcc_push_merge(cc, i, q, NULL);
+         gcc_propagate(cc);
+      }
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_node()
+//
+//   Return the node for t, creating it (and the nodes of its
+//   subterms) if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_node(GroundCC_p cc, Term_p t)
+{
+   long i = PDArrayElementInt(cc->term_nodes, t->entry_no);
+   int  j;
+
+   assert(TermIsShared(t));
+   assert(TBTermIsGround(t));
+
+   if(i)
+   {
+      assert(cc->nodes[i-1].term == t);
+      return i-1;
+   }
+   for(j=0; j<t->arity; j++)
+   {
+      gcc_node(cc, t->args[j]);
+   }
+   return gcc_new_node(cc, t);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_add_unit()
+//
+//   Merge the classes of both sides of unit.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_add_unit(GroundCC_p cc, Clause_p unit)
+{
+   long i = gcc_node(cc, unit->literals->lterm);
+   long j = gcc_node(cc, unit->literals->rterm);
+
+   gcc_push_merge(cc, i, j, unit);
+   gcc_propagate(cc);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_reset()
+//
+//   Remove all nodes from the closure. Does not look at the terms,
+//   which may have been freed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_reset(GroundCC_p cc)
+{
+   long i;
+
+   for(i=0; i<cc->node_no; i++)
+   {
+      PDArrayAssignInt(cc->term_nodes, cc->nodes[i].entry_no, 0);
+      if(cc->nodes[i].uses)
+      {
+         PStackFree(cc->nodes[i].uses);
+      }
+   }
+   cc->node_no = 0;
+   for(i=0; i<cc->table_size; i++)
+   {
+      cc->table[i] = -1;
+   }
+   cc->table_entries = 0;
+   PStackReset(cc->pending);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_update()
+//
+//   Rebuild the closure from the registered units if it is outdated,
+//   or if the term bank has been garbage collected since the nodes
+//   were created (as they hold references to otherwise unreferenced
+//   terms).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_update(GroundCC_p cc)
+{
+   BTreeIterCell iter;
+   long          ident;
+   void          *unit;
+
+   if(cc->gc_sweeps != cc->bank->gc_sweeps)
+   {
+      cc->outdated = true;
+   }
+   if(!cc->outdated)
+   {
+      return;
+   }
+   gcc_reset(cc);
+   cc->gc_sweeps = cc->bank->gc_sweeps;
+   NumBTreeIterInit(&iter, cc->units, LONG_MIN);
+   while(NumBTreeIterNext(&iter, &ident, &unit))
+   {
+      gcc_add_unit(cc, unit);
+   }
+   cc->outdated = false;
+   cc->rebuilds++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_nca()
+//
+//   Return the nearest common ancestor of i and j in the proof
+//   forest.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes node epochs
+//
+/----------------------------------------------------------------------*/
+
+static long gcc_nca(GroundCC_p cc, long i, long j)
+{
+   long epoch = ++(cc->epoch);
+
+   for(; i!=-1; i = cc->nodes[i].proof)
+   {
+      cc->nodes[i].epoch = epoch;
+   }
+   for(; cc->nodes[j].epoch != epoch; j = cc->nodes[j].proof)
+   {
+      assert(cc->nodes[j].proof != -1);
+   }
+   return j;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_explain_path()
+//
+//   Collect the reasons of the proof edges from i up to ancestor
+//   into units (without duplicates, using seen), and push the
+//   argument pairs of congruence edges onto todo. Edges already
+//   explained in this epoch are skipped.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the stacks
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_explain_path(GroundCC_p cc, long i, long ancestor,
+                             long epoch, PStack_p todo, PTree_p *seen,
+                             PStack_p units)
+{
+   long j;
+   int  k;
+
+   for(; i!=ancestor; i = j)
+   {
+      j = cc->nodes[i].proof;
+      if(cc->nodes[i].explained == epoch)
+      {
+         continue;
+      }
+      cc->nodes[i].explained = epoch;
+      if(cc->nodes[i].reason)
+      {
+         if(PTreeStore(seen, cc->nodes[i].reason))
+         {
+            PStackPushP(units, cc->nodes[i].reason);
+         }
+      }
+      else
+      {
+         for(k=0; k<cc->nodes[i].term->arity; k++)
+         {
+            PStackPushInt(todo, gcc_arg_node(cc, i, k));
+            PStackPushInt(todo, gcc_arg_node(cc, j, k));
+         }
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_lit_greater()
+//
+//   Return true if the (ground) literal s=t is certainly greater than
+//   the literal u=v of the same sign, i.e. if {s,t} is greater than
+//   {u,v} in the multiset extension of the term ordering.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool gcc_lit_greater(OCB_p ocb, Term_p s, Term_p t, Term_p u,
+                            Term_p v)
+{
+   CompareResult cmp;
+
+   cmp = TOCompare(ocb, s, t, DEREF_NEVER, DEREF_NEVER);
+   if(cmp == to_uncomparable)
+   {
+      return false;
+   }
+   if(cmp == to_lesser)
+   {
+      SWAP(s, t);
+   }
+   cmp = TOCompare(ocb, u, v, DEREF_NEVER, DEREF_NEVER);
+   if(cmp == to_uncomparable)
+   {
+      return false;
+   }
+   if(cmp == to_lesser)
+   {
+      SWAP(u, v);
+   }
+   if(s != u)
+   {
+      return TOGreater(ocb, s, u, DEREF_NEVER, DEREF_NEVER);
+   }
+   return t != v && TOGreater(ocb, t, v, DEREF_NEVER, DEREF_NEVER);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAlloc()
+//
+//   Allocate an empty closure for terms from bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+GroundCC_p GroundCCAlloc(TB_p bank)
+{
+   GroundCC_p handle = GroundCCCellAlloc();
+   long       i;
+
+   handle->units         = NumBTreeAlloc();
+   handle->outdated      = false;
+   handle->bank          = bank;
+   handle->gc_sweeps     = bank->gc_sweeps;
+   handle->term_nodes    = PDIntArrayAlloc(GCC_INIT_NODES, 0);
+   handle->node_no       = 0;
+   handle->node_size     = GCC_INIT_NODES;
+   handle->nodes         = SecureMalloc(handle->node_size*sizeof(GCCNodeCell));
+   handle->table_size    = GCC_INIT_TABLE;
+   handle->table_entries = 0;
+   handle->table         = SecureMalloc(handle->table_size*sizeof(long));
+   handle->pending       = PStackAlloc();
+   handle->epoch         = 0;
+
+   handle->merges           = 0;
+   handle->rebuilds         = 0;
+   handle->queries          = 0;
+   handle->equal_queries    = 0;
+   handle->literals_removed = 0;
+   handle->clauses_removed  = 0;
+
+   for(i=0; i<handle->table_size; i++)
+   {
+      handle->table[i] = -1;
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCFree()
+//
+//   Free the closure (but not the units).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCFree(GroundCC_p junk)
+{
+   gcc_reset(junk);
+   NumBTreeFree(junk->units);
+   PDArrayFree(junk->term_nodes);
+   FREE(junk->nodes);
+   FREE(junk->table);
+   PStackFree(junk->pending);
+   GroundCCCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAddUnit()
+//
+//   Register a ground positive unit clause (with shared terms) and
+//   merge the classes of its sides, unless the closure will be
+//   rebuilt anyway.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCAddUnit(GroundCC_p cc, Clause_p unit)
+{
+   assert(GroundCCUnit(unit));
+
+   if(NumBTreeStore(cc->units, unit->ident, unit) && !cc->outdated &&
+      cc->gc_sweeps == cc->bank->gc_sweeps)
+   {
+      gcc_add_unit(cc, unit);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCRemoveUnit()
+//
+//   Unregister unit (if it is registered). The closure will be
+//   rebuilt before it is used again.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the closure
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCRemoveUnit(GroundCC_p cc, Clause_p unit)
+{
+   if(NumBTreeDelete(cc->units, unit->ident, NULL))
+   {
+      cc->outdated = true;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCEqual()
+//
+//   Return true if the ground, shared terms s and t are equal under
+//   the registered units.
+//
+// Global Variables: -
+//
+// Side Effects    : Adds s and t to the closure
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCEqual(GroundCC_p cc, Term_p s, Term_p t)
+{
+   long i, j;
+
+   cc->queries++;
+   if(s == t)
+   {
+      cc->equal_queries++;
+      return true;
+   }
+   gcc_update(cc);
+   i = gcc_node(cc, s);
+   j = gcc_node(cc, t);
+   if(gcc_find(cc, i) == gcc_find(cc, j))
+   {
+      cc->equal_queries++;
+      return true;
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCExplain()
+//
+//   Push the units needed to show that s and t are equal onto units.
+//   GroundCCEqual(cc, s, t) has to be true, and the closure must
+//   not have changed since.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes node epochs
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCExplain(GroundCC_p cc, Term_p s, Term_p t, PStack_p units)
+{
+   PStack_p todo = PStackAlloc();
+   PTree_p  seen = NULL;
+   long     epoch = ++(cc->epoch);
+   long     i, j, ancestor;
+
+   assert(!cc->outdated);
+
+   if(s != t)
+   {
+      PStackPushInt(todo, gcc_node(cc, s));
+      PStackPushInt(todo, gcc_node(cc, t));
+   }
+   while(!PStackEmpty(todo))
+   {
+      j = PStackPopInt(todo);
+      i = PStackPopInt(todo);
+      if(i == j)
+      {
+         continue;
+      }
+      assert(gcc_find(cc, i) == gcc_find(cc, j));
+      ancestor = gcc_nca(cc, i, j);
+      gcc_explain_path(cc, i, ancestor, epoch, todo, &seen, units);
+      gcc_explain_path(cc, j, ancestor, epoch, todo, &seen, units);
+   }
+   PTreeFree(seen);
+   PStackFree(todo);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCSimplifyClause()
+//
+//   Remove all ground negative literals s!=t with s and t equal under
+//   the units from clause. Return true if clause has a ground
+//   positive literal s=t with s and t equal under units that are all
+//   smaller than the literal, i.e. if it is redundant.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause, adds terms to the closure
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCSimplifyClause(GroundCC_p cc, OCB_p ocb, Clause_p clause)
+{
+   Eqn_p         *handle = &(clause->literals), lit;
+   PStack_p      units;
+   PStackPointer i;
+   Clause_p      unit;
+   bool          redundant = false;
+
+   if(!NumBTreeSize(cc->units))
+   {
+      return false;
+   }
+   units = PStackAlloc();
+   while(*handle)
+   {
+      lit = *handle;
+      if(!EqnIsGround(lit) || lit->lterm == lit->rterm ||
+         !GroundCCEqual(cc, lit->lterm, lit->rterm))
+      {
+         handle = &(lit->next);
+         continue;
+      }
+      PStackReset(units);
+      GroundCCExplain(cc, lit->lterm, lit->rterm, units);
+      if(EqnIsPositive(lit))
+      {
+         for(i=0; i<PStackGetSP(units); i++)
+         {
+            unit = PStackElementP(units, i);
+            if(!gcc_lit_greater(ocb, lit->lterm, lit->rterm,
+                                unit->literals->lterm,
+                                unit->literals->rterm))
+            {
+               break;
+            }
+         }
+         if(i == PStackGetSP(units))
+         {
+            cc->clauses_removed++;
+            redundant = true;
+            break;
+         }
+         handle = &(lit->next);
+         continue;
+      }
+      ClauseRemoveLiteralRef(clause, handle);
+      ClauseDelProp(clause, CPInitial|CPLimitedRW);
+      for(i=0; i<PStackGetSP(units); i++)
+      {
+         unit = PStackElementP(units, i);
+         if(ClauseQueryProp(unit, CPIsSOS))
+         {
+            ClauseSetProp(clause, CPIsSOS);
+         }
+         DocClauseModificationDefault(clause, inf_simplify_reflect, unit);
+         ClausePushDerivation(clause, DCSR, unit, NULL);
+      }
+      cc->literals_removed++;
+   }
+   PStackFree(units);
+   return redundant;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCPrintStatistics()
+//
+//   Print size and usage of the closure.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCPrintStatistics(FILE* out, GroundCC_p cc)
+{
+   fprintf(out, "# Ground CC units                      : %ld\n",
+           NumBTreeSize(cc->units));
+   fprintf(out, "# Ground CC nodes                      : %ld\n",
+           cc->node_no);
+   fprintf(out, "# Ground CC merges                     : %ld\n",
+           cc->merges);
+   fprintf(out, "# Ground CC rebuilds                   : %ld\n",
+           cc->rebuilds);
+   fprintf(out, "# Ground CC equality queries           : %ld\n",
+           cc->queries);
+   fprintf(out, "# ...equal                             : %ld\n",
+           cc->equal_queries);
+   fprintf(out, "# Ground CC simplified literals        : %ld\n",
+           cc->literals_removed);
+   fprintf(out, "# Ground CC redundant clauses          : %ld\n",
+           cc->clauses_removed);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,132 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_groundcc.h
+
+Author: The E developers
+
+Contents
+
+  Congruence closure over the ground positive unit clauses of a proof
+  state: Each (shared) ground term that occurs in one of the units or
+  has been queried is a node, and nodes are partitioned into classes
+  of terms that are equal under the units. Equality of two ground
+  terms under the units can then be decided with two find operations
+  after the terms have been added.
+
+  The closure records why two nodes have been merged (a unit or a
+  congruence step) in a proof forest, so that the units needed to
+  show an equality can be extracted (Nieuwenhuis/Oliveras,
+  "Proof-producing Congruence Closure", RTA 2005). They are the
+  parents of simplification steps.
+
+  All terms have to be from the same term bank (the entry numbers
+  identify them). The closure is rebuilt after unused terms of the
+  bank have been garbage collected, which it detects by comparing
+  bank->gc_sweeps.
+
+  Removing a unit cannot be done incrementally. It only marks the
+  closure as outdated, and it is rebuilt from the remaining units
+  when it is used the next time.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 18:02:37 CEST 2026
+    New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Detect garbage collection via bank->gc_sweeps
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_GROUNDCC
+
+#define CCL_GROUNDCC
+
+#include <clb_btrees.h>
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* One term. find, size and uses are only meaningful for the
+   representative of a class. */
+
+typedef struct gcc_node_cell
+{
+   Term_p   term;
+   long     entry_no;  /* Of term, kept for cleanup after GC */
+   long     find;      /* Union-find parent */
+   long     size;      /* Number of nodes in the class */
+   PStack_p uses;      /* Nodes with an argument in the class */
+   long     sig_next;  /* Next node in signature table bucket */
+   bool     in_table;  /* Node represents its signature */
+   long     proof;     /* Proof forest parent, -1 for roots */
+   Clause_p reason;    /* Unit for the proof edge, NULL for congruence */
+   long     epoch;     /* Last NCA walk */
+   long     explained; /* Last explanation that used the proof edge */
+}GCCNodeCell, *GCCNode_p;
+
+typedef struct ground_cc_cell
+{
+   NumBTree_p  units;      /* ident -> registered unit clause */
+   bool        outdated;   /* Units have been removed */
+   TB_p        bank;       /* Of all node terms */
+   unsigned long gc_sweeps; /* Of bank when the nodes were built */
+   PDArray_p   term_nodes; /* entry_no -> node index+1 */
+   long        node_no;
+   long        node_size;
+   GCCNodeCell *nodes;
+   long        table_size; /* Signature table, power of 2 */
+   long        table_entries;
+   long        *table;     /* Bucket heads, -1 for empty */
+   PStack_p    pending;    /* Merges to perform (triples) */
+   long        epoch;
+   /* Statistics */
+   long        merges;
+   long        rebuilds;
+   long        queries;
+   long        equal_queries;
+   long        literals_removed;
+   long        clauses_removed;
+}GroundCCCell, *GroundCC_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define GroundCCCellAlloc()    (GroundCCCell*)SizeMalloc(sizeof(GroundCCCell))
+#define GroundCCCellFree(junk) SizeFree(junk, sizeof(GroundCCCell))
+
+/* Units handled by the closure */
+#define GroundCCUnit(clause)                                    \
+        (ClauseIsUnit(clause) && EqnIsPositive((clause)->literals) &&  \
+         EqnIsGround((clause)->literals))
+
+GroundCC_p GroundCCAlloc(TB_p bank);
+void       GroundCCFree(GroundCC_p junk);
+
+void       GroundCCAddUnit(GroundCC_p cc, Clause_p unit);
+void       GroundCCRemoveUnit(GroundCC_p cc, Clause_p unit);
+
+bool       GroundCCEqual(GroundCC_p cc, Term_p s, Term_p t);
+void       GroundCCExplain(GroundCC_p cc, Term_p s, Term_p t,
+                           PStack_p units);
+
+bool       GroundCCSimplifyClause(GroundCC_p cc, OCB_p ocb,
+                                  Clause_p clause);
+
+void       GroundCCPrintStatistics(FILE* out, GroundCC_p cc);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
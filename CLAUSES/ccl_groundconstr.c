@@ -301,8 +301,8 @@ void LitOccAddClauseSetAlt(LitOccTable_p p_table, LitOccTable_p
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!= set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor; handle =
+          ClauseSucc(handle))
    {
       LitOccAddClauseAlt(p_table, n_table, handle);
    }
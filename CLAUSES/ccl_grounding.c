@@ -20,6 +20,8 @@
   Changes
 
   Created:  Tue May 29 02:25:12 CEST 2001
+  Mon Oct 19 01:32:08 CEST 2026: Parallel grounding with streamed
+  DIMACS output
 
   -----------------------------------------------------------------------*/
 
@@ -231,6 +233,278 @@ void ground_set_print_unit(FILE* out, GroundSet_p set, long unit, bool
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_preinsert()
+//
+//   Insert all ground instances of the literals of clause (as
+//   described by inst) into bank. Instances of the clause then only
+//   consist of atoms that already exist, so that forked workers
+//   assign the same (propositional) numbers to them.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void ground_stream_preinsert(TB_p bank, Clause_p clause,
+                                    VarSetInst_p inst)
+{
+   VarSetInstCell sub;
+   Eqn_p          handle, copy;
+   Term_p         var;
+   long           i;
+
+   if(!inst->size)
+   {
+      return;
+   }
+   sub.cells = SizeMalloc(inst->size*sizeof(VarInstCell));
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      sub.size = 0;
+      for(i=0; i<inst->size; i++)
+      {
+         var = inst->cells[i].variable;
+         if(TBTermIsSubterm(handle->lterm, var) ||
+            TBTermIsSubterm(handle->rterm, var))
+         {
+            sub.cells[sub.size++] = inst->cells[i];
+         }
+      }
+      if(!varsetinstinitialize(&sub))
+      {
+         continue;
+      }
+      do
+      {
+         varsetinstapply(&sub);
+         copy = EqnCopy(handle, bank);
+         EqnFree(copy);
+      }while(varsetinstnext(&sub));
+      varsetinstclear(&sub);
+   }
+   SizeFree(sub.cells, inst->size*sizeof(VarInstCell));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_emit()
+//
+//   Print a simplified ground clause in DIMACS format and account for
+//   it in stats. Units are also added to units (and not printed if
+//   already present there).
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes units, frees clause
+//
+/----------------------------------------------------------------------*/
+
+static void ground_stream_emit(FILE* out, GroundSet_p units,
+                               Clause_p clause, GroundStreamStats_p stats)
+{
+   long lit;
+   bool positive;
+
+   if(ClauseIsUnit(clause))
+   {
+      lit      = EqnLitCode(clause->literals);
+      positive = EqnIsPositive(clause->literals);
+      if(GroundSetInsert(units, clause))
+      {
+         fprintf(out, positive?"  %ld 0\n":" -%ld 0\n", lit);
+         stats->clauses++;
+         stats->literals++;
+         stats->max_var = MAX(stats->max_var, lit);
+      }
+   }
+   else
+   {
+      stats->clauses++;
+      stats->literals += ClauseLiteralNumber(clause);
+      stats->max_var = MAX(stats->max_var, clause_get_max_lit(clause));
+      ClausePrintDimacs(out, clause);
+      ClauseFree(clause);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_chunk_close()
+//
+//   Terminate a chunk with its statistics record.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void ground_stream_chunk_close(FILE* chunk, GroundStreamStats_p stats)
+{
+   if(fwrite(stats, sizeof(GroundStreamStatsCell), 1, chunk) != 1 ||
+      fflush(chunk) != 0)
+   {
+      TmpErrno = errno;
+      SysError("Cannot write grounding chunk", FILE_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_chunk_stats()
+//
+//   Read the statistics record of a chunk into stats, return the
+//   size of the DIMACS text in front of it.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static long ground_stream_chunk_stats(FILE* chunk, GroundStreamStats_p stats)
+{
+   long size = -1;
+
+   if(fseek(chunk, 0, SEEK_END) == 0)
+   {
+      size = ftell(chunk)-(long)sizeof(GroundStreamStatsCell);
+   }
+   if(size < 0 ||
+      fseek(chunk, size, SEEK_SET) != 0 ||
+      fread(stats, sizeof(GroundStreamStatsCell), 1, chunk) != 1)
+   {
+      Error("Grounding chunk is incomplete", OTHER_ERROR);
+   }
+   return size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_chunk_copy()
+//
+//   Copy the first size bytes of chunk to out.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, output
+//
+/----------------------------------------------------------------------*/
+
+static void ground_stream_chunk_copy(FILE* out, FILE* chunk, long size)
+{
+   char   buf[8192];
+   size_t todo;
+
+   rewind(chunk);
+   while(size)
+   {
+      todo = MIN(size, (long)sizeof(buf));
+      if(fread(buf, 1, todo, chunk) != todo)
+      {
+         Error("Grounding chunk is incomplete", OTHER_ERROR);
+      }
+      fwrite(buf, 1, todo, out);
+      size -= todo;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ground_stream_worker()
+//
+//   ForkMapLong() callback: Create the idx-th share (every
+//   workers-th instance) of the ground instances of the non-unit
+//   clauses, simplify them with the known units (including the ones
+//   found by this worker) and write them to the idx-th chunk. Return
+//   the completeness state of the chunk, or GROUND_STREAM_EMPTY if
+//   the empty clause was derived.
+//
+// Global Variables: TimeIsUp, MemIsLow
+//
+// Side Effects    : Output, memory operations, changes stream->units
+//
+/----------------------------------------------------------------------*/
+
+static long ground_stream_worker(void* data, long idx)
+{
+   GroundStream_p        stream = data;
+   FILE*                 out    = stream->chunks[idx];
+   GroundStreamStatsCell stats  = {0, 0, 0};
+   long                  res    = cpl_complete, count = 0;
+   PStackPointer         i;
+   Clause_p              clause, new;
+   VarSetInst_p          inst;
+   Eqn_p                 handle;
+   bool                  next;
+
+   /* The chunk is recomputed if its worker process failed */
+   rewind(out);
+   if(ftruncate(fileno(out), 0) == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot truncate grounding chunk", FILE_ERROR);
+   }
+   for(i=0; i<PStackGetSP(stream->clauses) && res == cpl_complete; i++)
+   {
+      clause = PStackElementP(stream->clauses, i);
+      inst   = PStackElementP(stream->insts, i);
+      next   = varsetinstinitialize(inst);
+      while(next)
+      {
+         if(TimeIsUp || MemIsLow)
+         {
+            res = TimeIsUp?cpl_timeout:cpl_lowmem;
+            break;
+         }
+         if((count++ % stream->workers) == idx)
+         {
+            varsetinstapply(inst);
+            handle = EqnListCopy(clause->literals, stream->bank);
+            EqnListRemoveDuplicates(handle);
+            if(stream->taut_check && EqnListIsTrivial(handle))
+            {
+               EqnListFree(handle);
+            }
+            else
+            {
+               new = ClauseAlloc(handle);
+               if(GroundSetUnitSimplifyClause(stream->units, new,
+                                              stream->subsume,
+                                              stream->resolve))
+               {
+                  ClauseFree(new);
+               }
+               else if(ClauseIsEmpty(new))
+               {
+                  ClauseFree(new);
+                  res = GROUND_STREAM_EMPTY;
+                  break;
+               }
+               else
+               {
+                  ground_stream_emit(out, stream->units, new, &stats);
+               }
+            }
+         }
+         next = varsetinstnext(inst);
+      }
+      varsetinstclear(inst);
+   }
+   ground_stream_chunk_close(out, &stats);
+   return res;
+}
+
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -343,8 +617,8 @@ long ClauseSetEqlitRecode(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!= set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseEqlitRecode(handle))
       {
@@ -584,11 +858,11 @@ void ClausePrintDimacs(FILE* out, Clause_p clause)
       {
          if(EqnIsPositive(handle))
          {
-            fprintf(stdout, "  %ld", handle->lterm->entry_no);
+            fprintf(out, "  %ld", handle->lterm->entry_no);
          }
          else
          {
-            fprintf(stdout, " -%ld", handle->lterm->entry_no);
+            fprintf(out, " -%ld", handle->lterm->entry_no);
          }
       }
       fputs(" 0\n", out);
@@ -611,8 +885,8 @@ void ClauseSetPrintDimacs(FILE* out, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClausePrintDimacs(out, handle);
    }
@@ -1032,8 +1306,8 @@ bool ClauseSetCreateGroundInstances(TB_p bank, ClauseSet_p set,
       }
    }
 
-   for(handle = set->anchor->succ; handle!= set->anchor && !TimeIsUp
-          && !MemIsLow; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!= set->anchor && !TimeIsUp
+          && !MemIsLow; handle = ClauseSucc(handle))
    {
       inst = VarSetInstAlloc(handle);
       for(i=0; i<inst->size; i++)
@@ -1111,9 +1385,9 @@ bool ClauseSetCreateConstrGroundInstances(TB_p bank, ClauseSet_p set,
    n_table = LitOccTableAlloc(bank->sig);
    LitOccAddClauseSetAlt(p_table, n_table, set);
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!= set->anchor && !TimeIsUp && !MemIsLow;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       inst = VarSetConstrInstAlloc(p_table, n_table, handle,
                                    default_term_tree);
@@ -1159,6 +1433,262 @@ bool ClauseSetCreateConstrGroundInstances(TB_p bank, ClauseSet_p set,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetStreamGroundInstancesDimacs()
+//
+//   Create the ground instances of set (optionally restricted by
+//   global instantiation constraints) and print them in DIMACS format
+//   to out, with the header computed from the actual output. Unit
+//   clauses are grounded first. The instances of non-unit clauses are
+//   distributed over the given number of worker processes, each of
+//   which simplifies them with the units it knows and writes them to a
+//   temporary chunk file, so that only unit clauses are ever held in
+//   memory. If the empty clause is found, a trivially unsatisfiable
+//   problem is printed. If out is NULL, nothing is printed. Return
+//   the completeness state, and the size of the output in stats.
+//
+// Global Variables: TimeIsUp, MemIsLow
+//
+// Side Effects    : Output, creates processes and temporary files
+//
+/----------------------------------------------------------------------*/
+
+GroundSetState ClauseSetStreamGroundInstancesDimacs(FILE* out, TB_p bank,
+                                                    ClauseSet_p set,
+                                                    bool subsume,
+                                                    bool resolve,
+                                                    bool taut_check,
+                                                    bool constraints,
+                                                    long give_up,
+                                                    int workers,
+                                                    GroundStreamStats_p stats)
+{
+   GroundStreamCell      stream;
+   GroundStreamStatsCell chunk_stats;
+   GroundSet_p           units = GroundSetAlloc(bank);
+   PStack_p              default_terms = PStackAlloc();
+   PTree_p               default_term_tree = NULL;
+   LitOccTable_p         p_table = NULL, n_table = NULL;
+   FILE                  *unit_chunk;
+   long                  *results, *sizes, unit_size;
+   int                   i;
+   PStackPointer         sp;
+   Clause_p              handle;
+   VarSetInst_p          inst;
+   double                estimate = 0.0, clause_estimate;
+   GroundSetState        res = cpl_complete;
+   bool                  empty = false, grounded = false;
+
+   workers = MAX(workers, 1);
+   SigCollectConstantTerms(bank, default_terms, 0);
+   if(constraints)
+   {
+      PStackToPTree(&default_term_tree, default_terms);
+      p_table = LitOccTableAlloc(bank->sig);
+      n_table = LitOccTableAlloc(bank->sig);
+      LitOccAddClauseSetAlt(p_table, n_table, set);
+   }
+   stream.bank       = bank;
+   stream.units      = units;
+   stream.clauses    = PStackAlloc();
+   stream.insts      = PStackAlloc();
+   stream.subsume    = subsume;
+   stream.resolve    = resolve;
+   stream.taut_check = taut_check;
+   stream.workers    = workers;
+
+   for(handle = ClauseSucc(set->anchor);
+       handle != set->anchor && !empty && !TimeIsUp && !MemIsLow;
+       handle = ClauseSucc(handle))
+   {
+      if(constraints)
+      {
+         inst = VarSetConstrInstAlloc(p_table, n_table, handle,
+                                      default_term_tree);
+      }
+      else
+      {
+         inst = VarSetInstAlloc(handle);
+         for(i=0; i<inst->size; i++)
+         {
+            inst->cells[i].alternatives = default_terms;
+         }
+      }
+      if(give_up)
+      {
+         clause_estimate = varinstestimate(inst);
+         estimate = constraints?(estimate+clause_estimate):clause_estimate;
+         if(estimate > give_up)
+         {
+            fprintf(GlobalOut, "\n# Failure: User resource limit"
+                    " exceeded (estimated number of instances)!\n");
+            exit(NO_ERROR);
+         }
+      }
+      if(ClauseLiteralNumber(handle) <= 1)
+      {
+         empty = !ClauseCreateGroundInstances(bank, handle, inst, units,
+                                              subsume, resolve, taut_check);
+         if(constraints)
+         {
+            VarSetConstrInstFree(inst);
+         }
+         else
+         {
+            VarSetInstFree(inst);
+         }
+      }
+      else
+      {
+         PStackPushP(stream.clauses, handle);
+         PStackPushP(stream.insts, inst);
+      }
+   }
+   if(TimeIsUp)
+   {
+      res = cpl_timeout;
+   }
+   else if(MemIsLow)
+   {
+      res = cpl_lowmem;
+   }
+
+   /* The units found so far go first - a worker running in this
+      process will extend the set */
+   unit_chunk = tmpfile();
+   stream.chunks = SizeMalloc(workers*sizeof(FILE*));
+   for(i=0; i<workers; i++)
+   {
+      stream.chunks[i] = tmpfile();
+      if(!stream.chunks[i])
+      {
+         TmpErrno = errno;
+         SysError("Cannot create grounding chunk", FILE_ERROR);
+      }
+      setvbuf(stream.chunks[i], NULL, _IOFBF, GROUND_STREAM_BUFSIZE);
+   }
+   if(!unit_chunk)
+   {
+      TmpErrno = errno;
+      SysError("Cannot create grounding chunk", FILE_ERROR);
+   }
+   GroundSetPrintDimacs(unit_chunk, units);
+   chunk_stats.clauses  = units->unit_no;
+   chunk_stats.literals = units->unit_no;
+   chunk_stats.max_var  = units->max_literal;
+   ground_stream_chunk_close(unit_chunk, &chunk_stats);
+
+   results = SizeMalloc(workers*sizeof(long));
+   if(!empty && res == cpl_complete)
+   {
+      if(workers > 1)
+      {
+         for(sp=0; sp<PStackGetSP(stream.clauses); sp++)
+         {
+            ground_stream_preinsert(bank,
+                                    PStackElementP(stream.clauses, sp),
+                                    PStackElementP(stream.insts, sp));
+         }
+      }
+      fflush(NULL); /* Workers must not inherit buffered output */
+      ForkMapLong(workers, workers, ground_stream_worker, &stream, results);
+      grounded = true;
+      for(i=0; i<workers; i++)
+      {
+         if(results[i] == GROUND_STREAM_EMPTY)
+         {
+            empty = true;
+         }
+         else if(results[i] != cpl_complete)
+         {
+            res = results[i];
+         }
+      }
+   }
+
+   if(OutputLevel == 1)
+   {
+      fputc('\n', GlobalOut); /* Terminate progress output */
+   }
+   if(empty)
+   {
+      /* As in ClausePrintDimacs(), the empty clause is printed as a
+         trivially unsatisfiable pair of units */
+      if(out)
+      {
+         PrintDimacsHeader(out, 1, 2);
+         fputs(" -1 0\n  1 0\n", out);
+      }
+      stats->clauses  = 2;
+      stats->literals = 2;
+      stats->max_var  = 1;
+      res = cpl_complete;
+   }
+   else
+   {
+      sizes = SizeMalloc(workers*sizeof(long));
+      unit_size = ground_stream_chunk_stats(unit_chunk, stats);
+      for(i=0; i<workers; i++)
+      {
+         if(grounded)
+         {
+            sizes[i] = ground_stream_chunk_stats(stream.chunks[i],
+                                                 &chunk_stats);
+            stats->clauses  += chunk_stats.clauses;
+            stats->literals += chunk_stats.literals;
+            stats->max_var   = MAX(stats->max_var, chunk_stats.max_var);
+         }
+         else
+         {
+            sizes[i] = 0;
+         }
+      }
+      if(out)
+      {
+         PrintDimacsHeader(out, stats->max_var, stats->clauses);
+         ground_stream_chunk_copy(out, unit_chunk, unit_size);
+         for(i=0; i<workers; i++)
+         {
+            ground_stream_chunk_copy(out, stream.chunks[i], sizes[i]);
+         }
+      }
+      SizeFree(sizes, workers*sizeof(long));
+   }
+
+   fclose(unit_chunk);
+   for(i=0; i<workers; i++)
+   {
+      fclose(stream.chunks[i]);
+   }
+   SizeFree(stream.chunks, workers*sizeof(FILE*));
+   SizeFree(results, workers*sizeof(long));
+   while(!PStackEmpty(stream.insts))
+   {
+      inst = PStackPopP(stream.insts);
+      if(constraints)
+      {
+         VarSetConstrInstFree(inst);
+      }
+      else
+      {
+         VarSetInstFree(inst);
+      }
+   }
+   PStackFree(stream.insts);
+   PStackFree(stream.clauses);
+   if(constraints)
+   {
+      LitOccTableFree(p_table);
+      LitOccTableFree(n_table);
+      PTreeFree(default_term_tree);
+   }
+   PStackFree(default_terms);
+   GroundSetFree(units);
+
+   return res;
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
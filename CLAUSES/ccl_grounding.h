@@ -18,6 +18,8 @@
   Changes
 
   Created: Tue May 29 02:20:15 CEST 2001
+  Mon Oct 19 01:32:08 CEST 2026: Parallel grounding with streamed
+  DIMACS output
 
   -----------------------------------------------------------------------*/
 
@@ -88,6 +90,37 @@ typedef struct ground_set_cell
    PropClauseSet_p non_units;
 }GroundSetCell, *GroundSet_p;
 
+
+/* Streaming DIMACS output: Non-unit clauses are grounded by worker
+   processes, each of which writes its share of the instances
+   directly into its own chunk file. Only the unit clauses are kept in
+   memory (for simplification). Every chunk ends with a statistics
+   record, from which the header is computed before the chunks are
+   copied to the output. */
+
+#define GROUND_STREAM_BUFSIZE (1024*1024) /* stdio buffer per chunk */
+#define GROUND_STREAM_EMPTY   -1          /* Worker found empty clause */
+
+typedef struct ground_stream_stats_cell
+{
+   long clauses;
+   long literals;
+   long max_var;
+}GroundStreamStatsCell, *GroundStreamStats_p;
+
+typedef struct ground_stream_cell
+{
+   TB_p        bank;
+   GroundSet_p units;    /* Units found before the workers start */
+   PStack_p    clauses;  /* Non-unit clauses... */
+   PStack_p    insts;    /* ...and their instantiations */
+   bool        subsume;
+   bool        resolve;
+   bool        taut_check;
+   int         workers;
+   FILE        **chunks; /* One per worker */
+}GroundStreamCell, *GroundStream_p;
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -153,6 +186,16 @@ bool ClauseSetCreateConstrGroundInstances(TB_p bank, ClauseSet_p set,
                                           give_up, long
                                           just_one_instance);
 
+GroundSetState ClauseSetStreamGroundInstancesDimacs(FILE* out, TB_p bank,
+                                                    ClauseSet_p set,
+                                                    bool subsume,
+                                                    bool resolve,
+                                                    bool taut_check,
+                                                    bool constraints,
+                                                    long give_up,
+                                                    int workers,
+                                                    GroundStreamStats_p stats);
+
 #endif
 
 /*---------------------------------------------------------------------*/
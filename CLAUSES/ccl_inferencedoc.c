@@ -183,13 +183,13 @@ static void print_initial(FILE* out, Clause_p clause, char* comment)
    {
    case pcl_format:
     pcl_print_start(out, clause, PCLShellLevel<2);
-         ClauseSourceInfoPrintPCL(out, clause->info);
+         ClauseSourceInfoPrintPCL(out, ClauseSourceInfo(clause));
     pcl_print_end(out, comment, clause);
     break;
    case tstp_format:
     ClauseTSTPPrint(out, clause, PCLFullTerms, false);
     fprintf(out, ", ");
-         ClauseSourceInfoPrintTSTP(out, clause->info);
+         ClauseSourceInfoPrintTSTP(out, ClauseSourceInfo(clause));
     tstp_print_end(out, comment, clause);
     break;
    default:
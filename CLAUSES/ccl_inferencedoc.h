@@ -130,6 +130,7 @@ typedef enum
 #define PCL_CHOICE_INST "choice_inst"
 #define PCL_TRIGGER "trigger"
 #define PCL_PRUNE_ARG "prune_arg"
+#define PCL_CHECKPOINT "introduced(checkpoint)"
 
 
 /*---------------------------------------------------------------------*/
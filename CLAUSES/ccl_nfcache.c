@@ -0,0 +1,466 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_nfcache.c
+
+Author: The E developers
+
+Contents
+
+  Symbol dates and normal form memo table for demodulation.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 19:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_nfcache.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: nfcache_add_side()
+//
+//   Note that side of a demodulator of the given date can be used as
+//   a left hand side.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes cache
+//
+/----------------------------------------------------------------------*/
+
+static void nfcache_add_side(NFCache_p cache, Term_p side, SysDate date)
+{
+   long *ref;
+
+   if(TermIsFreeVar(side))
+   {
+      cache->var_date = SysDateMaximum(cache->var_date, date);
+   }
+   else
+   {
+      ref  = &(PDArrayElementInt(cache->sym_dates, side->f_code));
+      *ref = SysDateMaximum(*ref, date);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: nfcache_evict()
+//
+//   Remove the oldest entry from the memo table.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes cache, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void nfcache_evict(NFCache_p cache)
+{
+   long  key;
+   void *entry;
+
+   assert(!PQueueEmpty(cache->order));
+
+   key = PQueueGetNextInt(cache->order);
+   if(NumBTreeDelete(cache->memo, key, &entry))
+   {
+      NFMemoCellFree(entry);
+      cache->memo_no--;
+      cache->evictions++;
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheAlloc()
+//
+//   Allocate an empty cache for terms from bank, remembering at most
+//   capacity normal forms.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+NFCache_p NFCacheAlloc(TB_p bank, long capacity)
+{
+   NFCache_p handle = NFCacheCellAlloc();
+
+   handle->bank          = bank;
+   handle->sym_dates     = PDIntArrayAlloc(64, 0);
+   handle->var_date      = SysDateCreationTime();
+   handle->capacity      = capacity;
+   handle->memo          = NumBTreeAlloc();
+   handle->memo_no       = 0;
+   handle->order         = PQueueAlloc();
+   handle->lookups       = 0;
+   handle->hits          = 0;
+   handle->rescued_hits  = 0;
+   handle->steps_reused  = 0;
+   handle->stores        = 0;
+   handle->evictions     = 0;
+   handle->rescues       = 0;
+   handle->revalidations = 0;
+   handle->top_skips     = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheFree()
+//
+//   Free the cache (but not the terms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void NFCacheFree(NFCache_p junk)
+{
+   BTreeIterCell iter;
+   long          key;
+   void          *entry;
+
+   NumBTreeIterInit(&iter, junk->memo, LONG_MIN);
+   while(NumBTreeIterNext(&iter, &key, &entry))
+   {
+      NFMemoCellFree(entry);
+   }
+   NumBTreeFree(junk->memo);
+   PQueueFree(junk->order);
+   PDArrayFree(junk->sym_dates);
+   NFCacheCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheAddDemodulator()
+//
+//   Record the date of a new demodulator for the top symbols of its
+//   usable sides.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes cache
+//
+/----------------------------------------------------------------------*/
+
+void NFCacheAddDemodulator(NFCache_p cache, Clause_p demod)
+{
+   Eqn_p eqn = demod->literals;
+
+   assert(ClauseIsUnit(demod));
+
+   nfcache_add_side(cache, eqn->lterm, demod->date);
+   if(!EqnIsOriented(eqn))
+   {
+      nfcache_add_side(cache, eqn->rterm, demod->date);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheTermIsNormal()
+//
+//   Return true if no demodulator younger than date can rewrite any
+//   subterm of term. If term was in normal form at date, it still
+//   is.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool NFCacheTermIsNormal(NFCache_p cache, Term_p term, SysDate date)
+{
+   PStack_p stack;
+   bool     res = true;
+   int      i;
+
+   if(SysDateIsEarlier(date, cache->var_date))
+   {
+      return false;
+   }
+   stack = PStackAlloc();
+   PStackPushP(stack, term);
+   while(!PStackEmpty(stack))
+   {
+      term = PStackPopP(stack);
+      if(TermIsFreeVar(term))
+      {
+         continue;
+      }
+      if(!NFCacheTopIsNormal(cache, term, date))
+      {
+         res = false;
+         break;
+      }
+      for(i=0; i<term->arity; i++)
+      {
+         PStackPushP(stack, term->args[i]);
+      }
+   }
+   PStackFree(stack);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheRevalidate()
+//
+//   If term has been in normal form at some date before date and
+//   none of the demodulators since then applies to it, move its
+//   normal form date for level to date. Return true if this was
+//   possible.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the rewrite state of term.
+//
+/----------------------------------------------------------------------*/
+
+bool NFCacheRevalidate(NFCache_p cache, Term_p term,
+                       RewriteLevel level, SysDate date)
+{
+   SysDate nf_date;
+
+   assert(level);
+
+   if(TermIsFreeVar(term) || TermIsRewritten(term))
+   {
+      return false;
+   }
+   nf_date = term->rw_data.nf_date[RewriteAdr(level)];
+   if(!SysDateIsEarlier(nf_date, date) ||
+      !NFCacheTermIsNormal(cache, term, nf_date))
+   {
+      return false;
+   }
+   /* Normal with respect to rules and equations implies normal with
+      respect to rules only */
+   term->rw_data.nf_date[RewriteAdr(RuleRewrite)] = date;
+   if(level == FullRewrite)
+   {
+      term->rw_data.nf_date[RewriteAdr(FullRewrite)] = date;
+   }
+   cache->revalidations++;
+
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheLookup()
+//
+//   Return the memo entry for term at level, or NULL if there is no
+//   usable one.
+//
+// Global Variables: TermRWLinkChanges
+//
+// Side Effects    : Updates statistics
+//
+/----------------------------------------------------------------------*/
+
+NFMemo_p NFCacheLookup(NFCache_p cache, Term_p term, RewriteLevel level)
+{
+   void     **ref;
+   NFMemo_p entry;
+
+   cache->lookups++;
+   if(!TermIsShared(term))
+   {
+      return NULL;
+   }
+   ref = NumBTreeFindRef(cache->memo, term->entry_no);
+   if(!ref)
+   {
+      return NULL;
+   }
+   entry = *ref;
+   assert(entry->term == term);
+   if((entry->level != level) ||
+      (entry->link_epoch != TermRWLinkChanges))
+   {
+      return NULL;
+   }
+   cache->hits++;
+   cache->steps_reused += entry->steps;
+   if(entry->rescued)
+   {
+      cache->rescued_hits++;
+   }
+   return entry;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheStore()
+//
+//   Record that term has been rewritten to nf at level in steps steps,
+//   replacing an older entry for term. If the table is full, the
+//   oldest entry is dropped.
+//
+// Global Variables: TermRWLinkChanges
+//
+// Side Effects    : Changes cache, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void NFCacheStore(NFCache_p cache, Term_p term, Term_p nf,
+                  RewriteLevel level, long steps, bool sos)
+{
+   void     **ref;
+   bool     created;
+   NFMemo_p entry;
+
+   assert(term != nf);
+
+   if(!cache->capacity || !TermIsShared(term))
+   {
+      return;
+   }
+   ref = NumBTreeGetRef(cache->memo, term->entry_no, &created);
+   if(created)
+   {
+      *ref = NFMemoCellAlloc();
+      entry = *ref;
+      entry->term    = term;
+      entry->rescued = false;
+      PQueueStoreInt(cache->order, term->entry_no);
+      cache->memo_no++;
+   }
+   entry = *ref;
+   entry->nf         = nf;
+   entry->level      = level;
+   entry->link_epoch = TermRWLinkChanges;
+   entry->steps      = steps;
+   entry->sos        = sos;
+   cache->stores++;
+
+   while(cache->memo_no > cache->capacity)
+   {
+      nfcache_evict(cache);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCacheGCMarkTerms()
+//
+//   Mark the terms in the memo table as used. Has to be called after
+//   all other terms have been marked, so that terms only kept alive
+//   by the cache can be recognized.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms
+//
+/----------------------------------------------------------------------*/
+
+void NFCacheGCMarkTerms(NFCache_p cache)
+{
+   BTreeIterCell iter;
+   long          key;
+   void          *val;
+   NFMemo_p      entry;
+
+   NumBTreeIterInit(&iter, cache->memo, LONG_MIN);
+   while(NumBTreeIterNext(&iter, &key, &val))
+   {
+      entry = val;
+      if(!TBTermCellIsMarked(cache->bank, entry->term))
+      {
+         if(!entry->rescued)
+         {
+            cache->rescues++;
+         }
+         entry->rescued = true;
+         TBGCMarkTerm(cache->bank, entry->term);
+      }
+      TBGCMarkTerm(cache->bank, entry->nf);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: NFCachePrintStatistics()
+//
+//   Print the usage of the cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void NFCachePrintStatistics(FILE* out, NFCache_p cache)
+{
+   fprintf(out, "# NF cache revalidated normal forms    : %ld\n",
+           cache->revalidations);
+   fprintf(out, "# NF cache skipped top rewrite attempts: %ld\n",
+           cache->top_skips);
+   fprintf(out, "# NF memo entries (max)                : %ld (%ld)\n",
+           cache->memo_no, cache->capacity);
+   fprintf(out, "# ...stored/evicted                    : %ld/%ld\n",
+           cache->stores, cache->evictions);
+   fprintf(out, "# ...lookups                           : %ld\n",
+           cache->lookups);
+   fprintf(out, "# ...hits                              : %ld\n",
+           cache->hits);
+   fprintf(out, "# ...rewrite steps reused              : %ld\n",
+           cache->steps_reused);
+   fprintf(out, "# ...terms kept alive by GC pinning    : %ld\n",
+           cache->rescues);
+   fprintf(out, "# ...hits on kept alive terms          : %ld\n",
+           cache->rescued_hits);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,129 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_nfcache.h
+
+Author: The E developers
+
+Contents
+
+  Normal form cache for demodulation with the processed unit
+  equations of a proof state.
+
+  The dates in the rewrite state of a term only say that it was
+  irreducible with respect to all demodulators at a given time, so
+  every new demodulator makes all terms suspicious. The cache records
+  for each function symbol the date of the newest demodulator with
+  that symbol at the top of a (usable) side. A term that was in normal
+  form at date d stays in normal form as long as none of its symbols
+  has a demodulator younger than d, which can be checked without
+  touching the indices.
+
+  In addition, it keeps a bounded memo table mapping shared terms to
+  their last computed normal forms. The terms in the table (and their
+  rewrite chains) are kept alive by the garbage collector, so that a
+  term that is discarded with its clause and later regenerated finds
+  its rewrite links again instead of being normalized from scratch.
+  An entry is only used as long as no rewrite link has been redirected
+  since it was stored (see TermRWLinkChanges).
+
+  The cache is first-order only.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 19:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_NFCACHE
+
+#define CCL_NFCACHE
+
+#include <clb_btrees.h>
+#include <clb_pqueue.h>
+#include <cte_replace.h>
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct nf_memo_cell
+{
+   Term_p       term;       /* Key */
+   Term_p       nf;         /* Reached from term by rewrite links */
+   RewriteLevel level;
+   long         link_epoch; /* TermRWLinkChanges when stored */
+   long         steps;      /* Rewrite steps from term to nf */
+   bool         sos;        /* Some step used a SoS clause */
+   bool         rescued;    /* Term has been kept alive by the cache */
+}NFMemoCell, *NFMemo_p;
+
+typedef struct nf_cache_cell
+{
+   TB_p       bank;
+   PDArray_p  sym_dates;  /* f_code -> newest demodulator with that top */
+   SysDate    var_date;   /* Newest demodulator with a variable side */
+   long       capacity;
+   NumBTree_p memo;       /* entry_no -> NFMemo_p */
+   long       memo_no;
+   PQueue_p   order;      /* entry_nos in insertion order, for eviction */
+   /* Statistics */
+   long       lookups;
+   long       hits;
+   long       rescued_hits;
+   long       steps_reused;
+   long       stores;
+   long       evictions;
+   long       rescues;
+   long       revalidations;
+   long       top_skips;
+}NFCacheCell, *NFCache_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define NFCacheCellAlloc()    (NFCacheCell*)SizeMalloc(sizeof(NFCacheCell))
+#define NFCacheCellFree(junk) SizeFree(junk, sizeof(NFCacheCell))
+#define NFMemoCellAlloc()     (NFMemoCell*)SizeMalloc(sizeof(NFMemoCell))
+#define NFMemoCellFree(junk)  SizeFree(junk, sizeof(NFMemoCell))
+
+/* Is no demodulator younger than date applicable at the top of the
+   (non-variable) term? */
+#define NFCacheTopIsNormal(cache, term, date)                           \
+        (!SysDateIsEarlier((date),                                      \
+                           SysDateMaximum((cache)->var_date,            \
+                                          PDArrayElementInt((cache)->sym_dates, \
+                                                            (term)->f_code))))
+
+NFCache_p NFCacheAlloc(TB_p bank, long capacity);
+void      NFCacheFree(NFCache_p junk);
+
+void      NFCacheAddDemodulator(NFCache_p cache, Clause_p demod);
+
+bool      NFCacheTermIsNormal(NFCache_p cache, Term_p term, SysDate date);
+bool      NFCacheRevalidate(NFCache_p cache, Term_p term,
+                            RewriteLevel level, SysDate date);
+
+NFMemo_p  NFCacheLookup(NFCache_p cache, Term_p term, RewriteLevel level);
+void      NFCacheStore(NFCache_p cache, Term_p term, Term_p nf,
+                       RewriteLevel level, long steps, bool sos);
+
+void      NFCacheGCMarkTerms(NFCache_p cache);
+
+void      NFCachePrintStatistics(FILE* out, NFCache_p cache);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -228,20 +228,17 @@ static PStack_p pdt_node_succ_stack_create(PDTNode_p node)
 //
 /----------------------------------------------------------------------*/
 
-static long pos_tree_compute_size_constraint(PTree_p tree)
+static long pos_tree_compute_size_constraint(PBTree_p tree)
 {
-   ClausePos_p entry;
-   PTree_p  trav;
-   PStack_p trav_stack;
+   ClausePos_p   entry;
+   BTreeIterCell iter;
    long res = LONG_MAX;
 
-   trav_stack = PTreeTraverseInit(tree);
-   while((trav = PTreeTraverseNext(trav_stack)))
+   PBTreeIterInit(&iter, tree);
+   while((entry = PBTreeIterNext(&iter)))
    {
-      entry = trav->key;
       res = MIN(res, TermStandardWeight(ClausePosGetSide(entry)));
    }
-   PTreeTraverseExit(trav_stack);
    /* This is a leaf node, size is fixed! */
 
    return res;
@@ -349,20 +346,17 @@ long pdt_verify_size_constraint(PDTNode_p node)
 //
 /----------------------------------------------------------------------*/
 
-static SysDate pos_tree_compute_age_constraint(PTree_p tree)
+static SysDate pos_tree_compute_age_constraint(PBTree_p tree)
 {
-   ClausePos_p entry;
-   PTree_p  trav;
-   PStack_p trav_stack;
+   ClausePos_p   entry;
+   BTreeIterCell iter;
    SysDate res = SysDateCreationTime();
 
-   trav_stack = PTreeTraverseInit(tree);
-   while((trav = PTreeTraverseNext(trav_stack)))
+   PBTreeIterInit(&iter, tree);
+   while((entry = PBTreeIterNext(&iter)))
    {
-      entry = trav->key;
       res = SysDateMaximum(res, entry->clause->date);
    }
-   PTreeTraverseExit(trav_stack);
    /* This is a leaf node, size is fixed! */
 
    return res;
@@ -464,7 +458,7 @@ SysDate pdt_verify_age_constraint(PDTNode_p node)
 //
 // Function: delete_clause_entries()
 //
-//   Consider *root as a PTree of ClausePos_p and delete all entries
+//   Consider *root as a PBTree of ClausePos_p and delete all entries
 //   from it that describe a position in clause. Return number of
 //   clauses.
 //
@@ -474,29 +468,26 @@ SysDate pdt_verify_age_constraint(PDTNode_p node)
 //
 /----------------------------------------------------------------------*/
 
-static long  delete_clause_entries(PTree_p *root, Clause_p clause, Deleter deleter)
+static long  delete_clause_entries(PBTree_p *root, Clause_p clause, Deleter deleter)
 {
-   long        res = 0;
-   PStack_p    trav_stack;
-   PStack_p    store = PStackAlloc();
-   PTree_p     handle;
-   ClausePos_p pos;
-
-   trav_stack = PTreeTraverseInit(*root);
-   while((handle = PTreeTraverseNext(trav_stack)))
+   long          res = 0;
+   BTreeIterCell iter;
+   PStack_p      store = PStackAlloc();
+   ClausePos_p   pos;
+
+   PBTreeIterInit(&iter, *root);
+   while((pos = PBTreeIterNext(&iter)))
    {
-      pos = handle->key;
       if(pos->clause == clause)
       {
          PStackPushP(store, pos);
       }
    }
-   PTreeTraverseExit(trav_stack);
 
    while(!PStackEmpty(store))
    {
       pos = PStackPopP(store);
-      PTreeDeleteEntry(root, pos);
+      PBTreeDeleteEntry(root, pos);
       ClausePosCellFreeWDeleter(pos, deleter);
       res++;
    }
@@ -747,22 +738,19 @@ void pdt_node_print(FILE* out, PDTNode_p node, Sig_p sig, int level)
 {
    if(node->entries)
    {
-      PStack_p trav_stack;
-      PTree_p trav;
+      BTreeIterCell iter;
       ClausePos_p entry;
 
       fprintf(out, "%sleaf size=%ld age=%lu leaf?=%d\n", IndentStr(2*level),
               node->size_constr, node->age_constr, node->leaf);
-      trav_stack = PTreeTraverseInit(node->entries);
+      PBTreeIterInit(&iter, node->entries);
 
-      while((trav = PTreeTraverseNext(trav_stack)))
+      while((entry = PBTreeIterNext(&iter)))
       {
          fprintf(out, "%s: ",IndentStr(2*level));
-         entry = trav->key;
          ClausePrint(out, entry->clause, true);
          fprintf(out, "\n");
       }
-      PTreeTraverseExit(trav_stack);
    }
    else if(!node->leaf)
    {
@@ -848,7 +836,7 @@ PDTree_p PDTreeAllocWDeleter(TB_p bank, Deleter deleter)
    handle->term_stack      = PStackAlloc();
    handle->term_proc       = PStackAlloc();
    handle->tree_pos        = NULL;
-   handle->store_stack     = NULL;
+   handle->store_active    = false;
    handle->term            = NULL;
    handle->term_date       = SysDateCreationTime();
    handle->term_weight     = LONG_MAX;
@@ -882,7 +870,7 @@ void PDTreeFree(PDTree_p tree)
    PDTNodeFree(tree->tree, tree->deleter);
    PStackFree(tree->term_stack);
    PStackFree(tree->term_proc);
-   assert(!tree->store_stack);
+   assert(!tree->store_active);
    PDTreeCellFree(tree);
 }
 
@@ -968,7 +956,7 @@ void PDTNodeFree(PDTNode_p tree, Deleter deleter)
    PObjMapFree(tree->db_alternatives);
    while(tree->entries)
    {
-      tmp = PTreeExtractRootKey(&tree->entries);
+      tmp = PBTreeExtractFirstKey(&tree->entries);
       ClausePosCellFreeWDeleter(tmp, deleter);
    }
    PStackFree(objmap_iter);
@@ -1173,7 +1161,7 @@ bool PDTreeInsertTerm(PDTree_p tree, Term_p term, ClausePos_p demod_side,
    assert(node);
    if (store_data)
    {
-      res = PTreeStore(&(node->entries), demod_side);
+      res = PBTreeStore(&(node->entries), demod_side);
       UNUSED(res); assert(res);
    }
    tree->clause_count++;
@@ -1331,7 +1319,7 @@ long PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause)
             }
             pdtree_default_cell_free(node);
          }
-         else if(node->ref_count == PTreeNodes(node->entries))
+         else if(node->ref_count == PBTreeNodes(node->entries))
          {
             node->leaf = true;
          }
@@ -1428,11 +1416,7 @@ void PDTreeSearchExit(PDTree_p tree)
    // not all terms can be targets
    assert(problemType == PROBLEM_HO || tree->term);
 
-   if(tree->store_stack)
-   {
-      PTreeTraverseExit(tree->store_stack);
-      tree->store_stack = NULL;
-   }
+   tree->store_active = false;
    tree->term = NULL;
 }
 
@@ -1496,28 +1480,24 @@ PDTNode_p PDTreeFindNextIndexedLeaf(PDTree_p tree, Subst_p subst)
 
 ClausePos_p PDTreeFindNextDemodulator(PDTree_p tree, Subst_p subst)
 {
-   PTree_p res_cell = NULL;
+   ClausePos_p res;
 
    while(tree->tree_pos)
    {
-      if(tree->store_stack)
+      if(tree->store_active)
       {
-         res_cell = PTreeTraverseNext(tree->store_stack);
-         if(res_cell)
-         {
-            return res_cell->key;
-         }
-         else
+         res = PBTreeIterNext(&(tree->store_iter));
+         if(res)
          {
-            PTreeTraverseExit(tree->store_stack);
-            tree->store_stack = NULL;
+            return res;
          }
+         tree->store_active = false;
       }
       PDTreeFindNextIndexedLeaf(tree, subst);
       if(tree->tree_pos)
       {
-         tree->store_stack =
-            PTreeTraverseInit(tree->tree_pos->entries);
+         PBTreeIterInit(&(tree->store_iter), tree->tree_pos->entries);
+         tree->store_active = true;
       }
    }
 
@@ -28,6 +28,7 @@
 #define CCL_PDTREES
 
 #include <clb_intmap.h>
+#include <clb_btrees.h>
 #include <ccl_clausepos.h>
 #include <clb_simple_stuff.h>
 #include <clb_objmaps.h>
@@ -62,7 +63,7 @@ typedef struct pdt_node_cell
                                            towards the root */
    long               ref_count;        /* How many entries share this
                                            node? */
-   PTree_p            entries;          /* Clauses that are indexed
+   PBTree_p           entries;          /* Clauses that are indexed
                                            - this should be NULL at
                                            all but leaf nodes. */
    Term_p             variable;         /* If this  node corresponds
@@ -91,7 +92,8 @@ typedef struct pd_tree_cell
    PStack_p  term_stack;     /* For flattening the term */
    PStack_p  term_proc;      /* Store traversed terms for backtracking */
    PDTNode_p tree_pos;       /* For traversing the tree */
-   PStack_p  store_stack;    /* For traversing entries in leaves */
+   BTreeIterCell store_iter; /* For traversing entries in leaves... */
+   bool      store_active;   /* ...if this is set */
    Term_p    term;           /* ...used as a key during search */
    SysDate   term_date;      /* Temporarily bound during matching */
    long      term_weight;    /* Ditto */
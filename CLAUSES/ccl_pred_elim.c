@@ -65,6 +65,21 @@ typedef struct PETaskCell* PETask_p;
 
 typedef Clause_p (*ResolverFun_p)(Clause_p, Clause_p, FunCode);
 
+// Everything a (forked) worker needs to evaluate a batch of tasks
+typedef struct
+{
+   PStack_p         tasks;
+   ResolverFun_p    resolver;
+   HeuristicParms_p parms;
+   TB_p             tmp_bank;
+   VarBank_p        freshvars;
+   ClauseSet_p      archive;
+} PEBatchCell;
+typedef PEBatchCell* PEBatch_p;
+
+// Number of tasks per worker that are handed out in one batch
+#define PE_BATCH_FACTOR 8
+
 // binarizes boolean values -- ensures that they are 1 or 0 which C
 // standard does not guarantee
 #define BIN(x) ((x) ? 1 : 0)
@@ -871,8 +886,7 @@ void check_unsat_and_tauto(PETask_p task, TB_p tmp_terms)
    pivot_fresh->literals = rest_fresh;
    ClauseRecomputeLitCounts(pivot_fresh);
 
-   SatSolver_p solver = picosat_init();
-   picosat_enable_trace_generation(solver);
+   SatSolver_p solver = SatSolverAlloc(SatSolverDefault);
 
    SatClauseSet_p environment = SatClauseSetAlloc();
    SatClauseCreateAndStore(pivot_fresh, environment);
@@ -932,7 +946,7 @@ void check_unsat_and_tauto(PETask_p task, TB_p tmp_terms)
    SatClauseSetFree(environment);
    PStackFree(unsat_core);
    SubstDelete(subst);
-   picosat_reset(solver);
+   SatSolverFree(solver);
    EqnFree(fresh_lit);
 }
 
@@ -994,7 +1008,9 @@ void build_task_queue(ClauseSet_p passive, const HeuristicParms_p parms,
    assert(sym_map);
    assert(task_queue);
 
-   for(Clause_p cl = passive->anchor->succ; cl!=passive->anchor; cl = cl->succ)
+   for(Clause_p cl = ClauseSucc(passive->anchor);
+       cl!=passive->anchor;
+       cl = ClauseSucc(cl))
    {
       scan_clause_for_predicates(cl, sym_map, task_queue, parms->pred_elim_max_occs,
                                  parms->pred_elim_gates, parms->use_tptp_sos,
@@ -1329,11 +1345,153 @@ bool measure_decreases(PETask_p task, PStack_p new_cls, int tolerance,
                             : mu_decrease || lit_cl_decrease;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: compute_resolvents()
+//
+//   Compute all the clauses that would replace the clauses containing
+//   the symbol of the task and push them onto cls.
+//
+// Global Variables: -
+//
+// Side Effects    : Intermediary clauses of gate elimination are
+//                   moved to archive.
+//
+/----------------------------------------------------------------------*/
+
+void compute_resolvents(PETask_p task, PStack_p cls, ResolverFun_p resolver,
+                        TB_p tmp_bank, VarBank_p freshvars, ClauseSet_p archive)
+{
+   if(task->g_status == IS_GATE)
+   {
+      try_gate_elimination(task, cls, tmp_bank, freshvars, archive);
+   }
+   else
+   {
+      assert(!task->offending_cls->card);
+      try_singular_elimination(task, cls, resolver, tmp_bank);
+   }
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: check_pe_batch_task()
+//
+//   ForkMapLong() callback: Decide if eliminating the symbol of the
+//   idx-th task of the batch decreases the measure. Returns 1 if yes,
+//   0 otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : As compute_resolvents() (in the worker's copy)
+//
+/----------------------------------------------------------------------*/
+
+long check_pe_batch_task(void* data, long idx)
+{
+   PEBatch_p batch = data;
+   PETask_p  task = PStackElementP(batch->tasks, idx);
+   PStack_p  cls = PStackAlloc();
+   bool      res;
+
+   compute_resolvents(task, cls, batch->resolver, batch->tmp_bank,
+                      batch->freshvars, batch->archive);
+   res = measure_decreases(task, cls, batch->parms->pred_elim_tolerance,
+                           batch->parms->pred_elim_force_mu_decrease);
+   while(!PStackEmpty(cls))
+   {
+      ClauseFree(PStackPopP(cls));
+   }
+   PStackFree(cls);
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: task_independent()
+//
+//   Return true if none of the clauses of the task is in occupied. In
+//   this case, the clauses of the task are added to occupied.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool task_independent(PETask_p task, PTree_p* occupied)
+{
+   PStack_p all_cls = PStackAlloc();
+   bool res = true;
+
+   PTreeToPStack(all_cls, task->pos_gates->set);
+   PTreeToPStack(all_cls, task->neg_gates->set);
+   PTreeToPStack(all_cls, task->positive_singular->set);
+   PTreeToPStack(all_cls, task->negative_singular->set);
+   PTreeToPStack(all_cls, task->offending_cls->set);
+
+   for(PStackPointer i=0; res && i<PStackGetSP(all_cls); i++)
+   {
+      res = !PTreeFind(occupied, PStackElementP(all_cls, i));
+   }
+   if(res)
+   {
+      PStackToPTree(occupied, all_cls);
+   }
+   PStackFree(all_cls);
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: collect_batch()
+//
+//   Pop up to limit tasks from the queue, in queue order, such that no
+//   two of them share a clause. Eliminating one of these symbols then
+//   does not change the tasks of the others (clauses containing both
+//   symbols would occur in both tasks), so they can be evaluated
+//   concurrently. The first conflicting task is returned to the queue.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the queue
+//
+/----------------------------------------------------------------------*/
+
+void collect_batch(MinHeap_p task_queue, PStack_p batch, long limit)
+{
+   PTree_p occupied = NULL;
+
+   while(MinHeapSize(task_queue) && PStackGetSP(batch) < limit)
+   {
+      PETask_p task = MinHeapPopMinP(task_queue);
+      if(task->size == TASK_BLOCKED)
+      {
+         continue;
+      }
+      if(!task_independent(task, &occupied))
+      {
+         MinHeapAddP(task_queue, task);
+         break;
+      }
+      task->last_check_num_lit = task->num_lit;
+      task->last_check_sq_vars = task->sq_vars;
+      PStackPushP(batch, task);
+   }
+   PTreeFree(occupied);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: eliminate_predicates()
 //
-//   Driver that does actual predicate elimination.
+//   Driver that does actual predicate elimination. Tasks are taken
+//   from the queue in batches of up to PE_BATCH_FACTOR*workers
+//   independent tasks. Whether elimination pays off is decided by
+//   forked workers, successful eliminations are then redone and
+//   committed sequentially in queue order, so that the result is
+//   deterministic. With a single worker, tasks are processed one by
+//   one.
 //
 // Global Variables: -
 //
@@ -1348,52 +1506,64 @@ void eliminate_predicates(ClauseSet_p passive, ClauseSet_p archive,
                           const HeuristicParms_p parms, VarBank_p freshvars)
 {
    PStack_p cls = PStackAlloc();
+   int workers = MAX(parms->elim_workers, 1);
+   long batch_limit = workers > 1 ? PE_BATCH_FACTOR*workers : 1;
+   long *decisions = SizeMalloc(batch_limit*sizeof(long));
+   PEBatchCell batch = {PStackAlloc(), resolver, parms,
+                        tmp_bank, freshvars, archive};
+   bool batch_checked;
+
    while(MinHeapSize(task_queue))
    {
-      PETask_p task = MinHeapPopMinP(task_queue);
-      // DBG_PRINT(stderr, "chosen task:\n", dbg_print(stderr, tmp_bank->sig, task), ".\n");
-      task->last_check_num_lit = task->num_lit;
-      task->last_check_sq_vars = task->sq_vars;
-      if(task->size == TASK_BLOCKED)
+      PStackReset(batch.tasks);
+      collect_batch(task_queue, batch.tasks, batch_limit);
+      batch_checked = PStackGetSP(batch.tasks) > 1;
+      if(batch_checked)
       {
-         continue;
+         ForkMapLong(PStackGetSP(batch.tasks), workers, check_pe_batch_task,
+                     &batch, decisions);
       }
 
-      if(task->g_status == IS_GATE)
-      {
-         try_gate_elimination(task, cls, tmp_bank, freshvars, archive);
-      }
-      else
+      for(PStackPointer i=0; i<PStackGetSP(batch.tasks); i++)
       {
-         assert(!task->offending_cls->card);
-         try_singular_elimination(task, cls, resolver, tmp_bank);
-      }
+         PETask_p task = PStackElementP(batch.tasks, i);
+         // DBG_PRINT(stderr, "chosen task:\n", dbg_print(stderr, tmp_bank->sig, task), ".\n");
+         if(task->size == TASK_BLOCKED || (batch_checked && !decisions[i]))
+         {
+            continue;
+         }
 
-      if(measure_decreases(task, cls, parms->pred_elim_tolerance,
-                           parms->pred_elim_force_mu_decrease))
-      {
-         // DBG_PRINT(stderr, "removal successful:\n", dbg_print(stderr, tmp_bank->sig, task), ".\n");
-         remove_clauses_from_state(task, sym_map, task_queue, archive);
-         while(!PStackEmpty(cls))
+         compute_resolvents(task, cls, resolver, tmp_bank, freshvars, archive);
+
+         if(measure_decreases(task, cls, parms->pred_elim_tolerance,
+                              parms->pred_elim_force_mu_decrease))
          {
-            Clause_p cl = PStackPopP(cls);
-            // DBG_PRINT(stderr, "|> ", ClausePrint(stderr, cl, true), "; ");
-            ClauseNormalizeVars(cl, freshvars);
-            EqnListMapTerms(cl->literals, reassign_vars, bank);
-            ClauseSetInsert(passive, cl);
-            react_clause_added(cl, sym_map, task_queue, parms->pred_elim_max_occs);
+            // DBG_PRINT(stderr, "removal successful:\n", dbg_print(stderr, tmp_bank->sig, task), ".\n");
+            remove_clauses_from_state(task, sym_map, task_queue, archive);
+            while(!PStackEmpty(cls))
+            {
+               Clause_p cl = PStackPopP(cls);
+               // DBG_PRINT(stderr, "|> ", ClausePrint(stderr, cl, true), "; ");
+               ClauseNormalizeVars(cl, freshvars);
+               EqnListMapTerms(cl->literals, reassign_vars, bank);
+               ClauseSetInsert(passive, cl);
+               react_clause_added(cl, sym_map, task_queue, parms->pred_elim_max_occs);
+            }
+            // fprintf(stderr, "\n");
          }
-         // fprintf(stderr, "\n");
-      }
-      else
-      {
-         while(!PStackEmpty(cls))
+         else
          {
-            ClauseFree(PStackPopP(cls));
+            assert(!batch_checked);
+            while(!PStackEmpty(cls))
+            {
+               ClauseFree(PStackPopP(cls));
+            }
          }
+         PStackReset(cls);
       }
-      PStackReset(cls);
    }
+   PStackFree(batch.tasks);
+   SizeFree(decisions, batch_limit*sizeof(long));
    PStackFree(cls);
 }
 
@@ -1409,7 +1579,9 @@ void eliminate_predicates(ClauseSet_p passive, ClauseSet_p archive,
 //   Does the elimination of predicate symbols by moving clauses with the
 //   eliminated symbol from passive to archive. New clauses are added to
 //   passive (with appropriately set proof object). Tracking a predicate
-//   symbol will be stopped after it reaches max_occs occurrences.
+//   symbol will be stopped after it reaches max_occs occurrences. With
+//   parms->elim_workers > 1, independent symbols are checked
+//   concurrently by forked workers.
 //
 // Global Variables: -
 //
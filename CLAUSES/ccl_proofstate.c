@@ -56,7 +56,9 @@ static void clause_set_analyse_gc(ClauseSet_p set, unsigned long *clause_count,
    Clause_p handle;
    unsigned long clause_c = 0, gc_c = 0, gc_used_c = 0;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle != set->anchor;
+       handle = ClauseSucc(handle))
    {
       clause_c++;
       if(ClauseIsEvalGC(handle))
@@ -98,7 +100,9 @@ static void clause_set_pick_training_examples(ClauseSet_p set,
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor);
+       handle != set->anchor;
+       handle = ClauseSucc(handle))
    {
       if(ClauseIsEvalGC(handle))
       {
@@ -166,6 +170,9 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
    handle->eval_store           = ClauseSetAlloc();
    handle->archive              = ClauseSetAlloc();
    handle->watchlist            = ClauseSetAlloc();
+   handle->wladmin              = NULL;
+   handle->ground_cc            = NULL;
+   handle->nf_cache             = NULL;
    handle->f_archive            = FormulaSetAlloc();
    handle->extract_roots        = PStackAlloc();
    GlobalIndicesNull(&(handle->gindices));
@@ -270,7 +277,10 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
 // Function: ProofStateLoadWatchlist()
 //
 //   Load the watchlist (if requested and not inline), remove it if
-//   not requested.
+//   not requested. watchlist_files contains the names of all
+//   watchlist files (and UseInlinedWatchList if the input contains
+//   watchlist clauses), their clauses are merged into a single
+//   watchlist.
 //
 // Global Variables: -
 //
@@ -279,23 +289,29 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
 /----------------------------------------------------------------------*/
 
 void ProofStateLoadWatchlist(ProofState_p state,
-                             char* watchlist_filename,
+                             PStack_p watchlist_files,
                              IOFormat parse_format)
 {
-   Scanner_p in;
+   Scanner_p     in;
+   PStackPointer i;
+   char*         name;
 
    assert(state->watchlist);
 
-   if(watchlist_filename)
+   if(watchlist_files && !PStackEmpty(watchlist_files))
    {
-      if(watchlist_filename!=UseInlinedWatchList)
+      for(i=0; i<PStackGetSP(watchlist_files); i++)
       {
-         in = CreateScanner(StreamTypeFile, watchlist_filename, true, NULL, true);
-         ScannerSetFormat(in, parse_format);
-         ClauseSetParseList(in, state->watchlist,
-                            state->terms);
-         CheckInpTok(in, NoToken);
-         DestroyScanner(in);
+         name = PStackElementP(watchlist_files, i);
+         if(name!=UseInlinedWatchList)
+         {
+            in = CreateScanner(StreamTypeFile, name, true, NULL, true);
+            ScannerSetFormat(in, parse_format);
+            ClauseSetParseList(in, state->watchlist,
+                               state->terms);
+            CheckInpTok(in, NoToken);
+            DestroyScanner(in);
+         }
       }
       ClauseSetSetTPTPType(state->watchlist, CPTypeWatchClause);
       ClauseSetSetProp(state->watchlist, CPWatchOnly);
@@ -303,7 +319,7 @@ void ProofStateLoadWatchlist(ProofState_p state,
       ClauseSetSortLiterals(state->watchlist, EqnSubsumeInverseCompareRef);
       ClauseSetDocInital(GlobalOut, OutputLevel, state->watchlist);
    }
-   else if(!watchlist_filename)
+   else
    {
       GCDeregisterClauseSet(state->terms->gc, state->watchlist);
       ClauseSetFree(state->watchlist);
@@ -344,6 +360,10 @@ void ProofStateInitWatchlist(ProofState_p state, OCB_p ocb)
       ClauseSetIndexedInsertClauseSet(state->watchlist, tmpset);
       ClauseSetFree(tmpset);
       GlobalIndicesInsertClauseSet(&(state->wlindices),state->watchlist, false);
+      if(!state->wladmin)
+      {
+         state->wladmin = WatchlistAdminAlloc(state->watchlist);
+      }
       // ClauseSetPrint(stdout, state->watchlist, true);
    }
 }
@@ -385,6 +405,11 @@ void ProofStateResetClauseSets(ProofState_p state, bool term_gc)
       ClauseSetFreeClauses(state->watchlist);
       GlobalIndicesReset(&(state->wlindices));
    }
+   if(state->wladmin)
+   {
+      WatchlistAdminFree(state->wladmin);
+      state->wladmin = NULL;
+   }
    if(term_gc)
    {
       TBGCCollect(state->terms);
@@ -429,6 +454,19 @@ void ProofStateFree(ProofState_p junk)
       ClauseSetFree(junk->watchlist);
    }
    GlobalIndicesFreeIndices(&(junk->wlindices));
+   if(junk->wladmin)
+   {
+      WatchlistAdminFree(junk->wladmin);
+   }
+   if(junk->ground_cc)
+   {
+      GroundCCFree(junk->ground_cc);
+   }
+   if(junk->nf_cache)
+   {
+      TBGCDeregisterNFCache(junk->terms, junk->nf_cache);
+      NFCacheFree(junk->nf_cache);
+   }
 
    DefStoreFree(junk->definition_store);
    if(junk->fvi_cspec)
@@ -684,6 +722,22 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
    fprintf(out,
            "# Current number of archived clauses   : %ld\n",
            state->archive->members);
+   if(state->wladmin)
+   {
+      WatchlistAdminPrintStatistics(out, state->wladmin);
+   }
+   if(state->ground_cc)
+   {
+      GroundCCPrintStatistics(out, state->ground_cc);
+   }
+   if(state->nf_cache)
+   {
+      NFCachePrintStatistics(out, state->nf_cache);
+   }
+   if(state->processed_non_units->csr_index)
+   {
+      CSRIndexPrintStatistics(out, state->processed_non_units->csr_index);
+   }
    if(ProofObjectRecordsGCSelection)
    {
       fprintf(out,
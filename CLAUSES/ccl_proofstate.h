@@ -29,6 +29,7 @@
 #include <ccl_def_handling.h>
 #include <ccl_garbage_coll.h>
 #include <ccl_global_indices.h>
+#include <ccl_watchlist.h>
 #include <picosat.h>
 
 /*---------------------------------------------------------------------*/
@@ -69,6 +70,9 @@ typedef struct proofstatecell
                                      processed_pos_eqns */
    ClauseSet_p   watchlist;
    GlobalIndices wlindices;
+   WatchlistAdmin_p wladmin;      /* Prefilter and statistics */
+   GroundCC_p    ground_cc;       /* Ground units of processed_pos_* */
+   NFCache_p     nf_cache;        /* Demodulation with processed_pos_* */
    bool          state_is_complete;
    bool          has_interpreted_symbols;
    DefStore_p    definition_store;
@@ -142,7 +146,7 @@ typedef enum
 
 ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop);
 void         ProofStateLoadWatchlist(ProofState_p state,
-                                     char* watchlist_filename,
+                                     PStack_p watchlist_files,
                                      IOFormat parse_format);
 
 
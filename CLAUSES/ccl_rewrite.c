@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Creates: Tue May 26 19:47:52 MET DST 1998
+  Mon Oct 19 03:02:51 CEST 2026: Backward rewriting with path index
 
   -----------------------------------------------------------------------*/
 
@@ -452,8 +453,8 @@ static bool find_rewritable_clauses(OCB_p ocb, ClauseSet_p set,
    assert(new_demod->pos_lit_no == 1);
    assert(new_demod->neg_lit_no == 0);
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
    {
       tmp = clause_is_rewritable(ocb, handle, new_demod, nf_date);
       if(tmp)
@@ -730,6 +731,39 @@ static Term_p rewrite_with_clause_setlist(OCB_p ocb, TB_p bank, Term_p term,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: term_top_is_normal()
+//
+//   Return true if the normal form cache shows that none of the
+//   demodulators the term has not yet been tried with applies at its
+//   top position.
+//
+// Global Variables: -
+//
+// Side Effects    : Updates cache statistics
+//
+/----------------------------------------------------------------------*/
+
+static bool term_top_is_normal(RWDesc_p desc, Term_p term)
+{
+   SysDate date;
+
+   if(!desc->nf_cache)
+   {
+      return false;
+   }
+   date = TermNFDate(term, RewriteAdr(desc->level));
+   if(!SysDateIsEarlier(date, desc->demod_date) ||
+      !NFCacheTopIsNormal(desc->nf_cache, term, date))
+   {
+      return false;
+   }
+   desc->nf_cache->top_skips++;
+   return true;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: term_subterm_rewrite()
@@ -826,11 +860,14 @@ static Term_p term_li_normalform(RWDesc_p desc, Term_p term,
          }
          else
          {
-            rewrite_with_clause_setlist(desc->ocb, desc->bank,
-                                        term, desc->demods,
-                                        desc->level,
-                                        desc->prefer_general,
-                                        restricted_rw&&(!modified));
+            if(!term_top_is_normal(desc, term))
+            {
+               rewrite_with_clause_setlist(desc->ocb, desc->bank,
+                                           term, desc->demods,
+                                           desc->level,
+                                           desc->prefer_general,
+                                           restricted_rw&&(!modified));
+            }
             new_term = term_follow_top_RW_chain(term, desc, restricted_rw&&(!modified));
          }
          if(term != new_term)
@@ -858,6 +895,60 @@ static Term_p term_li_normalform(RWDesc_p desc, Term_p term,
    return term;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: term_cached_li_normalform()
+//
+//   Compute a leftmost-innermost normal form of term as
+//   term_li_normalform(), but start from a normal form remembered in
+//   the normal form cache (if any), and remember the result.
+//
+// Global Variables: RewriteSuccesses
+//
+// Side Effects    : Changes terms, updates nf_date and the cache.
+//
+/----------------------------------------------------------------------*/
+
+static Term_p term_cached_li_normalform(RWDesc_p desc, Term_p term,
+                                        bool restricted_rw,
+                                        bool lambda_demod)
+{
+   NFCache_p cache = desc->nf_cache;
+   NFMemo_p  entry;
+   Term_p    start = term, res;
+   long      steps = 0, old_successes = RewriteSuccesses;
+   bool      sos = false, old_sos = desc->sos_rewritten;
+
+   /* Restricted rewriting may stop early, so its results are neither
+      used nor remembered */
+   if(!cache || restricted_rw || (desc->level == NoRewrite) ||
+      TermIsFreeVar(term))
+   {
+      return term_li_normalform(desc, term, restricted_rw, lambda_demod);
+   }
+   entry = NFCacheLookup(cache, term, desc->level);
+   if(entry)
+   {
+      start = entry->nf;
+      steps = entry->steps;
+      sos   = entry->sos;
+   }
+   NFCacheRevalidate(cache, start, desc->level, desc->demod_date);
+
+   desc->sos_rewritten = false;
+   res = term_li_normalform(desc, start, false, lambda_demod);
+   sos = sos || desc->sos_rewritten;
+   desc->sos_rewritten = old_sos || sos;
+
+   if(res != term)
+   {
+      NFCacheStore(cache, term, res, desc->level,
+                   steps+(RewriteSuccesses-old_successes), sos);
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: eqn_li_normalform()
@@ -880,8 +971,8 @@ EqnSide eqn_li_normalform(RWDesc_p desc, ClausePos_p pos,
       EqnIsOriented(eqn) && interred_rw;
    EqnSide res = NoSide;
 
-   eqn->lterm =  term_li_normalform(desc, eqn->lterm, 
-                                    restricted_rw, lambda_demod);
+   eqn->lterm =  term_cached_li_normalform(desc, eqn->lterm,
+                                           restricted_rw, lambda_demod);
    if(l_old!=eqn->lterm)
    {
       EqnDelProp(eqn, EPMaxIsUpToDate);
@@ -895,7 +986,8 @@ EqnSide eqn_li_normalform(RWDesc_p desc, ClausePos_p pos,
       TermComputeRWSequence(pos->clause->derivation,
                             l_old, ClausePosGetSide(pos), DCRewrite);
    }
-   eqn->rterm = term_li_normalform(desc, eqn->rterm, false, lambda_demod);
+   eqn->rterm = term_cached_li_normalform(desc, eqn->rterm, false,
+                                          lambda_demod);
    if(r_old!=eqn->rterm)
    {
       if(EqnQueryProp(eqn, EPIsEquLiteral) && eqn->rterm == eqn->bank->true_term)
@@ -952,6 +1044,7 @@ static __inline__ RWDesc_p rw_desc_cell_alloc(OCB_p ocb, TB_p bank,
    desc->demod_date     = ClauseSetListGetMaxDate(demodulators, level);
    desc->level          = level;
    desc->prefer_general = prefer_general;
+   desc->nf_cache       = ClauseSetListGetNFCache(demodulators, level, bank);
    desc->sos_rewritten  = false;
 
    return desc;
@@ -1122,7 +1215,9 @@ static long tree_find_rw_clauses(Clause_p demod,
 // Function: find_rewritable_clauses_indexed()
 //
 //   Push all clauses in index that are rewritable with lterm->rterm
-//   onto stack. Return true if there is at least one.
+//   onto stack. Return true if there is at least one. If paths is
+//   given, the candidate terms are retrieved from it and only
+//   looked up in index.
 //
 // Global Variables: -
 //
@@ -1137,6 +1232,7 @@ static long tree_find_rw_clauses(Clause_p demod,
 static long find_rewritable_clauses_indexed(Clause_p demod,
                                             OCB_p ocb,
                                             SubtermIndex_p index,
+                                            PathIndex_p paths,
                                             PStack_p stack,
                                             Term_p lterm,
                                             Term_p rterm,
@@ -1146,7 +1242,21 @@ static long find_rewritable_clauses_indexed(Clause_p demod,
    long          res = 0;
    PStack_p      termtrees = PStackAlloc();
    SubtermTree_p tree;
+   SubtermOcc_p  termocc;
 
+   if(paths)
+   {
+      PathIndexFindInstances(paths, lterm, termtrees);
+      while(!PStackEmpty(termtrees))
+      {
+         termocc = SubtermIndexFindTerm(index, PStackPopP(termtrees));
+         assert(termocc);
+         res += term_find_rw_clauses(demod, ocb, termocc, stack,
+                                     lterm, rterm, oriented, nf_date);
+      }
+      PStackFree(termtrees);
+      return res;
+   }
    FPIndexFindMatchable(index, lterm, termtrees);
 
    while(!PStackEmpty(termtrees))
@@ -1190,7 +1300,7 @@ Term_p TermComputeLINormalform(OCB_p ocb, TB_p bank, Term_p term,
    RWDesc_p desc = rw_desc_cell_alloc(ocb, bank, demodulators, level,
                                       prefer_general);
 
-   res = term_li_normalform(desc, term, restricted_rw, lambda_demod);
+   res = term_cached_li_normalform(desc, term, restricted_rw, lambda_demod);
    RWDescCellFree(desc);
    return res;
 }
@@ -1294,8 +1404,8 @@ long ClauseSetComputeLINormalform(OCB_p ocb, TB_p bank, ClauseSet_p
 
    assert(demodulators);
 
-   for(handle=set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle=ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       tmp = ClauseComputeLINormalform(ocb, bank,
                                       handle,
@@ -1344,8 +1454,8 @@ bool FindRewritableClauses(OCB_p ocb, ClauseSet_p set,
 // Function: FindRewritableClausesIndexed()
 //
 //   New version - find all clauses that are rewritable with
-//   new_demod using the subterm index. Returns true if any rewritable
-//   clause was found.
+//   new_demod using the subterm index (and the path index paths, if
+//   given). Returns true if any rewritable clause was found.
 //
 // Global Variables: -
 //
@@ -1355,6 +1465,7 @@ bool FindRewritableClauses(OCB_p ocb, ClauseSet_p set,
 /----------------------------------------------------------------------*/
 
 long FindRewritableClausesIndexed(OCB_p ocb, SubtermIndex_p index,
+                                  PathIndex_p paths,
                                   PStack_p stack, Clause_p new_demod,
                                   SysDate nf_date)
 {
@@ -1364,7 +1475,7 @@ long FindRewritableClausesIndexed(OCB_p ocb, SubtermIndex_p index,
    assert(ClauseIsDemodulator(new_demod));
 
    res = find_rewritable_clauses_indexed(new_demod,
-                                         ocb, index,
+                                         ocb, index, paths,
                                          stack,
                                          eqn->lterm,
                                          eqn->rterm,
@@ -1373,7 +1484,7 @@ long FindRewritableClausesIndexed(OCB_p ocb, SubtermIndex_p index,
    if(!EqnIsOriented(eqn))
    {
       res += find_rewritable_clauses_indexed(new_demod,
-                                             ocb, index,
+                                             ocb, index, paths,
                                              stack,
                                              eqn->rterm,
                                              eqn->lterm,
@@ -45,6 +45,7 @@ typedef struct rw_desc_cell
    SysDate      demod_date;
    RewriteLevel level;
    bool         prefer_general;
+   NFCache_p    nf_cache;      /* Optional */
    bool         sos_rewritten; /* Return value! */
 }RWDescCell, *RWDesc_p;
 
@@ -89,6 +90,7 @@ bool FindRewritableClauses(OCB_p ocb, ClauseSet_p set,
             new_demod, SysDate nf_date);
 
 long FindRewritableClausesIndexed(OCB_p ocb, SubtermIndex_p index,
+                                  PathIndex_p paths,
                                   PStack_p stack, Clause_p new_demod,
                                   SysDate nf_date);
 
@@ -16,6 +16,8 @@
   Run "eprover -h" for contact information.
 
   Created: Sat Sep 16 16:52:43 CEST 2017
+  Mon Oct 19 00:41:26 CEST 2026: Built-in CDCL solver as alternative
+  backend
 
   -----------------------------------------------------------------------*/
 
@@ -45,6 +47,16 @@ char* GroundingStratNames[] =
    NULL
 };
 
+char* SatSolverNames[] =
+{
+   "PicoSAT",
+   "CDCL",
+   NULL
+};
+
+/* Solver used for ground checks */
+SatSolverType SatSolverDefault = SatPicoSAT;
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -376,20 +388,125 @@ void export_to_solver(SatSolver_p solver, SatClauseSet_p set, SatClauseFilter fi
       clause = PStackElementP(set->set, i);
       if(filter == NULL || filter(clause))
       {
-         picosat_add_lits(solver, clause->literals);
+         if(solver->type == SatCDCL)
+         {
+            CDCLAddLits(solver->cdcl, clause->literals);
+         }
+         else
+         {
+            picosat_add_lits(solver->picosat, clause->literals);
+         }
          PStackPushP(set->exported, clause);
       }
    }
-   if(PStackGetSP(set->exported) != picosat_added_original_clauses(solver))
+   if(PStackGetSP(set->exported) !=
+      ((solver->type == SatCDCL)?
+       CDCLOriginalClauses(solver->cdcl):
+       picosat_added_original_clauses(solver->picosat)))
    {
-      Error("PicoSAT communication is broken.", INTERFACE_ERROR);
+      Error("SAT solver communication is broken.", INTERFACE_ERROR);
    }
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_solve()
+//
+//   Run the solver with the given decision limit (-1 for no limit)
+//   and return the PicoSAT result code.
+//
+// Global Variables: -
+//
+// Side Effects    : Runs the SAT solver
+//
+/----------------------------------------------------------------------*/
+
+static int sat_solve(SatSolver_p solver, int decision_limit)
+{
+   if(solver->type == SatCDCL)
+   {
+      switch(CDCLSolve(solver->cdcl, decision_limit))
+      {
+      case CDCL_SATISFIABLE:
+            return PICOSAT_SATISFIABLE;
+      case CDCL_UNSATISFIABLE:
+            return PICOSAT_UNSATISFIABLE;
+      default:
+            return PICOSAT_UNKNOWN;
+      }
+   }
+   return picosat_sat(solver->picosat, decision_limit);
+}
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: SatSolverAlloc()
+//
+//   Create a SAT solver of the given type, with the trace generation
+//   needed for unsatisfiable cores enabled.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SatSolver_p SatSolverAlloc(SatSolverType type)
+{
+   SatSolver_p handle = SatSolverCellAlloc();
+
+   handle->type    = type;
+   handle->picosat = NULL;
+   handle->cdcl    = NULL;
+   if(type == SatCDCL)
+   {
+      handle->cdcl = CDCLSolverAlloc();
+      CDCLEnableTrace(handle->cdcl);
+   }
+   else
+   {
+      handle->picosat = picosat_init();
+#ifndef NDEBUG
+      int status =
+#endif
+      picosat_enable_trace_generation(handle->picosat);
+      assert(status);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatSolverFree()
+//
+//   Free a SAT solver.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SatSolverFree(SatSolver_p junk)
+{
+   if(junk->cdcl)
+   {
+      CDCLSolverFree(junk->cdcl);
+   }
+   if(junk->picosat)
+   {
+      picosat_reset(junk->picosat);
+   }
+   SatSolverCellFree(junk);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SatClauseAlloc()
@@ -635,9 +752,9 @@ long SatClauseSetImportClauseSet(SatClauseSet_p satset, ClauseSet_p set)
    assert(set);
    int added = 0;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle != set->anchor;
-       handle = handle->succ, added++)
+       handle = ClauseSucc(handle), added++)
    {
       if(!SatClauseCreateAndStore(handle, satset))
       {
@@ -1012,7 +1129,9 @@ long sat_extract_core(SatClauseSet_p satset, PStack_p core, SatSolver_p solver)
 
    for(long id=0; id<nr_exported; id++)
    {
-      if(picosat_coreclause(solver, id))
+      if((solver->type == SatCDCL)?
+         CDCLCoreClause(solver->cdcl, id):
+         picosat_coreclause(solver->picosat, id))
       {
          res++;
          satclause = PStackElementP(satset->exported, id);
@@ -1048,7 +1167,7 @@ ProverResult SatClauseSetCheckUnsat(SatClauseSet_p satset, Clause_p *empty,
    SatClauseSetExportToSolverNonPure(solver, satset);
 
    //printf("# XXXXX Decision level: %d\n", sat_check_decision_limit);
-   solverres = picosat_sat(solver, sat_check_decision_limit);
+   solverres = sat_solve(solver, sat_check_decision_limit);
    //printf("# YYYYY Solver done\n");
 
    switch(solverres)
@@ -1102,7 +1221,7 @@ bool SatClauseSetCheckAndGetCore(SatClauseSet_p satset,
 {
    SatClauseSetMarkPure(satset);
    SatClauseSetExportToSolverNonPure(solver, satset);
-   int solverres = picosat_sat(solver, 10000);
+   int solverres = sat_solve(solver, 10000);
    if(solverres == PICOSAT_UNSATISFIABLE)
    {
       sat_extract_core(satset, unsat_core, solver);
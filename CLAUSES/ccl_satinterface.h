@@ -18,6 +18,8 @@
   Changes
 
   Created: Fri Sep 15 20:29:49 CEST 2017
+  Mon Oct 19 00:41:26 CEST 2026: Built-in CDCL solver as alternative
+  backend
 
   -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@
 #include <ccl_proofstate.h>
 #include <cio_tempfile.h>
 #include <picosat.h>
+#include <cpr_cdcl.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -70,13 +73,33 @@ typedef enum
 }GroundingStrategy;
 
 typedef bool (*SatClauseFilter)(SatClause_p);
-typedef PicoSAT* SatSolver_p;
+
+typedef enum
+{
+   SatPicoSAT,
+   SatCDCL      /* Built-in solver from cpr_cdcl.h */
+}SatSolverType;
+
+typedef struct satsolvercell
+{
+   SatSolverType type;
+   PicoSAT       *picosat;
+   CDCLSolver_p  cdcl;
+}SatSolverCell, *SatSolver_p;
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
 extern char* GroundingStratNames[];
+extern char* SatSolverNames[];
+extern SatSolverType SatSolverDefault;
+
+#define SatSolverCellAlloc()    (SatSolverCell*)SizeMalloc(sizeof(SatSolverCell))
+#define SatSolverCellFree(junk) SizeFree(junk, sizeof(SatSolverCell))
+
+SatSolver_p SatSolverAlloc(SatSolverType type);
+void        SatSolverFree(SatSolver_p junk);
 
 #define SatClauseCellAlloc()    (SatClauseCell*)SizeMalloc(sizeof(SatClauseCell))
 #define SatClauseCellFree(junk) SizeFree(junk, sizeof(SatClauseCell))
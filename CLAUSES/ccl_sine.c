@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Jul  2 01:15:26 CEST 2010
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    Shared evaluation of several GSinE filters (SineIndex)
 
 -----------------------------------------------------------------------*/
 
@@ -39,6 +41,367 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: sine_gen_cmp()
+//
+//   Compare two generalities stored in a PStack.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int sine_gen_cmp(const void *g1, const void *g2)
+{
+   const IntOrP* v1 = (const IntOrP*) g1;
+   const IntOrP* v2 = (const IntOrP*) g2;
+
+   return CMP(v1->i_val, v2->i_val);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_gen_limit()
+//
+//   Return the largest generality of a symbol that is in the
+//   D-relation of the axiom with number ax for the given parameters,
+//   or -1 if the axiom has no symbols. This is the limit computed by
+//   ClauseComputeDRel()/FormulaComputeDRel().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long sine_gen_limit(SineIndex_p index, long ax,
+                           double benevolence, long generosity)
+{
+   PStackPointer start = PStackElementInt(index->gen_start, ax);
+   long          size  = PStackElementInt(index->gen_start, ax+1)-start;
+   long          gen_limit, aux_gen_limit;
+
+   if(!size)
+   {
+      return -1;
+   }
+   gen_limit = PStackElementInt(index->gens, start)*benevolence;
+   if(generosity >= size)
+   {
+      generosity = size-1;
+   }
+   aux_gen_limit = PStackElementInt(index->gens, start+generosity);
+
+   return MIN(gen_limit, aux_gen_limit);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_add_entry()
+//
+//   Record that the axiom with number ax may be in the D-relation of
+//   f_code, decided by generality gen.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_add_entry(SineIndex_p index, FunCode f_code,
+                                 long ax, long gen)
+{
+   PStack_p entries = PDArrayElementP(index->drel, f_code);
+
+   if(!entries)
+   {
+      entries = PStackAlloc();
+      PDArrayAssignP(index->drel, f_code, entries);
+   }
+   PStackPushInt(entries, ax);
+   PStackPushInt(entries, gen);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_add_axiom()
+//
+//   Add an axiom with the distinct symbols in symbol_stack (and the
+//   forced defined symbol, or -1) to the index. Resets the
+//   corresponding entries in the f_distrib scratch array and empties
+//   symbol_stack.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_add_axiom(SineIndex_p index, void* axiom,
+                                 PStack_p symbol_stack, FunCode forced,
+                                 PStack_p sort_stack)
+{
+   long          ax = PStackGetSP(index->axioms);
+   long          gen, gen_limit;
+   FunCode       f_code;
+   PStackPointer sp;
+   Sig_p         sig = index->generality->sig;
+
+   PStackPushP(index->axioms, axiom);
+   PStackPushInt(index->forced, forced);
+   for(sp=0; sp<PStackGetSP(symbol_stack); sp++)
+   {
+      f_code = PStackElementInt(symbol_stack, sp);
+      PStackPushInt(index->symbols, f_code);
+      if(f_code >= sig->internal_symbols)
+      {
+         PStackPushInt(sort_stack,
+                       GenDistribGenerality(index->generality,
+                                            index->gen_measure,
+                                            f_code));
+      }
+   }
+   PStackPushInt(index->sym_start, PStackGetSP(index->symbols));
+   PStackSort(sort_stack, sine_gen_cmp);
+   PStackPushStack(index->gens, sort_stack);
+   PStackPushInt(index->gen_start, PStackGetSP(index->gens));
+
+   gen_limit = sine_gen_limit(index, ax,
+                              index->max_benevolence,
+                              index->max_generosity);
+   for(sp=0; sp<PStackGetSP(symbol_stack); sp++)
+   {
+      f_code = PStackElementInt(symbol_stack, sp);
+      if(f_code >= sig->internal_symbols && f_code != forced)
+      {
+         gen = GenDistribGenerality(index->generality,
+                                    index->gen_measure,
+                                    f_code);
+         if(gen <= gen_limit)
+         {
+            sine_index_add_entry(index, f_code, ax, gen);
+         }
+      }
+      index->generality->f_distrib[f_code] = 0;
+   }
+   if(forced != -1)
+   {
+      sine_index_add_entry(index, forced, ax, -1);
+   }
+   else if(PStackEmpty(sort_stack))
+   {
+      sine_index_add_entry(index, 0, ax, LONG_MAX);
+   }
+   else
+   {
+      gen = PStackElementInt(sort_stack, 0);
+      if(gen > sine_gen_limit(index, ax, index->min_benevolence, 0))
+      {
+         sine_index_add_entry(index, 0, ax, gen);
+      }
+   }
+   PStackReset(symbol_stack);
+   PStackReset(sort_stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_in_drel()
+//
+//   Return true if the entry (ax, gen) for f_code is part of the
+//   D-relation described by benevolence and generosity (for f_code 0:
+//   if the D-relation of the axiom is empty).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool sine_index_in_drel(SineIndex_p index, FunCode f_code,
+                               long ax, long gen,
+                               double benevolence, long generosity)
+{
+   long gen_limit = sine_gen_limit(index, ax, benevolence, generosity);
+
+   if(f_code)
+   {
+      return gen <= gen_limit;
+   }
+   return gen > gen_limit;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_push_axiom()
+//
+//   Push the axiom with number ax onto the proper result stack.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_push_axiom(SineIndex_p index, long ax,
+                                  PStack_p res_clauses,
+                                  PStack_p res_formulas)
+{
+   if(ax < index->clause_no)
+   {
+      PStackPushP(res_clauses, PStackElementP(index->axioms, ax));
+   }
+   else
+   {
+      PStackPushP(res_formulas, PStackElementP(index->axioms, ax));
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_find_seeds()
+//
+//   Find all conjectures and optionally hypotheses in the clause and
+//   formula set with number set_no and store their numbers in
+//   res. Returns number of seeds found.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long sine_index_find_seeds(SineIndex_p index,
+                                  PStackPointer set_no,
+                                  PQueue_p res, bool inc_hypos)
+{
+   long        ret = 0;
+   long        ax;
+   ClauseSet_p cset = PStackElementP(index->clause_sets, set_no);
+   FormulaSet_p fset = PStackElementP(index->formula_sets, set_no);
+   Clause_p    clause;
+   WFormula_p  form;
+
+   ax = PStackElementInt(index->set_start, 2*set_no);
+   for(clause = ClauseSucc(cset->anchor);
+       clause != cset->anchor;
+       clause = ClauseSucc(clause), ax++)
+   {
+      if(ClauseIsConjecture(clause)||
+         (inc_hypos && ClauseIsHypothesis(clause)))
+      {
+         PQueueStoreInt(res, ax);
+         ret++;
+      }
+   }
+   ax = PStackElementInt(index->set_start, 2*set_no+1);
+   for(form = fset->anchor->succ;
+       form != fset->anchor;
+       form = form->succ, ax++)
+   {
+      if(FormulaIsConjecture(form)||
+         (inc_hypos && FormulaIsHypothesis(form)))
+      {
+         PQueueStoreInt(res, ax);
+         ret++;
+      }
+   }
+   return ret;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_select_defining()
+//
+//   Equivalent of SelectDefiningAxioms() on an index. The queue
+//   contains axiom numbers, -1 separates the levels. Returns the
+//   number of axioms selected.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the stamps of the index.
+//
+/----------------------------------------------------------------------*/
+
+static long sine_index_select_defining(SineIndex_p index,
+                                       AxFilter_p ax_filter,
+                                       long max_set_size,
+                                       PQueue_p axioms,
+                                       PStack_p res_clauses,
+                                       PStack_p res_formulas)
+{
+   long          res = 0;
+   long          ax, cand;
+   int           recursion_level = 0;
+   FunCode       i;
+   PStack_p      entries;
+   PStackPointer sp, ssp;
+   Sig_p         sig = index->generality->sig;
+
+   PQueueStoreInt(axioms, -1);
+
+   while(!PQueueEmpty(axioms))
+   {
+      if((res > max_set_size) ||
+         (recursion_level > ax_filter->max_recursion_depth))
+      {
+         break;
+      }
+
+      ax = PQueueGetNextInt(axioms);
+      if(ax == -1)
+      {
+         recursion_level++;
+         if(!PQueueEmpty(axioms))
+         {
+            PQueueStoreInt(axioms, -1);
+         }
+         continue;
+      }
+      if(index->ax_stamp[ax] == index->stamp)
+      {
+         continue;
+      }
+      index->ax_stamp[ax] = index->stamp;
+      sine_index_push_axiom(index, ax, res_clauses, res_formulas);
+      res++;
+
+      for(ssp = PStackElementInt(index->sym_start, ax);
+          ssp < PStackElementInt(index->sym_start, ax+1);
+          ssp++)
+      {
+         i = PStackElementInt(index->symbols, ssp);
+         if((i > sig->internal_symbols) &&
+            (index->sym_stamp[i] != index->stamp) &&
+            (entries = PDArrayElementP(index->drel, i)))
+         {
+            index->sym_stamp[i] = index->stamp;
+            for(sp=0; sp<PStackGetSP(entries); sp+=2)
+            {
+               cand = PStackElementInt(entries, sp);
+               if(sine_index_in_drel(index, i, cand,
+                                     PStackElementInt(entries, sp+1),
+                                     ax_filter->benevolence,
+                                     ax_filter->generosity))
+               {
+                  PQueueStoreInt(axioms, cand);
+               }
+            }
+         }
+      }
+   }
+   return res;
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -291,9 +654,9 @@ void DRelationAddClauseSet(DRelation_p drel,
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle != set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       DRelationAddClause(drel,
                          generality,
@@ -470,9 +833,9 @@ long ClauseSetFindAxSelectionSeeds(ClauseSet_p set, PQueue_p res, bool inc_hypos
    Clause_p handle;
 
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle != set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle)||
          (inc_hypos && ClauseIsHypothesis(handle)))
@@ -757,6 +1120,249 @@ long SelectAxioms(GenDistrib_p      f_distrib,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexAlloc()
+//
+//   Build an index for the axioms in clause_sets and formula_sets
+//   that can be used to run all filters in filters (which must be
+//   GSinE filters compatible with each other, see
+//   SineIndexCompatible()). The generality distribution has to stay
+//   unchanged while the index is in use.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SineIndex_p SineIndexAlloc(GenDistrib_p f_distrib,
+                           PStack_p     clause_sets,
+                           PStack_p     formula_sets,
+                           PStack_p     filters)
+{
+   SineIndex_p   index = SineIndexCellAlloc();
+   AxFilter_p    filter = PStackElementP(filters, 0);
+   PStack_p      symbol_stack = PStackAlloc();
+   PStack_p      sort_stack = PStackAlloc();
+   PStackPointer i;
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+   Clause_p      clause;
+   WFormula_p    form;
+   Sig_p         sig = f_distrib->sig;
+   long          ax;
+
+   assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
+
+   index->generality              = f_distrib;
+   index->gen_measure             = filter->gen_measure;
+   index->trim_implications       = filter->trim_implications;
+   index->defined_symbols_in_drel = filter->defined_symbols_in_drel;
+   index->min_benevolence         = filter->benevolence;
+   index->max_benevolence         = filter->benevolence;
+   index->max_generosity          = filter->generosity;
+   for(i=1; i<PStackGetSP(filters); i++)
+   {
+      filter = PStackElementP(filters, i);
+      assert(SineIndexCompatible(filter,
+                                 (AxFilter_p)PStackElementP(filters, 0)));
+      index->min_benevolence = MIN(index->min_benevolence,
+                                   filter->benevolence);
+      index->max_benevolence = MAX(index->max_benevolence,
+                                   filter->benevolence);
+      index->max_generosity  = MAX(index->max_generosity,
+                                   filter->generosity);
+   }
+   index->clause_sets  = clause_sets;
+   index->formula_sets = formula_sets;
+   index->axioms       = PStackAlloc();
+   index->set_start    = PStackAlloc();
+   index->sym_start    = PStackAlloc();
+   index->symbols      = PStackAlloc();
+   index->gen_start    = PStackAlloc();
+   index->gens         = PStackAlloc();
+   index->forced       = PStackAlloc();
+   index->drel         = PDArrayAlloc(sig->f_count+1, 0);
+
+   index->clause_no = ClauseSetStackCardinality(clause_sets);
+   ax = 0;
+   for(i=0; i<PStackGetSP(clause_sets); i++)
+   {
+      PStackPushInt(index->set_start, ax);
+      PStackPushInt(index->set_start, 0);
+      ax += ClauseSetCardinality((ClauseSet_p)PStackElementP(clause_sets, i));
+   }
+   ax = index->clause_no;
+   for(i=0; i<PStackGetSP(formula_sets); i++)
+   {
+      PStackAssignInt(index->set_start, 2*i+1, ax);
+      ax += FormulaSetCardinality((FormulaSet_p)PStackElementP(formula_sets, i));
+   }
+
+   PStackPushInt(index->sym_start, 0);
+   PStackPushInt(index->gen_start, 0);
+   for(i=0; i<PStackGetSP(clause_sets); i++)
+   {
+      cset = PStackElementP(clause_sets, i);
+      for(clause = ClauseSucc(cset->anchor);
+          clause != cset->anchor;
+          clause = ClauseSucc(clause))
+      {
+         ClauseAddSymbolDistExist(clause, f_distrib->f_distrib, symbol_stack);
+         sine_index_add_axiom(index, clause, symbol_stack, -1, sort_stack);
+      }
+   }
+   for(i=0; i<PStackGetSP(formula_sets); i++)
+   {
+      fset = PStackElementP(formula_sets, i);
+      for(form = fset->anchor->succ;
+          form != fset->anchor;
+          form = form->succ)
+      {
+         TermAddSymbolDistExist((FormulaIsConjecture(form) &&
+                                 index->trim_implications) ?
+                                TermTrimImplications(sig, form->tformula) :
+                                form->tformula,
+                                f_distrib->f_distrib, symbol_stack);
+         sine_index_add_axiom(index, form, symbol_stack,
+                              index->defined_symbols_in_drel ?
+                              WFormulaGetLambdaDefinedSym(form) : -1,
+                              sort_stack);
+      }
+   }
+   PStackFree(symbol_stack);
+   PStackFree(sort_stack);
+
+   index->sym_size  = sig->f_count+1;
+   index->stamp     = 0;
+   index->ax_stamp  = SizeMalloc((SineIndexAxiomNo(index)+1)*sizeof(long));
+   memset(index->ax_stamp, 0, (SineIndexAxiomNo(index)+1)*sizeof(long));
+   index->sym_stamp = SizeMalloc(index->sym_size*sizeof(long));
+   memset(index->sym_stamp, 0, index->sym_size*sizeof(long));
+
+   return index;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexFree()
+//
+//   Free a SineIndex. Axioms, sets, and the distribution are external.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SineIndexFree(SineIndex_p junk)
+{
+   long     i;
+   PStack_p entries;
+
+   for(i=0; i<PDArraySize(junk->drel); i++)
+   {
+      entries = PDArrayElementP(junk->drel, i);
+      if(entries)
+      {
+         PStackFree(entries);
+      }
+   }
+   PDArrayFree(junk->drel);
+   PStackFree(junk->axioms);
+   PStackFree(junk->set_start);
+   PStackFree(junk->sym_start);
+   PStackFree(junk->symbols);
+   PStackFree(junk->gen_start);
+   PStackFree(junk->gens);
+   PStackFree(junk->forced);
+   SizeFree(junk->ax_stamp, (SineIndexAxiomNo(junk)+1)*sizeof(long));
+   SizeFree(junk->sym_stamp, junk->sym_size*sizeof(long));
+   SineIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexSelectAxioms()
+//
+//   Equivalent of SelectAxioms() using a shared index. ax_filter must
+//   be compatible with the filters the index was built for. The
+//   selection is the same as the one of SelectAxioms() (including the
+//   order), but no term is traversed and no D-relation is built.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the stamps of the index.
+//
+/----------------------------------------------------------------------*/
+
+long SineIndexSelectAxioms(SineIndex_p   index,
+                           PStackPointer seed_start,
+                           AxFilter_p    ax_filter,
+                           PStack_p      res_clauses,
+                           PStack_p      res_formulas)
+{
+   long          res   = 0;
+   long          seeds = 0;
+   PQueue_p      selq  = PQueueAlloc();
+   PStackPointer i;
+   PStack_p      entries;
+   long          ax_cardinality, max_result_size;
+
+   assert(ax_filter->type == AFGSinE);
+   assert(ax_filter->gen_measure == index->gen_measure);
+   assert(ax_filter->trim_implications == index->trim_implications);
+   assert(ax_filter->defined_symbols_in_drel ==
+          index->defined_symbols_in_drel);
+   assert(ax_filter->benevolence <= index->max_benevolence);
+   assert(ax_filter->benevolence >= index->min_benevolence);
+   assert(ax_filter->generosity <= index->max_generosity);
+
+   index->stamp++;
+   for(i=seed_start; i<PStackGetSP(index->clause_sets); i++)
+   {
+      seeds += sine_index_find_seeds(index, i, selq,
+                                     ax_filter->use_hypotheses);
+   }
+   VERBOSE(fprintf(stderr, "# Found %ld seed clauses/formulas\n", seeds););
+   if(seeds)
+   {
+      ax_cardinality = SineIndexAxiomNo(index);
+      max_result_size = ax_filter->max_set_fraction*ax_cardinality;
+      if(ax_filter->max_set_size < max_result_size)
+      {
+         max_result_size = ax_filter->max_set_size;
+      }
+      entries = PDArrayElementP(index->drel, 0);
+      if(entries && ax_filter->add_no_symbol_axioms)
+      {
+         for(i=0; i<PStackGetSP(entries); i+=2)
+         {
+            if(sine_index_in_drel(index, 0,
+                                  PStackElementInt(entries, i),
+                                  PStackElementInt(entries, i+1),
+                                  ax_filter->benevolence,
+                                  ax_filter->generosity))
+            {
+               sine_index_push_axiom(index, PStackElementInt(entries, i),
+                                     res_clauses, res_formulas);
+            }
+         }
+      }
+      res = PStackGetSP(res_clauses)+PStackGetSP(res_formulas);
+      res += sine_index_select_defining(index, ax_filter,
+                                        max_result_size, selq,
+                                        res_clauses, res_formulas);
+   }
+   PQueueFree(selq);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SelectThreshold()
@@ -792,9 +1398,9 @@ long SelectThreshold(PStack_p          clause_sets,
       for(i=0; i<PStackGetSP(clause_sets); i++)
       {
          cset = PStackElementP(clause_sets, i);
-         for(clause = cset->anchor->succ;
+         for(clause = ClauseSucc(cset->anchor);
              clause!=cset->anchor;
-             clause=clause->succ)
+             clause=ClauseSucc(clause))
          {
             PStackPushP(res_clauses, clause);
          }
@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Jul  2 00:55:03 CEST 2010
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    Shared evaluation of several GSinE filters (SineIndex)
 
 -----------------------------------------------------------------------*/
 
@@ -53,6 +55,46 @@ typedef struct d_relation_cell
 }DRelationCell, *DRelation_p;
 
 
+/* Shared data for running several GSinE filters on the same
+ * axioms. Filters can share an index if they agree on the generality
+ * measure, on trimming implications, and on forcing defined symbols
+ * into the D-relation. Each axiom is traversed once, and its distinct
+ * symbols and the sorted generalities of these symbols are recorded.
+ * For each symbol, the index lists the axioms that have it in their
+ * D-relation under the most liberal of the filters, together with the
+ * generality that decides membership for the other filters (-1 for
+ * forced symbols). Entry 0 lists the axioms that may have an empty
+ * D-relation, with the generality of their least general symbol
+ * (LONG_MAX if there is none). Axioms are numbered, clauses first,
+ * both in the order of the sets. */
+
+typedef struct sine_index_cell
+{
+   GenDistrib_p      generality;
+   GeneralityMeasure gen_measure;
+   bool              trim_implications;
+   bool              defined_symbols_in_drel;
+   double            min_benevolence;
+   double            max_benevolence;
+   long              max_generosity;
+   PStack_p          clause_sets;
+   PStack_p          formula_sets;
+   long              clause_no;
+   PStack_p          axioms;    /* Clause_p, then WFormula_p */
+   PStack_p          set_start; /* First clause, first formula per set */
+   PStack_p          sym_start; /* Per axiom and one past the end... */
+   PStack_p          symbols;   /* ...distinct symbols in order */
+   PStack_p          gen_start; /* Per axiom and one past the end... */
+   PStack_p          gens;      /* ...sorted generalities of symbols */
+   PStack_p          forced;    /* Per axiom: Forced symbol or -1 */
+   PDArray_p         drel;      /* Of PStack_p of (axiom, generality) */
+   long              *ax_stamp;
+   long              *sym_stamp;
+   FunCode           sym_size;
+   long              stamp;
+}SineIndexCell, *SineIndex_p;
+
+
 /* Types of axioms */
 
 typedef enum
@@ -157,6 +199,28 @@ long SelectAxioms(GenDistrib_p      f_distrib,
                   PStack_p          res_clauses,
                   PStack_p          res_formulas);
 
+#define SineIndexCellAlloc()    (SineIndexCell*)SizeMalloc(sizeof(SineIndexCell))
+#define SineIndexCellFree(junk) SizeFree(junk, sizeof(SineIndexCell))
+
+#define SineIndexAxiomNo(index) PStackGetSP((index)->axioms)
+#define SineIndexCompatible(f1, f2)                                     \
+   ((f1)->type == AFGSinE && (f2)->type == AFGSinE &&                   \
+    (f1)->gen_measure == (f2)->gen_measure &&                           \
+    (f1)->trim_implications == (f2)->trim_implications &&               \
+    (f1)->defined_symbols_in_drel == (f2)->defined_symbols_in_drel)
+
+SineIndex_p SineIndexAlloc(GenDistrib_p f_distrib,
+                           PStack_p     clause_sets,
+                           PStack_p     formula_sets,
+                           PStack_p     filters);
+void        SineIndexFree(SineIndex_p junk);
+
+long SineIndexSelectAxioms(SineIndex_p   index,
+                           PStackPointer seed_start,
+                           AxFilter_p    ax_filter,
+                           PStack_p      res_clauses,
+                           PStack_p      res_formulas);
+
 long SelectThreshold(PStack_p          clause_sets,
                      PStack_p          formula_sets,
                      AxFilter_p        ax_filter,
@@ -704,8 +704,8 @@ Clause_p clause_set_subsumes_clause(ClauseSet_p set, Clause_p sub_candidate)
    assert(sub_candidate->weight ==
           ClauseStandardWeight(sub_candidate));
 
-   for(handle = set->anchor->succ; handle != set->anchor;
-       handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor;
+       handle = ClauseSucc(handle))
    {
       if(clause_subsumes_clause(handle, sub_candidate))
       {
@@ -910,9 +910,9 @@ void clauseset_find_subsumed_clauses(ClauseSet_p set,
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!= set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(clause_subsumes_clause(subsumer, handle))
       {
@@ -943,9 +943,9 @@ Clause_p clauseset_find_first_subsumed_clause(ClauseSet_p set,
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!= set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(clause_subsumes_clause(subsumer, handle))
       {
@@ -1264,7 +1264,7 @@ Clause_p ClauseSetFindUnitSubsumedClause(ClauseSet_p set, Clause_p
       {
          return set_position;
       }
-      set_position = set_position->succ;
+      set_position = ClauseSucc(set_position);
    }
    return NULL;
 }
@@ -1501,7 +1501,7 @@ Clause_p ClauseSetFindSubsumedClause(ClauseSet_p set, Clause_p
          PERF_CTR_EXIT(SetSubsumeTimer);
          return set_position;
       }
-      set_position = set_position->succ;
+      set_position = ClauseSucc(set_position);
    }
    PERF_CTR_EXIT(SetSubsumeTimer);
    return NULL;
@@ -18,6 +18,8 @@ Changes
 
 <1> Wed Apr 14 09:27:17 CEST 2010
     New
+<2> Mon Oct 19 03:02:51 CEST 2026
+    Optional path index
 
 -----------------------------------------------------------------------*/
 
@@ -126,6 +128,7 @@ static long eqn_collect_idx_subterms(Eqn_p eqn, PTree_p *rest,
 /----------------------------------------------------------------------*/
 
 static void subterm_index_insert_set(SubtermIndex_p index,
+                                     PathIndex_p paths,
                                      Clause_p clause,
                                      PTree_p terms, bool restricted)
 {
@@ -134,7 +137,7 @@ static void subterm_index_insert_set(SubtermIndex_p index,
 
    while((cell = PTreeTraverseNext(stack)))
    {
-      SubtermIndexInsertOcc(index, clause, cell->key, restricted);
+      SubtermIndexInsertOcc(index, paths, clause, cell->key, restricted);
    }
    PTreeTraverseExit(stack);
 }
@@ -154,6 +157,7 @@ static void subterm_index_insert_set(SubtermIndex_p index,
 /----------------------------------------------------------------------*/
 
 static void subterm_index_delete_set(SubtermIndex_p index,
+                                     PathIndex_p paths,
                                      Clause_p clause,
                                      PTree_p terms, bool restricted)
 {
@@ -162,7 +166,7 @@ static void subterm_index_delete_set(SubtermIndex_p index,
 
    while((cell = PTreeTraverseNext(stack)))
    {
-      SubtermIndexDeleteOcc(index, clause, cell->key, restricted);
+      SubtermIndexDeleteOcc(index, paths, clause, cell->key, restricted);
    }
    PTreeTraverseExit(stack);
 }
@@ -180,15 +184,16 @@ static void subterm_index_delete_set(SubtermIndex_p index,
 // Function: SubtermIndexInsertOcc()
 //
 //   Insert a  given occurance of a subterm into the index. Return
-//   true if it was new, false if it already existed.
+//   true if it was new, false if it already existed. If paths is
+//   given, new terms are also added to it.
 //
 // Global Variables: -
 //
 // Side Effects    : Memory operatios
 //
 /----------------------------------------------------------------------*/
-bool SubtermIndexInsertOcc(SubtermIndex_p index, Clause_p clause,
-                           Term_p term, bool restricted)
+bool SubtermIndexInsertOcc(SubtermIndex_p index, PathIndex_p paths,
+                           Clause_p clause, Term_p term, bool restricted)
 {
    FPTree_p     fp_node;
    SubtermOcc_p subterm_node;
@@ -198,6 +203,11 @@ bool SubtermIndexInsertOcc(SubtermIndex_p index, Clause_p clause,
    subterm_node = SubtermTreeInsertTerm((void*)&(fp_node->payload), term);
    root         = restricted?&(subterm_node->pl.occs.rw_rest):&(subterm_node->pl.occs.rw_full);
 
+   if(paths && !subterm_node->pl.occs.rw_rest && !subterm_node->pl.occs.rw_full)
+   {
+      PathIndexInsert(paths, term);
+   }
+
    return PTreeStore(root, clause);
 }
 
@@ -207,7 +217,8 @@ bool SubtermIndexInsertOcc(SubtermIndex_p index, Clause_p clause,
 // Function: SubtermIndexDeleteOcc()
 //
 //   Delete a given occurance of a subterm from the index. Return true
-//   if the clause existed, false otherwise.
+//   if the clause existed, false otherwise. If paths is given, terms
+//   without remaining occurrences are also removed from it.
 //
 // Global Variables: -
 //
@@ -215,8 +226,8 @@ bool SubtermIndexInsertOcc(SubtermIndex_p index, Clause_p clause,
 //
 /----------------------------------------------------------------------*/
 
-bool SubtermIndexDeleteOcc(SubtermIndex_p index, Clause_p clause,
-                           Term_p term, bool restricted)
+bool SubtermIndexDeleteOcc(SubtermIndex_p index, PathIndex_p paths,
+                           Clause_p clause, Term_p term, bool restricted)
 {
    FPTree_p     fp_node;
    bool         res;
@@ -228,6 +239,10 @@ bool SubtermIndexDeleteOcc(SubtermIndex_p index, Clause_p clause,
    }
    res =  SubtermTreeDeleteTermOcc((void*)&(fp_node->payload), term,
                                    clause, restricted);
+   if(paths && !SubtermTreeFindTerm((void*)&(fp_node->payload), term))
+   {
+      PathIndexDelete(paths, term);
+   }
 
    if(fp_node->payload == NULL)
    {
@@ -237,6 +252,30 @@ bool SubtermIndexDeleteOcc(SubtermIndex_p index, Clause_p clause,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SubtermIndexFindTerm()
+//
+//   Return the occurrences of term in the index, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+SubtermOcc_p SubtermIndexFindTerm(SubtermIndex_p index, Term_p term)
+{
+   FPTree_p fp_node = FPIndexFind(index, term);
+
+   if(!fp_node)
+   {
+      return NULL;
+   }
+   return SubtermTreeFindTerm((void*)&(fp_node->payload), term);
+}
+
+
 
 
 /*-----------------------------------------------------------------------
@@ -281,15 +320,15 @@ long ClauseCollectIdxSubterms(Clause_p clause,
 //
 /----------------------------------------------------------------------*/
 
-void SubtermIndexInsertClause(SubtermIndex_p index, Clause_p clause,
-                              bool lambda_demod)
+void SubtermIndexInsertClause(SubtermIndex_p index, PathIndex_p paths,
+                              Clause_p clause, bool lambda_demod)
 {
    PTree_p rest=NULL, full=NULL;
 
    ClauseCollectIdxSubterms(clause, &rest, &full, lambda_demod);
 
-   subterm_index_insert_set(index, clause, rest, true);
-   subterm_index_insert_set(index, clause, full, false);
+   subterm_index_insert_set(index, paths, clause, rest, true);
+   subterm_index_insert_set(index, paths, clause, full, false);
 
    PTreeFree(rest);
    PTreeFree(full);
@@ -308,14 +347,15 @@ void SubtermIndexInsertClause(SubtermIndex_p index, Clause_p clause,
 //
 /----------------------------------------------------------------------*/
 
-void SubtermIndexDeleteClause(SubtermIndex_p index, Clause_p clause, bool lambda_demod)
+void SubtermIndexDeleteClause(SubtermIndex_p index, PathIndex_p paths,
+                              Clause_p clause, bool lambda_demod)
 {
    PTree_p rest=NULL, full=NULL;
 
    ClauseCollectIdxSubterms(clause, &rest, &full, lambda_demod);
 
-   subterm_index_delete_set(index, clause, rest, true);
-   subterm_index_delete_set(index, clause, full, false);
+   subterm_index_delete_set(index, paths, clause, rest, true);
+   subterm_index_delete_set(index, paths, clause, full, false);
 
    PTreeFree(rest);
    PTreeFree(full);
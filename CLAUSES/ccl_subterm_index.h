@@ -8,6 +8,8 @@ Contents
 
   A simple (hashed) index from terms to clauses in which this term
   appears as priviledged (rewriting restricted) or unpriviledged term.
+  Optionally, the indexed terms are also kept in a path index for the
+  retrieval of instances.
 
   Copyright 2010 by the author.
   This code is released under the GNU General Public Licence and
@@ -19,6 +21,8 @@ Changes
 
 <1> Wed May  5 10:19:14 CEST 2010
     New
+<2> Mon Oct 19 03:02:51 CEST 2026
+    Optional path index
 
 -----------------------------------------------------------------------*/
 
@@ -27,6 +31,7 @@ Changes
 #define CCL_SUBTERM_INDEX
 
 #include <cte_fp_index.h>
+#include <cte_path_index.h>
 #include <ccl_subterm_tree.h>
 
 
@@ -41,10 +46,11 @@ typedef FPIndex_p SubtermIndex_p;
 /*---------------------------------------------------------------------*/
 
 
-bool SubtermIndexInsertOcc(SubtermIndex_p index, Clause_p clause,
-                           Term_p term, bool restricted);
-bool SubtermIndexDeleteOcc(SubtermIndex_p index, Clause_p clause,
-                           Term_p term, bool restricted);
+bool SubtermIndexInsertOcc(SubtermIndex_p index, PathIndex_p paths,
+                           Clause_p clause, Term_p term, bool restricted);
+bool SubtermIndexDeleteOcc(SubtermIndex_p index, PathIndex_p paths,
+                           Clause_p clause, Term_p term, bool restricted);
+SubtermOcc_p SubtermIndexFindTerm(SubtermIndex_p index, Term_p term);
 
 
 long ClauseCollectIdxSubterms(Clause_p clause,
@@ -52,8 +58,10 @@ long ClauseCollectIdxSubterms(Clause_p clause,
                               PTree_p *full,
                               bool lambda_demod);
 
-void SubtermIndexInsertClause(SubtermIndex_p index, Clause_p clause, bool lambda_demod);
-void SubtermIndexDeleteClause(SubtermIndex_p index, Clause_p clause, bool lambda_demod);
+void SubtermIndexInsertClause(SubtermIndex_p index, PathIndex_p paths,
+                              Clause_p clause, bool lambda_demod);
+void SubtermIndexDeleteClause(SubtermIndex_p index, PathIndex_p paths,
+                              Clause_p clause, bool lambda_demod);
 
 #endif
 
@@ -286,9 +286,9 @@ bool ClauseSetUnfoldEqDef(ClauseSet_p set, ClausePos_p demod)
       ClauseExtractHODefinition(demod->clause, demod->side, &lside, &rside);
    }
 
-   for(handle = set->anchor->succ;
+   for(handle = ClauseSucc(set->anchor);
        handle!=set->anchor;
-       handle = handle->succ)
+       handle = ClauseSucc(handle))
    {
       if(ClauseUnfoldEqDef(handle, demod, lside, rside))
       {
@@ -331,7 +331,7 @@ long ClauseSetUnfoldAllEqDefs(ClauseSet_p set, ClauseSet_p passive,
 
    while((demod = ClauseSetFindEqDefinition(set, min_arity, start)))
    {
-      start = demod->clause->succ;
+      start = ClauseSucc(demod->clause);
       if((TermStandardWeight(ClausePosGetOtherSide(demod))-
           TermStandardWeight(ClausePosGetSide(demod)))<=eqdef_incrlimit)
       {
@@ -0,0 +1,353 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_watchlist.c
+
+Author: The E developers
+
+Contents
+
+  Prefilter and statistics for the watchlist.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 14:05:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_watchlist.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Name used for clauses without source information. These are
+   usually watchlist clauses that have been rewritten during the
+   search. */
+#define WL_UNKNOWN_SOURCE "(simplified)"
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_source_name()
+//
+//   Return the name of the file clause was read from.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* clause_source_name(Clause_p clause)
+{
+   ClauseInfo_p info = ClauseSourceInfo(clause);
+
+   if(info && info->source)
+   {
+      return info->source;
+   }
+   return WL_UNKNOWN_SOURCE;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: find_source()
+//
+//   Return the source cell for the file clause was read from, or
+//   NULL if there is none (and create is false). There are only few
+//   watchlist files, so linear search is fine.
+//
+// Global Variables: -
+//
+// Side Effects    : May allocate a new source cell
+//
+/----------------------------------------------------------------------*/
+
+static WLSource_p find_source(WatchlistAdmin_p admin, Clause_p clause,
+                              bool create)
+{
+   char          *name = clause_source_name(clause);
+   PStackPointer i;
+   WLSource_p    handle;
+
+   for(i=0; i<PStackGetSP(admin->sources); i++)
+   {
+      handle = PStackElementP(admin->sources, i);
+      if(strcmp(handle->name, name)==0)
+      {
+         return handle;
+      }
+   }
+   if(!create)
+   {
+      return NULL;
+   }
+   handle = WLSourceCellAlloc();
+   handle->name     = SecureStrdup(name);
+   handle->clauses  = 0;
+   handle->hits     = 0;
+   handle->removed  = 0;
+   handle->last_hit = 0;
+   PStackPushP(admin->sources, handle);
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: side_may_match()
+//
+//   Return true if side (of a literal with the given sign) can be
+//   matched onto a side of a watchlist literal.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool side_may_match(WatchlistAdmin_p admin, Term_p side, bool positive)
+{
+   long key;
+
+   if(TermIsFreeVar(side))
+   {
+      return true;
+   }
+   key = WL_FILTER_KEY(side->f_code, positive);
+   return key < PDArraySize(admin->top_symbols) &&
+      PDArrayElementInt(admin->top_symbols, key);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminAlloc()
+//
+//   Allocate the administrative data for watchlist and add all its
+//   clauses.
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+WatchlistAdmin_p WatchlistAdminAlloc(ClauseSet_p watchlist)
+{
+   WatchlistAdmin_p handle = WatchlistAdminCellAlloc();
+   Clause_p         clause;
+
+   handle->top_symbols = PDIntArrayAlloc(64, 0);
+   /* Higher-order matching can instantiate the head of applied
+      variables and works modulo beta/eta, so the top symbol
+      criterion is not sound there. */
+   handle->filter      = (problemType != PROBLEM_HO);
+   handle->sources     = PStackAlloc();
+   handle->checks      = 0;
+   handle->filtered    = 0;
+   handle->hits        = 0;
+   handle->check_ticks = 0;
+
+   for(clause = ClauseSucc(watchlist->anchor);
+       clause != watchlist->anchor;
+       clause = ClauseSucc(clause))
+   {
+      find_source(handle, clause, true)->clauses++;
+      WatchlistAdminAddClause(handle, clause);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminFree()
+//
+//   Free the administrative data.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void WatchlistAdminFree(WatchlistAdmin_p junk)
+{
+   WLSource_p source;
+
+   while(!PStackEmpty(junk->sources))
+   {
+      source = PStackPopP(junk->sources);
+      FREE(source->name);
+      WLSourceCellFree(source);
+   }
+   PStackFree(junk->sources);
+   PDArrayFree(junk->top_symbols);
+   WatchlistAdminCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminAddClause()
+//
+//   Register the top symbols of a (new or modified) watchlist clause
+//   with the filter.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes admin
+//
+/----------------------------------------------------------------------*/
+
+void WatchlistAdminAddClause(WatchlistAdmin_p admin, Clause_p clause)
+{
+   Eqn_p handle;
+   bool  positive;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      positive = EqnIsPositive(handle);
+      if(!TermIsFreeVar(handle->lterm))
+      {
+         PDArrayElementIncInt(admin->top_symbols,
+                              WL_FILTER_KEY(handle->lterm->f_code, positive),
+                              1);
+      }
+      if(!TermIsFreeVar(handle->rterm))
+      {
+         PDArrayElementIncInt(admin->top_symbols,
+                              WL_FILTER_KEY(handle->rterm->f_code, positive),
+                              1);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminMaySubsume()
+//
+//   Return false if clause certainly does not subsume any clause on
+//   the watchlist, true otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool WatchlistAdminMaySubsume(WatchlistAdmin_p admin, Clause_p clause)
+{
+   Eqn_p handle;
+   bool  positive;
+
+   if(!admin->filter)
+   {
+      return true;
+   }
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      positive = EqnIsPositive(handle);
+      if(!side_may_match(admin, handle->lterm, positive) ||
+         !side_may_match(admin, handle->rterm, positive))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminRecordHit()
+//
+//   Record that the current processed clause (the one of the last
+//   check) subsumed the watchlist clause watched, which has been
+//   removed from the watchlist if removed is true.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes statistics
+//
+/----------------------------------------------------------------------*/
+
+void WatchlistAdminRecordHit(WatchlistAdmin_p admin, Clause_p watched,
+                             bool removed)
+{
+   WLSource_p source = find_source(admin, watched, true);
+
+   if(source->last_hit != admin->checks)
+   {
+      source->last_hit = admin->checks;
+      source->hits++;
+   }
+   if(removed)
+   {
+      source->removed++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WatchlistAdminPrintStatistics()
+//
+//   Print the watchlist statistics, overall and for each source.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void WatchlistAdminPrintStatistics(FILE* out, WatchlistAdmin_p admin)
+{
+   PStackPointer i;
+   WLSource_p    source;
+
+   fprintf(out, "# Watchlist checks                     : %ld\n",
+           admin->checks);
+   fprintf(out, "# ...rejected by top symbol filter     : %ld\n",
+           admin->filtered);
+   fprintf(out, "# ...subsuming watchlist clauses       : %ld\n",
+           admin->hits);
+   fprintf(out, "# Watchlist check time                 : %.3f\n",
+           PerfCtrTicksToUSec(admin->check_ticks)/1000000.0);
+   for(i=0; i<PStackGetSP(admin->sources); i++)
+   {
+      source = PStackElementP(admin->sources, i);
+      fprintf(out, "# Watchlist %s: %ld clauses, %ld hits, %ld removed\n",
+              source->name, source->clauses, source->hits, source->removed);
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
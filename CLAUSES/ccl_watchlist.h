@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_watchlist.h
+
+Author: The E developers
+
+Contents
+
+  Administrative data for the watchlist: A cheap prefilter that
+  rejects clauses that cannot subsume any watchlist clause before the
+  (expensive) indexed subsumption check, and statistics about hits
+  and check costs for each watchlist file.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 14:05:52 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_WATCHLIST
+
+#define CCL_WATCHLIST
+
+#include <ccl_clausesets.h>
+#include <clb_perfctr.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Statistics for the watchlist clauses from one source file */
+
+typedef struct wl_source_cell
+{
+   char *name;     /* As in the clause info of its clauses */
+   long clauses;   /* Initial number of clauses */
+   long hits;      /* Processed clauses that subsumed any of them */
+   long removed;   /* Clauses removed because they were subsumed */
+   long last_hit;  /* Number of the check that last hit this source */
+}WLSourceCell, *WLSource_p;
+
+/* A clause C can only subsume a watchlist clause D if for every
+   non-variable side of every literal of C, D contains a literal with
+   the same sign and a side with the same top symbol. top_symbols
+   counts the occurrences of (top symbol, sign) over all watchlist
+   clauses that have ever been added. Entries are never decremented,
+   so the filter stays sound if clauses are removed. The structure
+   only depends on the watchlist clauses, not on the search
+   strategy. It is computed before strategies are forked, so that all
+   of them share it. */
+
+typedef struct watchlist_admin_cell
+{
+   PDArray_p top_symbols;  /* Indexed by WL_FILTER_KEY() */
+   bool      filter;       /* Use the filter? */
+   PStack_p  sources;      /* WLSource_p */
+   long      checks;       /* Clauses checked against the watchlist */
+   long      filtered;     /* ...rejected by the filter */
+   long      hits;         /* ...that subsumed watchlist clauses */
+   long long check_ticks;  /* Time spent on checks */
+}WatchlistAdminCell, *WatchlistAdmin_p;
+
+#define WL_FILTER_KEY(f_code, positive) (2*(f_code)+((positive)?1:0))
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define WatchlistAdminCellAlloc()    (WatchlistAdminCell*)SizeMalloc(sizeof(WatchlistAdminCell))
+#define WatchlistAdminCellFree(junk) SizeFree(junk, sizeof(WatchlistAdminCell))
+#define WLSourceCellAlloc()    (WLSourceCell*)SizeMalloc(sizeof(WLSourceCell))
+#define WLSourceCellFree(junk) SizeFree(junk, sizeof(WLSourceCell))
+
+WatchlistAdmin_p WatchlistAdminAlloc(ClauseSet_p watchlist);
+void             WatchlistAdminFree(WatchlistAdmin_p junk);
+
+void WatchlistAdminAddClause(WatchlistAdmin_p admin, Clause_p clause);
+bool WatchlistAdminMaySubsume(WatchlistAdmin_p admin, Clause_p clause);
+void WatchlistAdminRecordHit(WatchlistAdmin_p admin, Clause_p watched,
+                             bool removed);
+void WatchlistAdminPrintStatistics(FILE* out, WatchlistAdmin_p admin);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
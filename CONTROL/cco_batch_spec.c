@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created: Tue Jun 29 04:41:18 CEST 2010
+  Mon Oct 19 02:14:37 CEST 2026: Shared evaluation of several filters
 
   -----------------------------------------------------------------------*/
 
@@ -700,6 +701,91 @@ long StructFOFSpecGetProblem(StructFOFSpec_p ctrl,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecGetProblems()
+//
+//   Equivalent to StructFOFSpecGetProblem() for each filter in
+//   filters (of AxFilter_p), with the results going to the stacks at
+//   the same position in res_clauses and res_formulas. GSinE filters
+//   that are compatible share a SineIndex, so that the axioms are
+//   traversed once per group of filters instead of once per filter.
+//   Returns the total number of selected clauses and formulas.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long StructFOFSpecGetProblems(StructFOFSpec_p ctrl,
+                              PStack_p        filters,
+                              PStack_p        res_clauses,
+                              PStack_p        res_formulas)
+{
+   long          res = 0;
+   PStackPointer i, j, k;
+   PStackPointer size = PStackGetSP(filters);
+   AxFilter_p    filter;
+   PStack_p      group = PStackAlloc();
+   PStack_p      members = PStackAlloc();
+   bool          *done = SizeMalloc((size+1)*sizeof(bool));
+   SineIndex_p   index;
+
+   assert(PStackGetSP(res_clauses) == size);
+   assert(PStackGetSP(res_formulas) == size);
+
+   memset(done, 0, (size+1)*sizeof(bool));
+   for(i=0; i<size; i++)
+   {
+      if(done[i])
+      {
+         continue;
+      }
+      filter = PStackElementP(filters, i);
+      if(filter->type != AFGSinE)
+      {
+         res += StructFOFSpecGetProblem(ctrl, filter,
+                                        PStackElementP(res_clauses, i),
+                                        PStackElementP(res_formulas, i));
+         done[i] = true;
+         continue;
+      }
+      for(j=i; j<size; j++)
+      {
+         if(!done[j] && SineIndexCompatible(filter,
+                                            (AxFilter_p)PStackElementP(filters, j)))
+         {
+            PStackPushP(group, PStackElementP(filters, j));
+            PStackPushInt(members, j);
+            done[j] = true;
+         }
+      }
+      index = SineIndexAlloc(ctrl->f_distrib,
+                             ctrl->clause_sets,
+                             ctrl->formula_sets,
+                             group);
+      for(k=0; k<PStackGetSP(group); k++)
+      {
+         j = PStackElementInt(members, k);
+         res += SineIndexSelectAxioms(index,
+                                      ctrl->shared_ax_sp,
+                                      PStackElementP(group, k),
+                                      PStackElementP(res_clauses, j),
+                                      PStackElementP(res_formulas, j));
+      }
+      SineIndexFree(index);
+      PStackReset(group);
+      PStackReset(members);
+   }
+   SizeFree(done, (size+1)*sizeof(bool));
+   PStackFree(group);
+   PStackFree(members);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: BatchProcessProblem()
@@ -0,0 +1,452 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_checkpoint.c
+
+Author: The E developers
+
+Contents
+
+  Saving and restoring the state of the saturation loop.
+
+  A checkpoint stores the processed and unprocessed clauses, the
+  statistics counters of the proof state and the position of the
+  clause selection heuristic in its evaluation round robin. It is
+  written in a compact line-oriented format readable by E's normal
+  scanner:
+
+     checkpoint(<version>, <counter>, ..., <counter>).
+     hcb(<current_eval>, <select_count>).
+     p(<create_date>, <type>, <props>, (<TSTP literals>)).
+     u(<create_date>, <type>, <props>, (<TSTP literals>)).
+     end.
+
+  Indices, clause evaluations, literal selection and term orderings
+  are recomputed on restore. The checkpoint is only meaningful for
+  a prover instance that has been set up exactly as the one that
+  wrote it (same problem, preprocessing and heuristic). Derivations
+  are not stored. Restored clauses are marked as
+  introduced(checkpoint), so that proof objects of a resumed search
+  show them as unproven assumptions.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 10:12:31 CEST 2026
+    New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Mark restored clauses with a checkpoint derivation
+
+-----------------------------------------------------------------------*/
+
+#include "cco_checkpoint.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Properties that survive a checkpoint */
+#define CHECKPOINT_PROPS (CPInitial|CPIsSOS)
+
+#define CHECKPOINT_COUNTERS 22
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: state_counters()
+//
+//   Fill counters with the addresses of the statistics counters of
+//   state that are stored in a checkpoint. The order defines the
+//   file format!
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void state_counters(ProofState_p state, unsigned long* counters[])
+{
+   int i = 0;
+
+   counters[i++] = &(state->processed_count);
+   counters[i++] = &(state->proc_trivial_count);
+   counters[i++] = &(state->proc_forward_subsumed_count);
+   counters[i++] = &(state->proc_non_trivial_count);
+   counters[i++] = &(state->other_redundant_count);
+   counters[i++] = &(state->non_redundant_deleted);
+   counters[i++] = &(state->backward_subsumed_count);
+   counters[i++] = &(state->backward_rewritten_count);
+   counters[i++] = &(state->backward_rewritten_lit_count);
+   counters[i++] = &(state->generated_count);
+   counters[i++] = &(state->aggressive_forward_subsumed_count);
+   counters[i++] = &(state->generated_lit_count);
+   counters[i++] = &(state->non_trivial_generated_count);
+   counters[i++] = &(state->context_sr_count);
+   counters[i++] = &(state->paramod_count);
+   counters[i++] = &(state->factor_count);
+   counters[i++] = &(state->neg_ext_count);
+   counters[i++] = &(state->resolv_count);
+   counters[i++] = &(state->satcheck_count);
+   counters[i++] = &(state->satcheck_success);
+   counters[i++] = &(state->satcheck_satisfiable);
+   counters[i++] = &(state->filter_orphans_base);
+   assert(i == CHECKPOINT_COUNTERS);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: print_clause_set()
+//
+//   Print all clauses of set as checkpoint records with the given
+//   tag.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void print_clause_set(FILE* out, char* tag, ClauseSet_p set)
+{
+   Clause_p handle;
+
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+          ClauseSucc(handle))
+   {
+      fprintf(out, "%s(%ld, %d, %d, ", tag, (long)handle->create_date,
+              (int)ClauseQueryTPTPType(handle),
+              (int)(handle->properties & CHECKPOINT_PROPS));
+      ClauseTSTPCorePrint(out, handle, true);
+      fputs(").\n", out);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_clause_record()
+//
+//   Parse the body of a clause record (after the tag) and return the
+//   clause. Its derivation records that it comes from a checkpoint.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p parse_clause_record(Scanner_p in, TB_p bank)
+{
+   Clause_p handle;
+   Eqn_p    lits;
+   long     create_date;
+   int      type, props;
+
+   AcceptInpTok(in, OpenBracket);
+   create_date = ParseInt(in);
+   AcceptInpTok(in, Comma);
+   type = ParseInt(in);
+   AcceptInpTok(in, Comma);
+   props = ParseInt(in);
+   AcceptInpTok(in, Comma);
+   AcceptInpTok(in, OpenBracket);
+   VarBankClearExtNamesNoReset(bank->vars);
+   lits = EqnListParse(in, bank, Pipe);
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, Fullstop);
+
+   handle = ClauseAlloc(lits);
+   ClauseSetTPTPType(handle, type);
+   ClauseSetProp(handle, props & CHECKPOINT_PROPS);
+   handle->create_date = create_date;
+   ClausePushDerivation(handle, DCCheckpoint, NULL, NULL);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: restore_processed()
+//
+//   Redo the bookkeeping ProcessClause() performs for a clause that
+//   has been selected and simplified, and insert it into the
+//   processed sets. No inferences are performed, as all of them have
+//   been performed before the checkpoint was taken.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state
+//
+/----------------------------------------------------------------------*/
+
+static void restore_processed(ProofState_p state, ProofControl_p control,
+                              Clause_p clause)
+{
+   FVPackedClause_p pclause;
+
+   ClauseSetProp(clause, CPIsProcessed);
+   ClauseNormalizeVars(clause, state->freshvars);
+   ClauseOrientLiterals(control->ocb, clause);
+   ClauseSubsumeOrderSortLits(clause);
+   clause->weight = ClauseStandardWeight(clause);
+   pclause = FVIndexPackClause(clause, state->processed_non_units->fvindex);
+   ClauseDelProp(clause, CPIsOriented);
+   DoLiteralSelection(control, clause);
+   ClauseCondMarkMaximalTerms(control->ocb, clause);
+
+   ProofStateInsertProcessed(state, control, pclause,
+                             ClauseSetListGetMaxDate(state->demods,
+                                                     FullRewrite));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: restore_unprocessed()
+//
+//   Evaluate clause and insert it into the unprocessed set, as
+//   insert_new_clauses() does for newly generated clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state
+//
+/----------------------------------------------------------------------*/
+
+static void restore_unprocessed(ProofState_p state, ProofControl_p control,
+                                Clause_p clause)
+{
+   ClauseNormalizeVars(clause, state->freshvars);
+   ClauseOrientLiterals(control->ocb, clause);
+   ClauseDelProp(clause, CPIsOriented);
+   if(!control->heuristic_parms.select_on_proc_only)
+   {
+      DoLiteralSelection(control, clause);
+   }
+   HCBClauseEvaluate(control->hcb, clause);
+   if(control->heuristic_parms.prefer_initial_clauses &&
+      ClauseQueryProp(clause, CPInitial))
+   {
+      EvalListChangePriority(clause->evaluations, -PrioLargestReasonable);
+   }
+   ClauseDelProp(clause, CPIsOriented);
+   ClauseSetInsert(state->unprocessed, clause);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCanCheckpoint()
+//
+//   Return true if the clauses of state can be represented in a
+//   checkpoint. Currently, this is only the case for untyped
+//   first-order problems, as other clauses are not printed in a
+//   syntax the clause parser accepts.
+//
+// Global Variables: problemType
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool ProofStateCanCheckpoint(ProofState_p state)
+{
+   return problemType == PROBLEM_FO && ProofStateIsUntyped(state);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCheckpointPrint()
+//
+//   Print a checkpoint of the saturation state to out.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void ProofStateCheckpointPrint(FILE* out, ProofState_p state,
+                               ProofControl_p control)
+{
+   unsigned long* counters[CHECKPOINT_COUNTERS];
+   int i;
+
+   state_counters(state, counters);
+   fprintf(out, "%% E saturation checkpoint\ncheckpoint(%d",
+           CHECKPOINT_VERSION);
+   for(i=0; i<CHECKPOINT_COUNTERS; i++)
+   {
+      fprintf(out, ", %lu", *(counters[i]));
+   }
+   fprintf(out, ").\nhcb(%d, %ld).\n",
+           control->hcb->current_eval, control->hcb->select_count);
+
+   print_clause_set(out, "p", state->processed_pos_rules);
+   print_clause_set(out, "p", state->processed_pos_eqns);
+   print_clause_set(out, "p", state->processed_neg_units);
+   print_clause_set(out, "p", state->processed_non_units);
+   print_clause_set(out, "u", state->unprocessed);
+   fprintf(out, "end.\n");
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCheckpointSave()
+//
+//   Write a checkpoint to the file with the given name. Return false
+//   (and do nothing) if the state cannot be checkpointed.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+bool ProofStateCheckpointSave(char* name, ProofState_p state,
+                              ProofControl_p control)
+{
+   FILE* out;
+
+   if(!ProofStateCanCheckpoint(state))
+   {
+      Warning("Checkpoints are only supported for untyped first-order "
+              "problems, not writing %s", name);
+      return false;
+   }
+   out = OutOpen(name);
+   ProofStateCheckpointPrint(out, state, control);
+   OutClose(out);
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCheckpointParse()
+//
+//   Parse a checkpoint and replace the saturation state of state
+//   with it. state must have been initialized with ProofStateInit()
+//   and must not have been saturated.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes state
+//
+/----------------------------------------------------------------------*/
+
+void ProofStateCheckpointParse(Scanner_p in, ProofState_p state,
+                               ProofControl_p control)
+{
+   unsigned long* counters[CHECKPOINT_COUNTERS];
+   Clause_p       handle;
+   int            i;
+
+   assert(ProofStateProcCardinality(state) == 0);
+
+   AcceptInpId(in, "checkpoint");
+   AcceptInpTok(in, OpenBracket);
+   if(ParseInt(in) != CHECKPOINT_VERSION)
+   {
+      AktTokenError(in, "Unsupported checkpoint version", false);
+   }
+   state_counters(state, counters);
+   for(i=0; i<CHECKPOINT_COUNTERS; i++)
+   {
+      AcceptInpTok(in, Comma);
+      *(counters[i]) = ParseInt(in);
+   }
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, Fullstop);
+
+   AcceptInpId(in, "hcb");
+   AcceptInpTok(in, OpenBracket);
+   control->hcb->current_eval = ParseIntLimited(in, 0,
+                                                control->hcb->wfcb_no-1);
+   AcceptInpTok(in, Comma);
+   control->hcb->select_count = ParseInt(in);
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, Fullstop);
+
+   /* The initial clauses are replaced by the checkpointed ones */
+   ClauseSetFreeClauses(state->unprocessed);
+
+   while(TestInpId(in, "p"))
+   {
+      AcceptInpId(in, "p");
+      handle = parse_clause_record(in, state->terms);
+      restore_processed(state, control, handle);
+   }
+   while(TestInpId(in, "u"))
+   {
+      AcceptInpId(in, "u");
+      handle = parse_clause_record(in, state->terms);
+      restore_unprocessed(state, control, handle);
+   }
+   AcceptInpId(in, "end");
+   AcceptInpTok(in, Fullstop);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateCheckpointRestore()
+//
+//   Restore the saturation state from the checkpoint file with the
+//   given name. Return false (and do nothing) if the state cannot be
+//   checkpointed.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes state
+//
+/----------------------------------------------------------------------*/
+
+bool ProofStateCheckpointRestore(char* name, ProofState_p state,
+                                 ProofControl_p control)
+{
+   Scanner_p in;
+
+   if(!ProofStateCanCheckpoint(state))
+   {
+      Warning("Checkpoints are only supported for untyped first-order "
+              "problems, ignoring %s", name);
+      return false;
+   }
+   in = CreateScanner(StreamTypeFile, name, true, NULL, true);
+   ScannerSetFormat(in, TSTPFormat);
+   ProofStateCheckpointParse(in, state, control);
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+   return true;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,58 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_checkpoint.h
+
+Author: The E developers
+
+Contents
+
+  Saving and restoring the state of the saturation loop, so that a
+  search interrupted by a resource limit can be continued later.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 10:12:31 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_CHECKPOINT
+
+#define CCO_CHECKPOINT
+
+#include <cco_proofproc.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Increase whenever the file format changes */
+#define CHECKPOINT_VERSION 1
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+bool ProofStateCanCheckpoint(ProofState_p state);
+void ProofStateCheckpointPrint(FILE* out, ProofState_p state,
+                               ProofControl_p control);
+bool ProofStateCheckpointSave(char* name, ProofState_p state,
+                              ProofControl_p control);
+void ProofStateCheckpointParse(Scanner_p in, ProofState_p state,
+                               ProofControl_p control);
+bool ProofStateCheckpointRestore(char* name, ProofState_p state,
+                                 ProofControl_p control);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
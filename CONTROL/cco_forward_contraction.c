@@ -259,6 +259,14 @@ bool ForwardModifyClause(ProofState_p state,
       ClauseQueryProp(clause, CPLimitedRW) did not change any more. */
    while(!done)
    {
+      /* Ground literals decided by the congruence closure of the
+         ground units are handled before the more expensive
+         rewriting. */
+      if(state->ground_cc &&
+         GroundCCSimplifyClause(state->ground_cc, control->ocb, clause))
+      {
+         return true;
+      }
       if(problemType == PROBLEM_HO)
       {
          NormalizeEquations(clause);
@@ -407,10 +415,10 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
    assert(set);
    assert(!set->demod_index);
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle != set->anchor)
    {
-      next = handle->succ;
+      next = ClauseSucc(handle);
 
       assert(handle);
 
@@ -464,11 +472,11 @@ void ClauseSetReweight(HCB_p heuristic, ClauseSet_p set)
    {
       ClauseSetInsert(tmp_set, ClauseSetExtractFirst(set));
    }
+   HCBClauseSetEvaluate(heuristic, tmp_set);
 
    while(!ClauseSetEmpty(tmp_set))
    {
       handle = ClauseSetExtractFirst(tmp_set);
-      HCBClauseEvaluate(heuristic, handle);
       ClauseSetInsert(set, handle);
    }
    ClauseSetFree(tmp_set);
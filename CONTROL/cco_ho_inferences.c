@@ -2506,7 +2506,9 @@ void ClauseSetRecognizeChoice(IntMap_p choice_syms,
                               ClauseSet_p set,
                               ClauseSet_p archive)
 {
-   for(Clause_p handle = set->anchor->succ; handle!=set->anchor; handle = handle->succ)
+   for(Clause_p handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       ClauseRecognizeChoice(choice_syms, handle);
    }
@@ -2628,8 +2630,8 @@ void PreinstantiateInduction(FormulaSet_p forms, ClauseSet_p cls, ClauseSet_p ar
          store_abstraction_form(handle, archive, &terms_by_type);
       }
    }
-   for(Clause_p handle = cls->anchor->succ; handle != cls->anchor;
-       handle = handle->succ)
+   for(Clause_p handle = ClauseSucc(cls->anchor); handle != cls->anchor;
+       handle = ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle) && ClauseLiteralNumber(handle) == 1)
       {
@@ -2639,8 +2641,8 @@ void PreinstantiateInduction(FormulaSet_p forms, ClauseSet_p cls, ClauseSet_p ar
 
    PStack_p res = PStackAlloc();
 
-   for(Clause_p handle = cls->anchor->succ; handle != cls->anchor;
-       handle = handle->succ)
+   for(Clause_p handle = ClauseSucc(cls->anchor); handle != cls->anchor;
+       handle = ClauseSucc(handle))
    {
       PTree_p vars = NULL;
       ClauseCollectVariables(handle, &vars);
@@ -799,8 +799,8 @@ long ComputeAllParamodulants(TB_p bank, OCB_p ocb, Clause_p clause,
    Clause_p handle;
    long     paramod_count = 0;
 
-   for(handle = with_set->anchor->succ; handle != with_set->anchor;
-       handle = handle->succ)
+   for(handle = ClauseSucc(with_set->anchor); handle != with_set->anchor;
+       handle = ClauseSucc(handle))
    {
       paramod_count +=
     ComputeClauseClauseParamodulants(bank, ocb, clause,
@@ -34,6 +34,10 @@ Changes
 
 PERF_CTR_DEFINE(ParamodTimer);
 PERF_CTR_DEFINE(BWRWTimer);
+PERF_CTR_DEFINE(FwContractTimer);
+PERF_CTR_DEFINE(BwSimplifyTimer);
+PERF_CTR_DEFINE(GenerateTimer);
+PERF_CTR_DEFINE(NewClausesTimer);
 
 
 /*---------------------------------------------------------------------*/
@@ -109,10 +113,10 @@ static void check_ac_status(ProofState_p state, ProofControl_p
 
 /*-----------------------------------------------------------------------
 //
-// Function: remove_subsumed()
+// Function: remove_clause_stack()
 //
-//   Remove all clauses subsumed by subsumer from set, kill their
-//   children. Return number of removed clauses.
+//   Remove all clauses on stack (which are subsumed by subsumer) from
+//   their set, kill their children. The stack is emptied.
 //
 // Global Variables: -
 //
@@ -120,17 +124,13 @@ static void check_ac_status(ProofState_p state, ProofControl_p
 //
 /----------------------------------------------------------------------*/
 
-static long remove_subsumed(GlobalIndices_p indices,
-                            FVPackedClause_p subsumer,
-                            ClauseSet_p set,
-                            ClauseSet_p archive,
-                            bool lambda_demod)
+static void remove_clause_stack(GlobalIndices_p indices,
+                                FVPackedClause_p subsumer,
+                                PStack_p stack,
+                                ClauseSet_p archive,
+                                bool lambda_demod)
 {
    Clause_p handle;
-   long     res;
-   PStack_p stack = PStackAlloc();
-
-   res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
 
    while(!PStackEmpty(stack))
    {
@@ -152,6 +152,33 @@ static long remove_subsumed(GlobalIndices_p indices,
       ClauseSetProp(handle, CPIsDead);
       ClauseSetInsert(archive, handle);
    }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: remove_subsumed()
+//
+//   Remove all clauses subsumed by subsumer from set, kill their
+//   children. Return number of removed clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set, memory operations.
+//
+/----------------------------------------------------------------------*/
+
+static long remove_subsumed(GlobalIndices_p indices,
+                            FVPackedClause_p subsumer,
+                            ClauseSet_p set,
+                            ClauseSet_p archive,
+                            bool lambda_demod)
+{
+   long     res;
+   PStack_p stack = PStackAlloc();
+
+   res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
+   remove_clause_stack(indices, subsumer, stack, archive, lambda_demod);
    PStackFree(stack);
    return res;
 }
@@ -387,6 +414,8 @@ static long eliminate_context_sr_clauses(ProofState_p state,
 //
 //   Check if a clause subsumes one or more watchlist clauses, if yes,
 //   set appropriate property in clause and remove subsumed clauses.
+//   Clauses that cannot subsume any watchlist clause according to
+//   admin (if given) are rejected without a subsumption check.
 //
 // Global Variables: -
 //
@@ -396,34 +425,67 @@ static long eliminate_context_sr_clauses(ProofState_p state,
 
 
 void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
+                     WatchlistAdmin_p admin,
                      Clause_p clause, ClauseSet_p archive,
                      bool static_watchlist, bool lambda_demod)
 {
    FVPackedClause_p pclause;
    long removed;
+   long long start = 0;
 
    if(watchlist)
    {
-      pclause = FVIndexPackClause(clause, watchlist->fvindex);
       // printf("# check_watchlist(%p)...\n", indices);
       ClauseSubsumeOrderSortLits(clause);
       // assert(ClauseIsSubsumeOrdered(clause));
 
       clause->weight = ClauseStandardWeight(clause);
 
+      if(admin)
+      {
+         start = PerfCtrTicks();
+         admin->checks++;
+         if(!WatchlistAdminMaySubsume(admin, clause))
+         {
+            admin->filtered++;
+            admin->check_ticks += PerfCtrTicks()-start;
+            return;
+         }
+      }
+      pclause = FVIndexPackClause(clause, watchlist->fvindex);
+
       if(static_watchlist)
       {
          Clause_p subsumed;
 
-         subsumed = ClauseSetFindFirstSubsumedClause(watchlist, clause);
+         subsumed = ClauseSetFindFirstFVSubsumedClause(watchlist, pclause);
          if(subsumed)
          {
             ClauseSetProp(clause, CPSubsumesWatch);
+            if(admin)
+            {
+               admin->hits++;
+               WatchlistAdminRecordHit(admin, subsumed, false);
+            }
          }
       }
       else
       {
-         if((removed = remove_subsumed(indices, pclause, watchlist, archive, lambda_demod)))
+         PStack_p      stack = PStackAlloc();
+         PStackPointer i;
+
+         removed = ClauseSetFindFVSubsumedClauses(watchlist, pclause, stack);
+         if(admin && removed)
+         {
+            admin->hits++;
+            for(i=0; i<PStackGetSP(stack); i++)
+            {
+               WatchlistAdminRecordHit(admin, PStackElementP(stack, i), true);
+            }
+         }
+         remove_clause_stack(indices, pclause, stack, archive, lambda_demod);
+         PStackFree(stack);
+         if(removed)
          {
             ClauseSetProp(clause, CPSubsumesWatch);
             if(OutputLevel == 1)
@@ -436,6 +498,10 @@ void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
                            "extract_subsumed_watched", NULL);   }
       }
       FVUnpackClause(pclause);
+      if(admin)
+      {
+         admin->check_ticks += PerfCtrTicks()-start;
+      }
       // printf("# ...check_watchlist()\n");
    }
 }
@@ -511,6 +577,10 @@ void simplify_watchlist(ProofState_p state, ProofControl_p control,
       handle->weight = ClauseStandardWeight(handle);
       ClauseMarkMaximalTerms(control->ocb, handle);
       ClauseSetIndexedInsertClause(state->watchlist, handle);
+      if(state->wladmin)
+      {
+         WatchlistAdminAddClause(state->wladmin, handle);
+      }
       // printf("# WL Inserting: "); ClausePrint(stdout, handle, true); printf("\n");
       GlobalIndicesInsertClause(&(state->wlindices), handle, control->heuristic_parms.lambda_demod);
    }
@@ -618,16 +688,10 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
 
 void eval_clause_set(ProofState_p state, ProofControl_p control)
 {
-   Clause_p handle;
    assert(state);
    assert(control);
 
-   for(handle = state->eval_store->anchor->succ;
-       handle != state->eval_store->anchor;
-       handle = handle->succ)
-   {
-      HCBClauseEvaluate(control->hcb, handle);
-   }
+   HCBClauseSetEvaluate(control->hcb, state->eval_store);
 }
 
 
@@ -685,7 +749,7 @@ static Clause_p insert_new_clauses(ProofState_p state, ProofControl_p control)
 
 
 
-      check_watchlist(&(state->wlindices), state->watchlist,
+      check_watchlist(&(state->wlindices), state->watchlist, state->wladmin,
                       handle, state->archive,
                       control->heuristic_parms.watchlist_is_static,
                       control->heuristic_parms.lambda_demod);
@@ -1409,6 +1473,25 @@ void fvi_param_init(ProofState_p state, ProofControl_p control)
          //ClauseSetNewTerms(state->watchlist, state->terms);
       }
    }
+   if(control->heuristic_parms.backward_context_sr &&
+      (problemType != PROBLEM_HO))
+   {
+      state->processed_non_units->csr_index = CSRIndexAlloc();
+   }
+   if(control->heuristic_parms.ground_cc && (problemType != PROBLEM_HO))
+   {
+      state->ground_cc = GroundCCAlloc(state->terms);
+      state->processed_pos_rules->ground_cc = state->ground_cc;
+      state->processed_pos_eqns->ground_cc  = state->ground_cc;
+   }
+   if(control->heuristic_parms.nf_cache && (problemType != PROBLEM_HO))
+   {
+      state->nf_cache = NFCacheAlloc(state->terms,
+                                     control->heuristic_parms.nf_cache_size);
+      state->processed_pos_rules->nf_cache = state->nf_cache;
+      state->processed_pos_eqns->nf_cache  = state->nf_cache;
+      TBGCRegisterNFCache(state->terms, state->nf_cache);
+   }
    state->def_store_cspec = FVCollectAlloc(FVICollectFeatures,
                                            true,
                                            0,
@@ -1475,7 +1558,7 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
       new = ClauseCopy(handle, state->terms);
 
       ClauseSetProp(new, CPInitial);
-      check_watchlist(&(state->wlindices), state->watchlist,
+      check_watchlist(&(state->wlindices), state->watchlist, state->wladmin,
                       new, state->archive,
                       control->heuristic_parms.watchlist_is_static,
                       control->heuristic_parms.lambda_demod);
@@ -1525,6 +1608,59 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateInsertProcessed()
+//
+//   Insert a (fully simplified, normalized) clause into the
+//   appropriate processed clause set and the global indices. The
+//   FVPackedClause is unpacked (and its container freed).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes state
+//
+/----------------------------------------------------------------------*/
+
+void ProofStateInsertProcessed(ProofState_p state, ProofControl_p control,
+                               FVPackedClause_p pclause, SysDate clausedate)
+{
+   Clause_p clause = pclause->clause;
+
+   clause->date = clausedate;
+   ClauseSetProp(clause, CPLimitedRW);
+
+   if(ClauseIsDemodulator(clause))
+   {
+      assert(clause->neg_lit_no == 0);
+      if(EqnIsOriented(clause->literals))
+      {
+         TermCellSetProp(clause->literals->lterm, TPIsRewritable);
+         state->processed_pos_rules->date = clausedate;
+         ClauseSetIndexedInsert(state->processed_pos_rules, pclause);
+      }
+      else
+      {
+         state->processed_pos_eqns->date = clausedate;
+         ClauseSetIndexedInsert(state->processed_pos_eqns, pclause);
+      }
+   }
+   else if(ClauseLiteralNumber(clause) == 1)
+   {
+      assert(clause->neg_lit_no == 1);
+      ClauseSetIndexedInsert(state->processed_neg_units, pclause);
+   }
+   else
+   {
+      ClauseSetIndexedInsert(state->processed_non_units, pclause);
+   }
+   GlobalIndicesInsertClause(&(state->gindices), clause,
+                             control->heuristic_parms.lambda_demod);
+
+   FVUnpackClause(pclause);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ProcessClause()
@@ -1574,11 +1710,14 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       arch_copy = ClauseArchiveCopy(state->archive, clause);
    }
 
-   if(!(pclause = ForwardContractClause(state, control,
-                                        clause, true,
-                                        control->heuristic_parms.forward_context_sr,
-                                        control->heuristic_parms.condensing,
-                                        FullRewrite)))
+   PERF_CTR_ENTRY(FwContractTimer);
+   pclause = ForwardContractClause(state, control,
+                                   clause, true,
+                                   control->heuristic_parms.forward_context_sr,
+                                   control->heuristic_parms.condensing,
+                                   FullRewrite);
+   PERF_CTR_EXIT(FwContractTimer);
+   if(!pclause)
    {
       if(arch_copy)
       {
@@ -1616,7 +1755,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       return resclause;
    }
 
-   check_watchlist(&(state->wlindices), state->watchlist,
+   check_watchlist(&(state->wlindices), state->watchlist, state->wladmin,
                       pclause->clause, state->archive,
                       control->heuristic_parms.watchlist_is_static,
                       control->heuristic_parms.lambda_demod);
@@ -1624,6 +1763,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    /* Now on to backward simplification. */
    clausedate = ClauseSetListGetMaxDate(state->demods, FullRewrite);
 
+   PERF_CTR_ENTRY(BwSimplifyTimer);
    eliminate_backward_rewritten_clauses(state, control, pclause->clause, &clausedate);
    eliminate_backward_subsumed_clauses(state, pclause,
                                        control->heuristic_parms.lambda_demod);
@@ -1631,6 +1771,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
                                     control->heuristic_parms.lambda_demod);
    eliminate_context_sr_clauses(state, control, pclause->clause,
                                 control->heuristic_parms.lambda_demod);
+   PERF_CTR_EXIT(BwSimplifyTimer);
    ClauseSetSetProp(state->tmp_store, CPIsIRVictim);
 
    clause = pclause->clause;
@@ -1639,37 +1780,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    tmp_copy = ClauseCopyDisjoint(clause);
    tmp_copy->ident = clause->ident;
 
-   clause->date = clausedate;
-   ClauseSetProp(clause, CPLimitedRW);
-
-   if(ClauseIsDemodulator(clause))
-   {
-      assert(clause->neg_lit_no == 0);
-      if(EqnIsOriented(clause->literals))
-      {
-         TermCellSetProp(clause->literals->lterm, TPIsRewritable);
-         state->processed_pos_rules->date = clausedate;
-         ClauseSetIndexedInsert(state->processed_pos_rules, pclause);
-      }
-      else
-      {
-         state->processed_pos_eqns->date = clausedate;
-         ClauseSetIndexedInsert(state->processed_pos_eqns, pclause);
-      }
-   }
-   else if(ClauseLiteralNumber(clause) == 1)
-   {
-      assert(clause->neg_lit_no == 1);
-      ClauseSetIndexedInsert(state->processed_neg_units, pclause);
-   }
-   else
-   {
-      ClauseSetIndexedInsert(state->processed_non_units, pclause);
-   }
-   GlobalIndicesInsertClause(&(state->gindices), clause,
-                             control->heuristic_parms.lambda_demod);
-
-   FVUnpackClause(pclause);
+   ProofStateInsertProcessed(state, control, pclause, clausedate);
    ENSURE_NULL(pclause);
    if(state->watchlist && control->heuristic_parms.watchlist_simplify)
    {
@@ -1677,7 +1788,9 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    }
    if(control->heuristic_parms.selection_strategy != SelectNoGeneration)
    {
+      PERF_CTR_ENTRY(GenerateTimer);
       generate_new_clauses(state, control, clause, tmp_copy);
+      PERF_CTR_EXIT(GenerateTimer);
    }
    ClauseFree(tmp_copy);
    if(TermCellStoreNodes(&(state->tmp_terms->term_store))>TMPBANK_GC_LIMIT)
@@ -1694,7 +1807,10 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    {
       ClauseSetSort(state->tmp_store, ClauseCmpByStructWeight);
    }
-   if((empty = insert_new_clauses(state, control)))
+   PERF_CTR_ENTRY(NewClausesTimer);
+   empty = insert_new_clauses(state, control);
+   PERF_CTR_EXIT(NewClausesTimer);
+   if(empty)
    {
       PStackPushP(state->extract_roots, empty);
       return empty;
@@ -1743,6 +1859,10 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
    {
       count++;
       unsatisfiable = ProcessClause(state, control, answer_limit);
+      if(PerfCtrTracing())
+      {
+         PerfCtrTraceSnapshot(state->processed_count);
+      }
       if(unsatisfiable)
       {
          break;
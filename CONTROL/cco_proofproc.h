@@ -49,6 +49,10 @@ Changes
 
 PERF_CTR_DECL(ParamodTimer);
 PERF_CTR_DECL(BWRWTimer);
+PERF_CTR_DECL(FwContractTimer);
+PERF_CTR_DECL(BwSimplifyTimer);
+PERF_CTR_DECL(GenerateTimer);
+PERF_CTR_DECL(NewClausesTimer);
 
 
 /* Collect term cells from temporary clause copies if their number
@@ -69,6 +73,9 @@ void     ProofStateResetProcessedSet(ProofState_p state,
 void     ProofStateResetProcessed(ProofState_p state,
                                   ProofControl_p control);
 void ProofStateMoveToTmpStore(ProofState_p state, ProofControl_p control);
+void     ProofStateInsertProcessed(ProofState_p state, ProofControl_p control,
+                                   FVPackedClause_p pclause,
+                                   SysDate clausedate);
 Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
                        long answer_limit);
 Clause_p Saturate(ProofState_p state, ProofControl_p control, long
@@ -134,6 +134,7 @@ bool RemoveRewritableClausesIndexed(OCB_p ocb, ClauseSet_p into,
    bool     res;
 
    res = FindRewritableClausesIndexed(ocb, gindices->bw_rw_index,
+                                      gindices->bw_rw_paths,
                                       stack, new_demod, nf_date);
    while(!PStackEmpty(stack))
    {
@@ -169,12 +170,12 @@ long ClauseSetUnitSimplify(ClauseSet_p set, Clause_p simplifier,
    Clause_p handle, move;
    long res = 0,tmp;
 
-   handle = set->anchor->succ;
+   handle = ClauseSucc(set->anchor);
    while(handle!=set->anchor)
    {
       tmp = ClauseUnitSimplifyTest(handle, simplifier);
       move = handle;
-      handle = handle->succ;
+      handle = ClauseSucc(handle);
       if(tmp)
       {
          ClauseMoveSimplified(gindices, move, tmp_set, archive, lambda_demod);
@@ -18,6 +18,8 @@ Changes
 
 <1> Thu May 10 08:35:26 CEST 2012
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    StructFOFSpecGetProblems()
 
 -----------------------------------------------------------------------*/
 
@@ -88,6 +90,10 @@ long StructFOFSpecGetProblem(StructFOFSpec_p ctrl,
                              AxFilter_p filter,
                              PStack_p res_clauses,
                              PStack_p res_formulas);
+long StructFOFSpecGetProblems(StructFOFSpec_p ctrl,
+                              PStack_p filters,
+                              PStack_p res_clauses,
+                              PStack_p res_formulas);
 
 long ProofStateSinE(ProofState_p state, char* filter);
 
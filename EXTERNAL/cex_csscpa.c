@@ -116,7 +116,7 @@ static long collect_subsumed(Clause_p clause, ClauseSet_p set,
    long res = 0;
    Clause_p handle, position;
 
-   position = set->anchor->succ;
+   position = ClauseSucc(set->anchor);
 
    if(ClauseIsUnit(clause))
    {
@@ -125,7 +125,7 @@ static long collect_subsumed(Clause_p clause, ClauseSet_p set,
       {
     PStackPushP(subsumed, handle);
     res+=handle->weight;
-    position=handle->succ;
+    position=ClauseSucc(handle);
       }
    }
    else
@@ -135,7 +135,7 @@ static long collect_subsumed(Clause_p clause, ClauseSet_p set,
       {
     PStackPushP(subsumed, handle);
     res+=handle->weight;
-    position=handle->succ;
+    position=ClauseSucc(handle);
       }
 
    }
@@ -175,8 +175,8 @@ static Clause_p find_unit_contradiction(Clause_p clause,CSSCPAState_p state)
       set = state->pos_units;
    }
 
-   for(handle = set->anchor->succ; handle != set->anchor; handle =
-     handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle != set->anchor; handle =
+     ClauseSucc(handle))
    {
       assert(ClauseIsUnit(handle));
       assert(XOR(EqnIsPositive(lit), ClauseIsPositive(handle)));
@@ -229,8 +229,8 @@ bool ClauseSetScanAC(Sig_p sig, ClauseSet_p set)
    bool res = false;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-     handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+     ClauseSucc(handle))
    {
       res |= ClauseScanAC(sig, handle);
    }
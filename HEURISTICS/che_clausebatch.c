@@ -0,0 +1,434 @@
+/*-----------------------------------------------------------------------
+
+File  : che_clausebatch.c
+
+Author: The E developers
+
+Contents
+
+  Symbol count vectors for batches of clauses.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 16:02:31 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "che_clausebatch.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define BATCH_INIT_SIZE 64
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_array_ensure()
+//
+//   Make sure that the array (with *size elements of elsize bytes)
+//   can hold at least needed elements. Return the (possibly moved)
+//   array.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void* batch_array_ensure(void* array, long *size, long needed,
+                                size_t elsize)
+{
+   if(needed > *size)
+   {
+      while(needed > *size)
+      {
+         *size *= 2;
+      }
+      array = SecureRealloc(array, *size*elsize);
+   }
+   return array;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_add_side()
+//
+//   Compute the counts for term and append its symbol counts to the
+//   batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void batch_add_side(ClauseBatch_p batch, BatchSide_p side,
+                           Term_p term)
+{
+   PStack_p      stack = batch->touched;
+   PStackPointer base = PStackGetSP(stack);
+   Term_p        t;
+   FunCode       f_code;
+   long          *count, i;
+   int           j;
+
+   side->term      = term;
+   side->vcount    = 0;
+   side->fcount    = 0;
+   side->sym_start = batch->sym_no;
+
+   PStackPushP(stack, term);
+   while(PStackGetSP(stack) > base)
+   {
+      t = PStackPopP(stack);
+      if(TermIsFreeVar(t))
+      {
+         side->vcount++;
+         continue;
+      }
+      side->fcount++;
+      count = &(PDArrayElementInt(batch->f_occur, t->f_code));
+      if(!*count)
+      {
+         batch->syms = batch_array_ensure(batch->syms, &(batch->sym_size),
+                                          batch->sym_no+1,
+                                          sizeof(BatchSymCell));
+         batch->syms[batch->sym_no].f_code = t->f_code;
+         batch->sym_no++;
+      }
+      (*count)++;
+      for(j=0; j<t->arity; j++)
+      {
+         PStackPushP(stack, t->args[j]);
+      }
+   }
+   side->sym_end = batch->sym_no;
+   for(i=side->sym_start; i<side->sym_end; i++)
+   {
+      f_code = batch->syms[i].f_code;
+      batch->syms[i].count = PDArrayElementInt(batch->f_occur, f_code);
+      PDArrayAssignInt(batch->f_occur, f_code, 0);
+   }
+   assert(!TermIsShared(term) ||
+          (side->vcount == term->v_count && side->fcount == term->f_count));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_lit_sides()
+//
+//   Return the counts for the current left and right side of the
+//   literal in *lside and *rside.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void batch_lit_sides(BatchLit_p blit, BatchSide_p *lside,
+                            BatchSide_p *rside)
+{
+   if(blit->lit->lterm == blit->lside.term)
+   {
+      *lside = &(blit->lside);
+      *rside = &(blit->rside);
+   }
+   else
+   {
+      *lside = &(blit->rside);
+      *rside = &(blit->lside);
+   }
+   assert((*lside)->term == blit->lit->lterm);
+   assert((*rside)->term == blit->lit->rterm);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseBatchAlloc()
+//
+//   Allocate an empty batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ClauseBatch_p ClauseBatchAlloc(void)
+{
+   ClauseBatch_p handle = ClauseBatchCellAlloc();
+
+   handle->clause_no   = 0;
+   handle->clause_size = BATCH_INIT_SIZE;
+   handle->clauses     = SecureMalloc(handle->clause_size*sizeof(Clause_p));
+   handle->lit_start   = SecureMalloc((handle->clause_size+1)*sizeof(long));
+   handle->lit_no      = 0;
+   handle->lit_size    = BATCH_INIT_SIZE;
+   handle->lits        = SecureMalloc(handle->lit_size*sizeof(BatchLitCell));
+   handle->sym_no      = 0;
+   handle->sym_size    = BATCH_INIT_SIZE;
+   handle->syms        = SecureMalloc(handle->sym_size*sizeof(BatchSymCell));
+   handle->f_occur     = PDIntArrayAlloc(64, 0);
+   handle->touched     = PStackAlloc();
+
+   handle->lit_start[0] = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseBatchFree()
+//
+//   Free a batch (but not the clauses).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseBatchFree(ClauseBatch_p junk)
+{
+   FREE(junk->clauses);
+   FREE(junk->lit_start);
+   FREE(junk->lits);
+   FREE(junk->syms);
+   PDArrayFree(junk->f_occur);
+   PStackFree(junk->touched);
+   ClauseBatchCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseBatchBuild()
+//
+//   Replace the contents of batch by the clauses of set (in order)
+//   and their symbol counts.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseBatchBuild(ClauseBatch_p batch, ClauseSet_p set)
+{
+   Clause_p   handle;
+   Eqn_p      lit;
+   BatchLit_p blit;
+   long       old_size;
+
+   batch->clause_no = 0;
+   batch->lit_no    = 0;
+   batch->sym_no    = 0;
+
+   for(handle = ClauseSucc(set->anchor);
+       handle != set->anchor;
+       handle = ClauseSucc(handle))
+   {
+      old_size = batch->clause_size;
+      batch->clauses = batch_array_ensure(batch->clauses,
+                                          &(batch->clause_size),
+                                          batch->clause_no+1,
+                                          sizeof(Clause_p));
+      if(batch->clause_size != old_size)
+      {
+         batch->lit_start = SecureRealloc(batch->lit_start,
+                                          (batch->clause_size+1)*sizeof(long));
+      }
+      batch->clauses[batch->clause_no] = handle;
+      for(lit = handle->literals; lit; lit = lit->next)
+      {
+         batch->lits = batch_array_ensure(batch->lits, &(batch->lit_size),
+                                          batch->lit_no+1,
+                                          sizeof(BatchLitCell));
+         blit = &(batch->lits[batch->lit_no]);
+         blit->lit = lit;
+         batch_add_side(batch, &(blit->lside), lit->lterm);
+         batch_add_side(batch, &(blit->rside), lit->rterm);
+         batch->lit_no++;
+      }
+      batch->clause_no++;
+      batch->lit_start[batch->clause_no] = batch->lit_no;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BatchSideFunWeight()
+//
+//   Return the weight of a side with individual function symbol
+//   weights, computed as the dot product of the symbol counts and
+//   fweights (see TermFsumWeight()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long BatchSideFunWeight(ClauseBatch_p batch, BatchSide_p side,
+                        long vweight, long flimit, long *fweights,
+                        long default_fweight)
+{
+   long       res = side->vcount*vweight;
+   BatchSym_p sym, end = batch->syms+side->sym_end;
+
+   for(sym = batch->syms+side->sym_start; sym < end; sym++)
+   {
+      res += sym->count*
+         ((sym->f_code < flimit)?fweights[sym->f_code]:default_fweight);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseBatchWeight()
+//
+//   Return the weight of clause i of batch, as ClauseWeight() (with
+//   app_var_mult irrelevant, as batches are first-order only). The
+//   order of floating point operations is the same, so the results
+//   are identical.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseBatchWeight(ClauseBatch_p batch, long i,
+                         double max_term_multiplier,
+                         double max_literal_multiplier,
+                         double pos_multiplier, long vweight,
+                         long fweight, bool count_eq_encoding)
+{
+   BatchLit_p  blit, end = ClauseBatchLitEnd(batch, i);
+   BatchSide_p lside, rside;
+   double      res = 0, lres;
+
+   for(blit = ClauseBatchLitBegin(batch, i); blit < end; blit++)
+   {
+      batch_lit_sides(blit, &lside, &rside);
+      if(count_eq_encoding || EqnIsEquLit(blit->lit))
+      {
+         if(EqnIsOriented(blit->lit))
+         {
+            lres = (double)BatchSideWeight(rside, vweight, fweight);
+         }
+         else
+         {
+            lres = (double)BatchSideWeight(rside, vweight, fweight)*
+               max_term_multiplier;
+         }
+         if(!count_eq_encoding)
+         {
+            lres += fweight;
+         }
+      }
+      else
+      {
+         lres = 0;
+      }
+      lres += (double)BatchSideWeight(lside, vweight, fweight)*
+         max_term_multiplier;
+      if(EqnIsMaximal(blit->lit))
+      {
+         lres = lres*max_literal_multiplier;
+      }
+      if(EqnIsPositive(blit->lit))
+      {
+         lres = lres*pos_multiplier;
+      }
+      res += lres;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseBatchFunWeight()
+//
+//   Return the weight of clause i of batch with individual function
+//   symbol weights, as ClauseFunWeight() for first-order clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+double ClauseBatchFunWeight(ClauseBatch_p batch, long i,
+                            double max_term_multiplier,
+                            double max_literal_multiplier,
+                            double pos_multiplier, long vweight,
+                            long flimit, long *fweights,
+                            long default_fweight)
+{
+   BatchLit_p  blit, end = ClauseBatchLitEnd(batch, i);
+   BatchSide_p lside, rside;
+   double      res = 0, lres;
+
+   for(blit = ClauseBatchLitBegin(batch, i); blit < end; blit++)
+   {
+      batch_lit_sides(blit, &lside, &rside);
+      lres = (double)BatchSideFunWeight(batch, rside, vweight,
+                                        flimit, fweights, default_fweight);
+      if(!EqnIsOriented(blit->lit))
+      {
+         lres *= max_term_multiplier;
+      }
+      lres += (double)BatchSideFunWeight(batch, lside, vweight,
+                                         flimit, fweights,
+                                         default_fweight)*max_term_multiplier;
+      if(EqnIsMaximal(blit->lit))
+      {
+         lres = lres*max_literal_multiplier;
+      }
+      if(EqnIsPositive(blit->lit))
+      {
+         lres = lres*pos_multiplier;
+      }
+      res += lres;
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
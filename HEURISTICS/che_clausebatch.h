@@ -0,0 +1,128 @@
+/*-----------------------------------------------------------------------
+
+File  : che_clausebatch.h
+
+Author: The E developers
+
+Contents
+
+  Batches of clauses for evaluation: For each literal side of each
+  clause, the number of variable occurrences and the (sparse) vector
+  of function symbol occurrence counts is computed once. Weight
+  functions that are (modified) weighted symbol counts can then
+  evaluate the whole batch with dot products over these vectors
+  instead of traversing the terms once for every weight function.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 16:02:31 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_CLAUSEBATCH
+
+#define CHE_CLAUSEBATCH
+
+#include <ccl_clausesets.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Number of occurrences of one function symbol in a term */
+
+typedef struct batch_sym_cell
+{
+   FunCode f_code;
+   long    count;
+}BatchSymCell, *BatchSym_p;
+
+/* Counts for one side of a literal. The symbol counts are
+   syms[sym_start]...syms[sym_end-1] of the batch. */
+
+typedef struct batch_side_cell
+{
+   Term_p term;
+   long vcount;
+   long fcount;
+   long sym_start;
+   long sym_end;
+}BatchSideCell, *BatchSide_p;
+
+/* One literal. Orientation, maximality and sign are read from the
+   literal itself, as weight functions may (re-)compute them. Note
+   that orienting a literal may swap its sides, so lside and rside
+   are the sides at the time the batch was built. */
+
+typedef struct batch_lit_cell
+{
+   Eqn_p         lit;
+   BatchSideCell lside;
+   BatchSideCell rside;
+}BatchLitCell, *BatchLit_p;
+
+/* The batch. Clause i has the literals lits[lit_start[i]] ...
+   lits[lit_start[i+1]-1]. All arrays are reused between batches. */
+
+typedef struct clause_batch_cell
+{
+   long         clause_no;
+   long         clause_size;
+   Clause_p     *clauses;
+   long         *lit_start;
+   long         lit_no;
+   long         lit_size;
+   BatchLitCell *lits;
+   long         sym_no;
+   long         sym_size;
+   BatchSymCell *syms;
+   PDArray_p    f_occur; /* Scratch counters, always 0 between uses */
+   PStack_p     touched; /* Scratch stack */
+}ClauseBatchCell, *ClauseBatch_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define ClauseBatchCellAlloc()    (ClauseBatchCell*)SizeMalloc(sizeof(ClauseBatchCell))
+#define ClauseBatchCellFree(junk) SizeFree(junk, sizeof(ClauseBatchCell))
+
+#define ClauseBatchLitBegin(batch, i) ((batch)->lits+(batch)->lit_start[(i)])
+#define ClauseBatchLitEnd(batch, i)   ((batch)->lits+(batch)->lit_start[(i)+1])
+#define BatchSideWeight(side, vweight, fweight) \
+        ((side)->vcount*(vweight)+(side)->fcount*(fweight))
+
+ClauseBatch_p ClauseBatchAlloc(void);
+void          ClauseBatchFree(ClauseBatch_p junk);
+
+void          ClauseBatchBuild(ClauseBatch_p batch, ClauseSet_p set);
+
+long          BatchSideFunWeight(ClauseBatch_p batch, BatchSide_p side,
+                                 long vweight, long flimit, long *fweights,
+                                 long default_fweight);
+double        ClauseBatchWeight(ClauseBatch_p batch, long i,
+                                double max_term_multiplier,
+                                double max_literal_multiplier,
+                                double pos_multiplier, long vweight,
+                                long fweight, bool count_eq_encoding);
+double        ClauseBatchFunWeight(ClauseBatch_p batch, long i,
+                                   double max_term_multiplier,
+                                   double max_literal_multiplier,
+                                   double pos_multiplier, long vweight,
+                                   long flimit, long *fweights,
+                                   long default_fweight);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -448,7 +448,7 @@ void ClauseInfoPrint(FILE* out, Clause_p clause)
 {
    fprintf(out, "info(%ld, %ld, %ld, %ld, %ld, %d, %ld, %ld)",
       clause->ident,
-      clause->proof_depth,
+      (long)clause->proof_depth,
       clause->proof_size,
       (long)ClauseWeight(clause, 1, 1, 1, 1, 1, 1, false),
       ClauseDepth(clause),
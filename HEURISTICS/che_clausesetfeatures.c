@@ -26,6 +26,23 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+#define IS_NON_FO_TERM(t) ( TermIsNonFOPattern(t) || TermHasLambdaSubterm(t) || TermHasDBSubterm(t) )
+
+/* Shared state for the ForkMapLong() workers of
+   ClauseSetFeatureCountsCompute(). Work item i is counter (i mod
+   slot_no) of clause chunk (i div slot_no), so that every worker
+   traverses its chunk once and then just reports the counters. */
+
+typedef struct feature_chunk_cell
+{
+   Clause_p                   *clauses;
+   long                       clause_no;
+   long                       chunk_size;
+   long                       slot_no;
+   long                       current;
+   ClauseSetFeatureCountsCell counts;
+}FeatureChunkCell, *FeatureChunk_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -36,6 +53,203 @@
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: collect_arity_information()
+//
+//   Compute the arity information described at
+//   ClauseSetCollectArityInformation() for the symbols with non-zero
+//   entries in dist_array (indexed by f_code). Returns number of
+//   function symbol constants.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long collect_arity_information(Sig_p sig, long *dist_array,
+                                      int *max_fun_arity,
+                                      int *avg_fun_arity,
+                                      int *sum_fun_arity,
+                                      int *max_pred_arity,
+                                      int *avg_pred_arity,
+                                      int *sum_pred_arity,
+                                      int *non_const_funs,
+                                      int *non_const_preds)
+{
+   int max_f_arity = 0,
+      sum_f_arity = 0,
+      f_count = 0,
+      c_count = 0,
+      non_const_p = 0;
+   int max_p_arity = 0,
+      sum_p_arity = 0,
+      p_count = 0;
+   FunCode i;
+
+   for(i=1; i<= sig->f_count; i++)
+   {
+      if(!SigIsSpecial(sig, i)&&dist_array[i])
+      {
+         short arity = SigFindArity(sig, i);
+         if(SigIsPredicate(sig, i))
+         {
+            max_p_arity = MAX(arity, max_p_arity);
+            sum_p_arity += arity;
+            p_count++;
+            if(arity)
+            {
+               non_const_p++;
+            }
+         }
+         else
+         {
+            if(arity)
+            {
+               max_f_arity = MAX(arity, max_f_arity);
+               sum_f_arity += arity;
+               f_count++;
+            }
+            else
+            {
+               c_count++;
+            }
+         }
+      }
+   }
+   *max_fun_arity   = max_f_arity;
+   *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
+   *sum_fun_arity   = sum_f_arity;
+   *max_pred_arity  = max_p_arity;
+   *avg_pred_arity  = p_count?sum_p_arity/p_count:0;
+   *sum_pred_arity  = sum_p_arity;
+   *non_const_funs  = f_count;
+   *non_const_preds = non_const_p;
+
+   return c_count;
+}
+
+
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: feature_counts_reset()
+//
+//   Set all counters in counts to 0.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void feature_counts_reset(ClauseSetFeatureCounts_p counts)
+{
+   int i;
+
+   for(i=0; i<CSFSlotNo; i++)
+   {
+      counts->slots[i] = 0;
+   }
+   memset(counts->symbols, 0, sizeof(long)*(counts->f_count+1));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: feature_counts_init()
+//
+//   Initialize counts for symbols up to f_count and set all counters
+//   to 0.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void feature_counts_init(ClauseSetFeatureCounts_p counts,
+                                FunCode f_count)
+{
+   counts->f_count = f_count;
+   counts->symbols = SizeMalloc(sizeof(long)*(f_count+1));
+   feature_counts_reset(counts);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: feature_counts_merge()
+//
+//   Merge the counters in values (laid out as the slots, followed by
+//   the symbol counts 0..f_count) into counts.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void feature_counts_merge(ClauseSetFeatureCounts_p counts,
+                                 long* values)
+{
+   int     i;
+   FunCode f;
+
+   for(i=0; i<CSFDepthMax; i++)
+   {
+      counts->slots[i] += values[i];
+   }
+   for(i=CSFDepthMax; i<CSFSlotNo; i++)
+   {
+      counts->slots[i] = MAX(counts->slots[i], values[i]);
+   }
+   for(f=1; f<=counts->f_count; f++)
+   {
+      counts->symbols[f] += values[CSFSlotNo+f];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: feature_chunk_slot()
+//
+//   ForkMapLong() callback: Return the value of one counter of one
+//   chunk of clauses (see FeatureChunkCell). The counters of the
+//   chunk are computed on first access.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cached chunk in data.
+//
+/----------------------------------------------------------------------*/
+
+static long feature_chunk_slot(void* data, long idx)
+{
+   FeatureChunk_p task = data;
+   long chunk = idx/task->slot_no,
+      slot  = idx%task->slot_no,
+      i, end;
+
+   if(chunk != task->current)
+   {
+      feature_counts_reset(&(task->counts));
+      end = MIN((chunk+1)*task->chunk_size, task->clause_no);
+      for(i=chunk*task->chunk_size; i<end; i++)
+      {
+         ClauseFeatureCountsAdd(&(task->counts), task->clauses[i]);
+      }
+      task->current = chunk;
+   }
+   if(slot < CSFSlotNo)
+   {
+      return task->counts.slots[slot];
+   }
+   return task->counts.symbols[slot-CSFSlotNo];
+}
 
 
 /*---------------------------------------------------------------------*/
@@ -134,8 +348,8 @@ long ClauseSetCountGoals(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsGoal(handle))
       {
@@ -162,8 +376,8 @@ long ClauseSetCountUnit(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsUnit(handle))
       {
@@ -191,8 +405,8 @@ long ClauseSetCountUnitGoals(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsUnit(handle)&&ClauseIsGoal(handle))
       {
@@ -220,8 +434,8 @@ long ClauseSetCountHorn(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsHorn(handle))
       {
@@ -248,8 +462,8 @@ long ClauseSetCountHornGoals(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsHorn(handle)&&ClauseIsGoal(handle))
       {
@@ -277,8 +491,8 @@ long ClauseSetCountEquational(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsEquational(handle))
       {
@@ -305,8 +519,8 @@ long ClauseSetCountPureEquational(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsPureEquational(handle))
       {
@@ -334,8 +548,8 @@ long ClauseSetCountPosUnits(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsDemodulator(handle))
       {
@@ -363,8 +577,8 @@ long ClauseSetCountGroundGoals(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsGoal(handle) && ClauseIsGround(handle))
       {
@@ -392,8 +606,8 @@ long ClauseSetCountGround(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsGround(handle))
       {
@@ -421,8 +635,8 @@ long ClauseSetCountGroundUnitAxioms(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsDemodulator(handle) && ClauseIsGround(handle))
       {
@@ -450,8 +664,8 @@ long ClauseSetCountGroundPositiveAxioms(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsPositive(handle) && ClauseIsGround(handle))
       {
@@ -479,8 +693,8 @@ long ClauseSetCountPositiveAxioms(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsPositive(handle))
       {
@@ -508,8 +722,8 @@ long ClauseSetCountRangeRestricted(ClauseSet_p set)
    long     res = 0;
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsRangeRestricted(handle))
       {
@@ -570,16 +784,9 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
                                       int *non_const_funs,
                                       int *non_const_preds)
 {
-   int max_f_arity = 0,
-      sum_f_arity = 0,
-      f_count = 0,
-      c_count = 0,
-      non_const_p = 0;
-   int max_p_arity = 0,
-      sum_p_arity = 0,
-      p_count = 0;
    long  array_size = sizeof(long)*(sig->f_count+1);
    long *dist_array = SizeMalloc(array_size);
+   long  res;
    FunCode i;
 
    for(i=1; i<= sig->f_count; i++)
@@ -587,49 +794,14 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
       dist_array[i] = 0;
    }
    ClauseSetAddSymbolDistribution(set, dist_array);
-
-   for(i=1; i<= sig->f_count; i++)
-   {
-      if(!SigIsSpecial(sig, i)&&dist_array[i])
-      {
-         short arity = SigFindArity(sig, i);
-         if(SigIsPredicate(sig, i))
-         {
-            max_p_arity = MAX(arity, max_p_arity);
-            sum_p_arity += arity;
-            p_count++;
-            if(arity)
-            {
-               non_const_p++;
-            }
-         }
-         else
-         {
-            if(arity)
-            {
-               max_f_arity = MAX(arity, max_f_arity);
-               sum_f_arity += arity;
-               f_count++;
-            }
-            else
-            {
-               c_count++;
-            }
-         }
-      }
-   }
+   res = collect_arity_information(sig, dist_array,
+                                   max_fun_arity, avg_fun_arity,
+                                   sum_fun_arity, max_pred_arity,
+                                   avg_pred_arity, sum_pred_arity,
+                                   non_const_funs, non_const_preds);
    SizeFree(dist_array, array_size);
 
-   *max_fun_arity   = max_f_arity;
-   *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
-   *sum_fun_arity   = sum_f_arity;
-   *max_pred_arity  = max_p_arity;
-   *avg_pred_arity  = p_count?sum_p_arity/p_count:0;
-   *sum_pred_arity  = sum_p_arity;
-   *non_const_funs  = f_count;
-   *non_const_preds = non_const_p;
-
-   return c_count;
+   return res;
 }
 
 
@@ -651,8 +823,8 @@ long ClauseSetCountMaximalTerms(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseCountMaximalTerms(handle);
    }
@@ -676,8 +848,8 @@ long ClauseSetCountMaximalLiterals(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseCountMaximalLiterals(handle);
    }
@@ -703,8 +875,8 @@ long ClauseSetCountVariables(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseCountVariableSet(handle);
    }
@@ -730,8 +902,8 @@ long ClauseSetCountSingletons(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseCountSingletonSet(handle);
    }
@@ -757,8 +929,8 @@ long ClauseSetTPTPDepthInfoAdd(ClauseSet_p set, long* depthmax, long*
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       ClauseTPTPDepthInfoAdd(handle, depthmax, depthsum, count);
    }
@@ -783,8 +955,8 @@ long ClauseSetCountUnorientableLiterals(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseCountUnorientableLiterals(handle);
    }
@@ -808,8 +980,8 @@ long ClauseSetCountEqnLiterals(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClausePropLitNumber(handle, EPIsEquLiteral);
    }
@@ -860,8 +1032,8 @@ long ClauseSetTermCells(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res += ClauseWeight(handle, 1, 1, 1, 1, 1, 1, false);
    }
@@ -886,8 +1058,8 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
    Clause_p handle;
    long     res = 0;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       res = MAX(res, ClauseLiteralNumber(handle));
    }
@@ -895,6 +1067,203 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFeatureCountsInit()
+//
+//   Initialize counts for clauses over sig, with all counters set to
+//   0.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetFeatureCountsInit(ClauseSetFeatureCounts_p counts, Sig_p sig)
+{
+   feature_counts_init(counts, sig->f_count);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFeatureCountsFree()
+//
+//   Free the memory held by counts (but not the cell itself).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetFeatureCountsFree(ClauseSetFeatureCounts_p counts)
+{
+   SizeFree(counts->symbols, sizeof(long)*(counts->f_count+1));
+   counts->symbols = NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseFeatureCountsAdd()
+//
+//   Add the contribution of a single clause to all counters in
+//   counts. This computes the same values as the individual
+//   ClauseSetCount*() functions (and ClauseSetTermCells(),
+//   ClauseSetTPTPDepthInfoAdd(), ClauseSetAddSymbolDistribution(),
+//   ClauseSetComputeHOFeatures()), but visits the clause only once.
+//
+// Global Variables: -
+//
+// Side Effects    : May create new terms for recognizing choice
+//                   definitions.
+//
+/----------------------------------------------------------------------*/
+
+void ClauseFeatureCountsAdd(ClauseSetFeatureCounts_p counts, Clause_p clause)
+{
+   long     *slots = counts->slots;
+   bool     goal   = ClauseIsGoal(clause),
+      ground       = ClauseIsGround(clause),
+      non_fo       = false,
+      app_var      = false,
+      bool_vars    = false;
+   Eqn_p    eqn;
+   PTree_p  vars = NULL, node;
+   PStack_p iter;
+
+   if(goal)
+   {
+      slots[CSFGoals]++;
+      if(ground)
+      {
+         slots[CSFGroundGoals]++;
+      }
+   }
+   if(ClauseIsUnit(clause))
+   {
+      slots[CSFUnit]++;
+      if(goal)
+      {
+         slots[CSFUnitGoals]++;
+      }
+   }
+   if(ClauseIsHorn(clause))
+   {
+      slots[CSFHorn]++;
+      if(goal)
+      {
+         slots[CSFHornGoals]++;
+      }
+   }
+   if(ClauseIsEquational(clause))
+   {
+      slots[CSFEquational]++;
+   }
+   if(ClauseIsPureEquational(clause))
+   {
+      slots[CSFPureEquational]++;
+   }
+   if(ClauseIsDemodulator(clause) && ground)
+   {
+      slots[CSFGroundUnitAxioms]++;
+   }
+   if(ClauseIsPositive(clause))
+   {
+      slots[CSFPositiveAxioms]++;
+      if(ground)
+      {
+         slots[CSFGroundPositiveAxioms]++;
+      }
+   }
+   slots[CSFTermCells] += ClauseWeight(clause, 1, 1, 1, 1, 1, 1, false);
+   ClauseTPTPDepthInfoAdd(clause, &(slots[CSFDepthMax]),
+                          &(slots[CSFDepthSum]), &(slots[CSFDepthCount]));
+   ClauseAddSymbolDistribution(clause, counts->symbols);
+
+   ClauseCollectVariables(clause, &vars);
+   iter = PTreeTraverseInit(vars);
+   while(!bool_vars && (node = PTreeTraverseNext(iter)))
+   {
+      bool_vars = TypeHasBool(((Term_p)node->key)->type);
+   }
+   PTreeTraverseExit(iter);
+   PTreeFree(vars);
+
+   for(eqn = clause->literals; eqn; eqn = eqn->next)
+   {
+      non_fo = non_fo || IS_NON_FO_TERM(eqn->lterm)
+                      || IS_NON_FO_TERM(eqn->rterm);
+      app_var = app_var || TermIsAppliedFreeVar(eqn->lterm)
+                        || TermIsAppliedFreeVar(eqn->rterm);
+   }
+   slots[CSFNonFOClauses]   += non_fo?1:0;
+   slots[CSFAppVarClauses]  += app_var?1:0;
+   slots[CSFBoolVarClauses] += bool_vars?1:0;
+   slots[CSFChoiceClauses]  += ClauseRecognizeChoice(NULL, clause)?1:0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFeatureCountsCompute()
+//
+//   Add the counters of all clauses in set to counts in a single
+//   traversal. If workers > 1 and the set is large enough, split the
+//   set into chunks that are counted in parallel by fork()ed
+//   workers.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, may create processes.
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetFeatureCountsCompute(ClauseSetFeatureCounts_p counts,
+                                   ClauseSet_p set, int workers)
+{
+   Clause_p         handle;
+   FeatureChunkCell task;
+   long             i, items, *results;
+
+   workers = MIN(workers, set->members/FEATURE_MIN_CHUNK);
+   if(workers <= 1)
+   {
+      for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+             ClauseSucc(handle))
+      {
+         ClauseFeatureCountsAdd(counts, handle);
+      }
+      return;
+   }
+   task.clause_no  = set->members;
+   task.clauses    = SizeMalloc(sizeof(Clause_p)*task.clause_no);
+   i = 0;
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
+   {
+      task.clauses[i++] = handle;
+   }
+   task.chunk_size = (task.clause_no+workers-1)/workers;
+   task.slot_no    = CSFSlotNo+counts->f_count+1;
+   task.current    = -1;
+   feature_counts_init(&(task.counts), counts->f_count);
+
+   items   = workers*task.slot_no;
+   results = SizeMalloc(sizeof(long)*items);
+   ForkMapLong(items, workers, feature_chunk_slot, &task, results);
+   for(i=0; i<workers; i++)
+   {
+      feature_counts_merge(counts, results+i*task.slot_no);
+   }
+   SizeFree(results, sizeof(long)*items);
+   ClauseSetFeatureCountsFree(&(task.counts));
+   SizeFree(task.clauses, sizeof(Clause_p)*task.clause_no);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SpecFeaturesCompute()
@@ -910,48 +1279,70 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 void SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p set,
                          FormulaSet_p fset, FormulaSet_p farch, TB_p bank)
 {
-   long tmp, count;
+   SpecFeaturesComputeParallel(features, set, fset, farch, bank, 1);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecFeaturesComputeParallel()
+//
+//   Compute all relevant features for a set of clauses, collecting
+//   the clause counts in a single pass (with up to workers
+//   processes, see ClauseSetFeatureCountsCompute()).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, may create processes.
+//
+/----------------------------------------------------------------------*/
+
+void SpecFeaturesComputeParallel(SpecFeature_p features, ClauseSet_p set,
+                                 FormulaSet_p fset, FormulaSet_p farch,
+                                 TB_p bank, int workers)
+{
    Sig_p sig = bank->sig;
+   ClauseSetFeatureCountsCell counts;
+   long  *slots = counts.slots;
+
+   ClauseSetFeatureCountsInit(&counts, sig);
+   ClauseSetFeatureCountsCompute(&counts, set, workers);
+
    features->clauses          = set->members;
-   features->goals            = ClauseSetCountGoals(set);
+   features->goals            = slots[CSFGoals];
    features->axioms           = features->clauses-features->goals;
 
    features->literals         = set->literals;
-   features->term_cells       = ClauseSetTermCells(set);
-
-   tmp = 0;
-   count = 0;
-   features->clause_max_depth = 0;
-   ClauseSetTPTPDepthInfoAdd(set,
-                             &(features->clause_max_depth),
-                             &tmp,
-                             &count);
-   features->clause_avg_depth = count?tmp/count:0;
-
-   features->unit             = ClauseSetCountUnit(set);
-   features->unitgoals        = ClauseSetCountUnitGoals(set);
+   features->term_cells       = slots[CSFTermCells];
+
+   features->clause_max_depth = slots[CSFDepthMax];
+   features->clause_avg_depth = slots[CSFDepthCount]?
+      slots[CSFDepthSum]/slots[CSFDepthCount]:0;
+
+   features->unit             = slots[CSFUnit];
+   features->unitgoals        = slots[CSFUnitGoals];
    features->unitaxioms       = features->unit-features->unitgoals;
 
-   features->horn             = ClauseSetCountHorn(set);
-   features->horngoals        = ClauseSetCountHornGoals(set);
+   features->horn             = slots[CSFHorn];
+   features->horngoals        = slots[CSFHornGoals];
    features->hornaxioms       = features->horn-features->horngoals;
 
-   features->eq_clauses       = ClauseSetCountEquational(set);
-   features->peq_clauses      = ClauseSetCountPureEquational(set);
-   features->groundunitaxioms = ClauseSetCountGroundUnitAxioms(set);
-   features->groundgoals      = ClauseSetCountGroundGoals(set);
-   features->positiveaxioms   = ClauseSetCountPositiveAxioms(set);
-   features->groundpositiveaxioms = ClauseSetCountGroundPositiveAxioms(set);
+   features->eq_clauses       = slots[CSFEquational];
+   features->peq_clauses      = slots[CSFPureEquational];
+   features->groundunitaxioms = slots[CSFGroundUnitAxioms];
+   features->groundgoals      = slots[CSFGroundGoals];
+   features->positiveaxioms   = slots[CSFPositiveAxioms];
+   features->groundpositiveaxioms = slots[CSFGroundPositiveAxioms];
    features->fun_const_count   =
-      ClauseSetCollectArityInformation(set, sig,
-                                       &(features->max_fun_arity),
-                                       &(features->avg_fun_arity),
-                                       &(features->sum_fun_arity),
-                                       &(features->max_pred_arity),
-                                       &(features->avg_pred_arity),
-                                       &(features->sum_pred_arity),
-                                       &(features->fun_nonconst_count),
-                                       &(features->pred_nonconst_count));
+      collect_arity_information(sig, counts.symbols,
+                                &(features->max_fun_arity),
+                                &(features->avg_fun_arity),
+                                &(features->sum_fun_arity),
+                                &(features->max_pred_arity),
+                                &(features->avg_pred_arity),
+                                &(features->sum_pred_arity),
+                                &(features->fun_nonconst_count),
+                                &(features->pred_nonconst_count));
 
    features->goals_are_ground = (features->groundgoals ==
                                  features->goals);
@@ -1037,13 +1428,15 @@ void SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p set,
 
    /* all ho features computed below */
    features->num_of_definitions = -1;
-   ClauseSetComputeHOFeatures(set, sig, 
-                              &(features->has_ho_features),
-                              &(features->order),
-                              &(features->quantifies_booleans),
-                              &(features->has_defined_choice),
-                              &(features->perc_of_appvar_lits));
-   // overwriting order as different clausifications can influence it.
+   features->has_ho_features = slots[CSFNonFOClauses]!=0;
+   features->quantifies_booleans = slots[CSFBoolVarClauses]!=0;
+   features->has_defined_choice = slots[CSFChoiceClauses]!=0;
+   features->perc_of_appvar_lits = set->members?
+      ((double)slots[CSFAppVarClauses]/set->members):0.0;
+   ClauseSetFeatureCountsFree(&counts);
+
+   // order is taken from the formulas, as different clausifications
+   // can influence it.
    features->order = 1;
    features->goal_order = 1;
    FormulaSet_p sets[2] = {farch, fset};
@@ -1602,8 +1995,8 @@ void ClauseSetPrintPosUnits(FILE* out, ClauseSet_p set, bool
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsDemodulator(handle))
       {
@@ -1629,8 +2022,8 @@ void ClauseSetPrintNegUnits(FILE* out, ClauseSet_p set, bool
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsUnit(handle)&&ClauseIsGoal(handle))
       {
@@ -1657,8 +2050,8 @@ void ClauseSetPrintNonUnits(FILE* out, ClauseSet_p set, bool
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(!ClauseIsUnit(handle))
       {
@@ -1830,8 +2223,6 @@ SpecLimits_p CreateDefaultSpecLimits(void)
 //
 /----------------------------------------------------------------------*/
 
-#define IS_NON_FO_TERM(t) ( TermIsNonFOPattern(t) || TermHasLambdaSubterm(t) || TermHasDBSubterm(t) )
-
 void ClauseSetComputeHOFeatures(ClauseSet_p set, Sig_p sig,
                                 bool* has_ho_features,
                                 int* order,
@@ -1851,8 +2242,8 @@ void ClauseSetComputeHOFeatures(ClauseSet_p set, Sig_p sig,
       ord = MAX(ord, TypeGetOrder(SigGetType(sig, i)));
    }
 
-   for(handle = set->anchor->succ; handle!=set->anchor;
-       handle = handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor;
+       handle = ClauseSucc(handle))
    {
       PTree_p vars = NULL;
       ClauseCollectVariables(handle, &vars);
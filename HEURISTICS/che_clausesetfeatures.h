@@ -194,6 +194,45 @@ typedef struct spec_feature_cell
 }SpecFeatureCell, *SpecFeature_p;
 
 
+/* Counters collected by ClauseSetFeatureCountsCompute() in a single
+   traversal of a clause set. All counters up to CSFDepthMax are
+   combined by addition, the remaining ones by taking the maximum. */
+typedef enum
+{
+   CSFGoals,
+   CSFUnit,
+   CSFUnitGoals,
+   CSFHorn,
+   CSFHornGoals,
+   CSFEquational,
+   CSFPureEquational,
+   CSFGroundUnitAxioms,
+   CSFGroundGoals,
+   CSFPositiveAxioms,
+   CSFGroundPositiveAxioms,
+   CSFTermCells,
+   CSFDepthSum,
+   CSFDepthCount,
+   CSFNonFOClauses,
+   CSFBoolVarClauses,
+   CSFChoiceClauses,
+   CSFAppVarClauses,
+   CSFDepthMax,
+   CSFSlotNo
+}CSFSlot;
+
+typedef struct clauseset_feature_counts_cell
+{
+   long    slots[CSFSlotNo];
+   FunCode f_count;
+   long    *symbols; /* Occurrences of symbols 1..f_count */
+}ClauseSetFeatureCountsCell, *ClauseSetFeatureCounts_p;
+
+/* Parallel feature extraction only pays off for large sets - do not
+   give less than this many clauses to a single worker */
+#define FEATURE_MIN_CHUNK 20000
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -436,8 +475,21 @@ void    ClauseSetComputeHOFeatures(ClauseSet_p set, Sig_p sig,
                                    bool* quantifies_bools,
                                    bool* has_defined_choice,
                                    double* perc_appvar_lit);
+
+void    ClauseSetFeatureCountsInit(ClauseSetFeatureCounts_p counts,
+                                   Sig_p sig);
+void    ClauseSetFeatureCountsFree(ClauseSetFeatureCounts_p counts);
+void    ClauseFeatureCountsAdd(ClauseSetFeatureCounts_p counts,
+                               Clause_p clause);
+void    ClauseSetFeatureCountsCompute(ClauseSetFeatureCounts_p counts,
+                                      ClauseSet_p set, int workers);
+
 void    SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p cset,
                             FormulaSet_p fset, FormulaSet_p arch, TB_p bank);
+void    SpecFeaturesComputeParallel(SpecFeature_p features,
+                                    ClauseSet_p cset, FormulaSet_p fset,
+                                    FormulaSet_p arch, TB_p bank,
+                                    int workers);
 void    SpecFeaturesAddEval(SpecFeature_p features, SpecLimits_p limits);
 
 void    SpecFeaturesPrint(FILE* out, SpecFeature_p features);
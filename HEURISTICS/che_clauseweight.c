@@ -113,14 +113,17 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
          vweight, double pos_multiplier, double app_var_mult)
 {
    WeightParam_p data = WeightParamCellAlloc();
+   WFCB_p        handle;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
    data->pos_multiplier         = pos_multiplier;
    data->app_var_mult           = app_var_mult;
 
-   return WFCBAlloc(ClauseWeightCompute, prio_fun,
-          ClauseWeightExit, data);
+   handle = WFCBAlloc(ClauseWeightCompute, prio_fun,
+                      ClauseWeightExit, data);
+   handle->wfcb_batch_eval = ClauseWeightBatchCompute;
+   return handle;
 }
 
 
@@ -185,6 +188,35 @@ double ClauseWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseWeightBatchCompute()
+//
+//   Batch version of ClauseWeightCompute().
+//
+// Global Variables: -
+//
+// Side Effects    : Sets evaluations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseWeightBatchCompute(void* data, ClauseBatch_p batch, int pos)
+{
+   WeightParam_p local = data;
+   long          i;
+
+   for(i=0; i<batch->clause_no; i++)
+   {
+      batch->clauses[i]->evaluations->evals[pos].heuristic =
+         ClauseBatchWeight(batch, i, 1, 1,
+                           local->pos_multiplier,
+                           local->vweight,
+                           local->fweight,
+                           false);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseWeightExit()
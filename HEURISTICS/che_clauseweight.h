@@ -60,6 +60,7 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
 WFCB_p ClauseWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
 
 double ClauseWeightCompute(void* data, Clause_p clause);
+void   ClauseWeightBatchCompute(void* data, ClauseBatch_p batch, int pos);
 
 void   ClauseWeightExit(void* data);
 
@@ -40,6 +40,27 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: fun_weight_wfcb_alloc()
+//
+//   Return a WFCB for GenericFunWeightCompute() with the given data.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static WFCB_p fun_weight_wfcb_alloc(ClausePrioFun prio_fun,
+                                    FunWeightParam_p data)
+{
+   WFCB_p handle = WFCBAlloc(GenericFunWeightCompute, prio_fun,
+                             GenericFunWeightExit, data);
+
+   handle->wfcb_batch_eval = GenericFunWeightBatchCompute;
+   return handle;
+}
 
 
 /*-----------------------------------------------------------------------
@@ -70,9 +91,9 @@ static void init_conj_vector(FunWeightParam_p data)
       {
          data->fweights[i] = 0;
       }
-      for(handle=data->axioms->anchor->succ;
+      for(handle=ClauseSucc(data->axioms->anchor);
           handle!=data->axioms->anchor;
-          handle = handle->succ)
+          handle = ClauseSucc(handle))
       {
          if(ClauseQueryTPTPType(handle)==CPTypeNegConjecture)
          {
@@ -132,9 +153,9 @@ static void init_conj_t_vector(FunWeightParam_p data)
          data->type_freqs[i] = 0;
       }
 
-      for(handle=data->axioms->anchor->succ;
+      for(handle=ClauseSucc(data->axioms->anchor);
           handle!=data->axioms->anchor;
-          handle = handle->succ)
+          handle = ClauseSucc(handle))
       {
          if(ClauseQueryTPTPType(handle)==CPTypeNegConjecture)
          {
@@ -204,9 +225,9 @@ static void init_conj_typeweight_vector(FunWeightParam_p data)
          data->type_freqs[i] = 0;
       }
 
-      for(handle=data->axioms->anchor->succ;
+      for(handle=ClauseSucc(data->axioms->anchor);
           handle!=data->axioms->anchor;
-          handle = handle->succ)
+          handle = ClauseSucc(handle))
       {
          if(ClauseQueryTPTPType(handle)==CPTypeNegConjecture)
          {
@@ -587,8 +608,7 @@ WFCB_p ConjectureSymbolWeightInit(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead is many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   return fun_weight_wfcb_alloc(prio_fun, data);
 }
 
 
@@ -649,8 +669,7 @@ WFCB_p RelevanceLevelWeightInit(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead is many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   return fun_weight_wfcb_alloc(prio_fun, data);
 }
 
 /*-----------------------------------------------------------------------
@@ -706,8 +725,7 @@ WFCB_p RelevanceLevelWeightInit2(ClausePrioFun prio_fun,
    /* Weight vector is computed on first call of weight function to
       avoid overhead if many funweigh-based functions are predefined
       */
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   return fun_weight_wfcb_alloc(prio_fun, data);
 }
 
 
@@ -1245,8 +1263,7 @@ WFCB_p FunWeightInit(ClausePrioFun prio_fun,
 
    data->app_var_mult        = app_var_mult;
 
-   return WFCBAlloc(GenericFunWeightCompute, prio_fun,
-                    GenericFunWeightExit, data);
+   return fun_weight_wfcb_alloc(prio_fun, data);
 
 }
 
@@ -1464,6 +1481,42 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GenericFunWeightBatchCompute()
+//
+//   Batch version of GenericFunWeightCompute().
+//
+// Global Variables: -
+//
+// Side Effects    : Sets evaluations
+//
+/----------------------------------------------------------------------*/
+
+void GenericFunWeightBatchCompute(void* data, ClauseBatch_p batch, int pos)
+{
+   FunWeightParam_p local = data;
+   Clause_p         clause;
+   long             i;
+
+   local->init_fun(data);
+   for(i=0; i<batch->clause_no; i++)
+   {
+      clause = batch->clauses[i];
+      ClauseCondMarkMaximalTerms(local->ocb, clause);
+      clause->evaluations->evals[pos].heuristic =
+         ClauseBatchFunWeight(batch, i,
+                              local->max_term_multiplier,
+                              local->max_literal_multiplier,
+                              local->pos_multiplier,
+                              local->vweight,
+                              local->flimit,
+                              local->fweights,
+                              local->fweight);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SymOffsetWeightCompute()
@@ -162,6 +162,7 @@ WFCB_p SymOffsetWeightParse(Scanner_p in, OCB_p ocb,
                             ProofState_p state);
 
 double GenericFunWeightCompute(void* data, Clause_p clause);
+void   GenericFunWeightBatchCompute(void* data, ClauseBatch_p batch, int pos);
 
 double SymOffsetWeightCompute(void* data, Clause_p clause);
 
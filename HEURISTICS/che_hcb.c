@@ -28,6 +28,14 @@
 
 PERF_CTR_DEFINE(ClauseEvalTimer);
 
+/* Evaluate sets of clauses with the batch functions of the WFCBs
+   (where available)? */
+bool      HCBBatchEvaluation  = true;
+
+/* Clauses evaluated by HCBClauseSetEvaluate() and time spent there */
+long      HCBSetEvalClauses   = 0;
+long long HCBSetEvalTicks     = 0;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -186,6 +194,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->pred_elim_tolerance           = 0;
    handle->pred_elim_force_mu_decrease   = false;
    handle->pred_elim_ignore_conj_syms    = false;
+   handle->elim_workers                  = 1;
 
    handle->selection_strategy            = SelectNoLiterals;
    handle->pos_lit_sel_min               = 0;
@@ -211,10 +220,13 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->forward_context_sr            = false;
    handle->forward_context_sr_aggressive = false;
    handle->backward_context_sr           = false;
+   handle->ground_cc                     = false;
 
    handle->forward_subsumption_aggressive = false;
 
    handle->forward_demod                 = FullRewrite;
+   handle->nf_cache                      = false;
+   handle->nf_cache_size                 = 0;
    handle->prefer_general                = false;
    handle->lambda_demod                  = false;
 
@@ -280,6 +292,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->fixpoint_oracle = true;
    handle->max_unifiers = 4;
    handle->max_unif_steps = 256;
+   handle->csu_cache_mem = 0;
 }
 
 
@@ -374,6 +387,7 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
 //    fprintf(out, "   pred_elim_tolerance:           %d\n", handle->pred_elim_tolerance);
 //    fprintf(out, "   pred_elim_force_mu_decrease    %s\n", BOOL2STR(handle->pred_elim_force_mu_decrease));
 //    fprintf(out, "   pred_elim_ignore_conj_syms     %s\n", BOOL2STR(handle->pred_elim_ignore_conj_syms));
+   fprintf(out, "   elim_workers:                   %d\n", handle->elim_workers);
 
    fprintf(out, "   heuristic_name:                %s\n", handle->heuristic_name);
    fprintf(out, "   heuristic_def:                 \"%s\"\n",
@@ -419,11 +433,16 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
            BOOL2STR(handle->forward_context_sr_aggressive));
    fprintf(out, "   backward_context_sr:            %s\n",
            BOOL2STR(handle->backward_context_sr));
+   fprintf(out, "   ground_cc:                      %s\n",
+           BOOL2STR(handle->ground_cc));
 
    fprintf(out, "   forward_subsumption_aggressive: %s\n",
            BOOL2STR(handle->forward_subsumption_aggressive));
 
    fprintf(out, "   forward_demod:                  %d\n", handle->forward_demod);
+   fprintf(out, "   nf_cache:                       %s\n",
+           BOOL2STR(handle->nf_cache));
+   fprintf(out, "   nf_cache_size:                  %ld\n", handle->nf_cache_size);
    fprintf(out, "   prefer_general:                 %s\n",
            BOOL2STR(handle->prefer_general));
 //    fprintf(out, "   lambda_demod:                 %s\n",
@@ -539,6 +558,8 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
            handle->max_unifiers);
    fprintf(out, "   max_unif_steps:                %d\n",
            handle->max_unif_steps);
+   fprintf(out, "   csu_cache_mem:                 %ld\n",
+           handle->csu_cache_mem);
 
    fprintf(out, "}\n");
 }
@@ -601,6 +622,7 @@ bool HeuristicParmsParseInto(Scanner_p in,
 //    PARSE_INT(pred_elim_tolerance);
 //    PARSE_BOOL(pred_elim_force_mu_decrease);
 //    PARSE_BOOL(pred_elim_ignore_conj_syms);
+   PARSE_INT(elim_workers);
 
    PARSE_IDENTIFIER(heuristic_name);
    PARSE_STRING(heuristic_def);
@@ -674,8 +696,11 @@ bool HeuristicParmsParseInto(Scanner_p in,
    PARSE_BOOL(forward_context_sr);
    PARSE_BOOL(forward_context_sr_aggressive);
    PARSE_BOOL(backward_context_sr);
+   PARSE_BOOL(ground_cc);
    PARSE_BOOL(forward_subsumption_aggressive);
    PARSE_INT_LIMITED(forward_demod,0,2);
+   PARSE_BOOL(nf_cache);
+   PARSE_INT(nf_cache_size);
    PARSE_BOOL(prefer_general);
    //PARSE_BOOL(lambda_demod);
    PARSE_BOOL(condensing);
@@ -740,6 +765,7 @@ bool HeuristicParmsParseInto(Scanner_p in,
    PARSE_BOOL(fixpoint_oracle);
    PARSE_INT(max_unifiers);
    PARSE_INT(max_unif_steps);
+   PARSE_INT(csu_cache_mem);
 
 
    AcceptInpTok(in, CloseCurly);
@@ -792,6 +818,7 @@ HCB_p HCBAlloc(void)
    handle->hcb_select    = HCBStandardClauseSelect;
    handle->hcb_exit      = default_exit_fun;
    handle->data          = NULL;
+   handle->batch         = NULL;
 
    return handle;
 }
@@ -820,6 +847,10 @@ void HCBFree(HCB_p junk)
    {
       junk->hcb_exit(junk->data);
    }
+   if(junk->batch)
+   {
+      ClauseBatchFree(junk->batch);
+   }
    HCBCellFree(junk);
 }
 
@@ -888,6 +919,92 @@ void HCBClauseEvaluate(HCB_p hcb, Clause_p clause)
    PERF_CTR_EXIT(ClauseEvalTimer);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: HCBClauseSetEvaluate()
+//
+//   Add evaluations to all clauses in set. WFCBs with a batch
+//   evaluation function evaluate all clauses at once from shared
+//   symbol counts, the others clause by clause. WFCBs are still
+//   applied in order, so that each clause sees the same sequence of
+//   evaluations (and side effects like maximality marking) as with
+//   HCBClauseEvaluate().
+//
+// Global Variables: problemType, HCBBatchEvaluation,
+//                   HCBSetEvalClauses, HCBSetEvalTicks
+//
+// Side Effects    : Memory, adds evaluations, by eval functions
+//
+/----------------------------------------------------------------------*/
+
+void HCBClauseSetEvaluate(HCB_p hcb, ClauseSet_p set)
+{
+   Clause_p  handle;
+   WFCB_p    wfcb;
+   long      i, batch_no = 0;
+   long long start = PerfCtrTicks();
+
+   if(HCBBatchEvaluation && problemType != PROBLEM_HO)
+   {
+      for(i=0; i< hcb->wfcb_no; i++)
+      {
+         wfcb = PDArrayElementP(hcb->wfcb_list, i);
+         batch_no += (wfcb->wfcb_batch_eval != NULL);
+      }
+   }
+   if(!batch_no || set->members < 2)
+   {
+      for(handle = ClauseSucc(set->anchor);
+          handle != set->anchor;
+          handle = ClauseSucc(handle))
+      {
+         HCBClauseEvaluate(hcb, handle);
+      }
+   }
+   else
+   {
+      PERF_CTR_ENTRY(ClauseEvalTimer);
+      if(!hcb->batch)
+      {
+         hcb->batch = ClauseBatchAlloc();
+      }
+      ClauseBatchBuild(hcb->batch, set);
+      for(handle = ClauseSucc(set->anchor);
+          handle != set->anchor;
+          handle = ClauseSucc(handle))
+      {
+         assert(handle->evaluations == NULL);
+         ClauseAddEvalCell(handle, EvalsAlloc(hcb->wfcb_no));
+      }
+      for(i=0; i< hcb->wfcb_no; i++)
+      {
+         wfcb = PDArrayElementP(hcb->wfcb_list, i);
+         if(wfcb->wfcb_batch_eval)
+         {
+            wfcb->wfcb_batch_eval(wfcb->data, hcb->batch, i);
+         }
+         for(handle = ClauseSucc(set->anchor);
+             handle != set->anchor;
+             handle = ClauseSucc(handle))
+         {
+            if(wfcb->wfcb_batch_eval)
+            {
+               handle->evaluations->evals[i].priority =
+                  ClauseIsSemFalse(handle)?PrioBest:wfcb->wfcb_priority(handle);
+            }
+            else
+            {
+               ClauseAddEvaluation(wfcb, handle, i, ClauseIsSemFalse(handle));
+            }
+         }
+      }
+      PERF_CTR_EXIT(ClauseEvalTimer);
+   }
+   HCBSetEvalClauses += set->members;
+   HCBSetEvalTicks   += PerfCtrTicks()-start;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: HCBStandardClauseSelect()
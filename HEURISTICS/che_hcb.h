@@ -129,6 +129,8 @@ typedef struct heuristic_parms_cell
    bool                pred_elim_force_mu_decrease;
    bool                pred_elim_ignore_conj_syms;
 
+   int                 elim_workers; /* Processes for BCE and PE */
+
 /* Clause selection elements */
    char                *heuristic_name;
    char                *heuristic_def;
@@ -161,10 +163,13 @@ typedef struct heuristic_parms_cell
    bool                forward_context_sr;
    bool                forward_context_sr_aggressive;
    bool                backward_context_sr;
+   bool                ground_cc;
 
    bool                forward_subsumption_aggressive;
 
    RewriteLevel        forward_demod;
+   bool                nf_cache;
+   long                nf_cache_size;
    bool                prefer_general;
    bool                lambda_demod;
 
@@ -236,6 +241,7 @@ typedef struct heuristic_parms_cell
    bool                fixpoint_oracle;
    int                 max_unifiers;
    int                 max_unif_steps;
+   long                csu_cache_mem; /* MB for cached unifiers, 0 = off */
 }HeuristicParmsCell, *HeuristicParms_p;
 
 
@@ -277,6 +283,10 @@ typedef struct hcb_cell
       only called if data != NULL. */
    GenericExitFun  hcb_exit;
    void*           data;
+
+   /* Symbol counts for HCBClauseSetEvaluate(), allocated on first
+      use */
+   ClauseBatch_p   batch;
 }HCBCell, *HCB_p;
 
 #define HCB_DEFAULT_HEURISTIC "Default"
@@ -300,6 +310,10 @@ typedef Clause_p (*ClauseSelectFun)(HCB_p hcb, ClauseSet_p set);
 
 PERF_CTR_DECL(ClauseEvalTimer);
 
+extern bool      HCBBatchEvaluation;
+extern long      HCBSetEvalClauses;
+extern long long HCBSetEvalTicks;
+
 #define HeuristicParmsCellAlloc()                               \
    (HeuristicParmsCell*)SizeMalloc(sizeof(HeuristicParmsCell))
 #define HeuristicParmsCellFree(junk)            \
@@ -322,6 +336,7 @@ HCB_p    HCBAlloc(void);
 void     HCBFree(HCB_p junk);
 long     HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps);
 void     HCBClauseEvaluate(HCB_p hcb, Clause_p clause);
+void     HCBClauseSetEvaluate(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBStandardClauseSelect(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBSingleWeightClauseSelect(HCB_p hcb, ClauseSet_p set);
 
@@ -180,7 +180,7 @@ static void lev_init(LevWeightParam_p data)
    
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause) != CPTypeNegConjecture) 
       {
@@ -790,6 +790,34 @@ char* GetLitSelName(LiteralSelectionFun fun)
    return res;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: LitSelGetNameByIndex()
+//
+//   Return the name of the literal selection function with index i
+//   in the internal table, or NULL if i is out of range. Allows
+//   iterating over all selection functions.
+//
+// Global Variables: name_fun_assoc
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+char* LitSelGetNameByIndex(int i)
+{
+   int j;
+
+   for(j=0; name_fun_assoc[j].name; j++)
+   {
+      if(j==i)
+      {
+         return name_fun_assoc[j].name;
+      }
+   }
+   return NULL;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: LitSelAppendNames()
@@ -63,6 +63,7 @@ typedef void LitWeightFun(LitEval_p, Clause_p, void*);
 
 LiteralSelectionFun GetLitSelFun(char* name);
 char*               GetLitSelName(LiteralSelectionFun fun);
+char*               LitSelGetNameByIndex(int i);
 void LitSelAppendNames(DStr_p str);
 
 void SelectNoLiterals(OCB_p ocb, Clause_p clause);
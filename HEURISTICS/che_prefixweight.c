@@ -158,7 +158,7 @@ static void prfx_init(PrefixWeightParam_p data)
 
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause) != CPTypeNegConjecture) 
       {
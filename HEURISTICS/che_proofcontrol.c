@@ -149,18 +149,13 @@ static bool select_inherited_literal(Clause_p clause)
 //
 // Global Variables: -
 //
-// Side Effects    : Via PicoSAT interface
+// Side Effects    : Via SAT solver interface
 //
 /----------------------------------------------------------------------*/
 
 void sat_solver_init(ProofControl_p ctrl)
 {
-   ctrl->solver = picosat_init();
-#ifndef NDEBUG
-   int status =
-#endif
-   picosat_enable_trace_generation(ctrl->solver);
-   assert(status);
+   ctrl->solver = SatSolverAlloc(SatSolverDefault);
 }
 
 
@@ -221,7 +216,7 @@ void ProofControlFree(ProofControl_p junk)
 
    if(junk->solver)
    {
-      picosat_reset(junk->solver);
+      SatSolverFree(junk->solver);
    }
    ProofControlCellFree(junk);
 }
@@ -241,7 +236,7 @@ void ProofControlFree(ProofControl_p junk)
 
 void ProofControlResetSATSolver(ProofControl_p ctrl)
 {
-   picosat_reset(ctrl->solver);
+   SatSolverFree(ctrl->solver);
    sat_solver_init(ctrl);
 }
 
@@ -38,6 +38,41 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: refined_weight_batch()
+//
+//   Evaluate all clauses of batch with the refined weight described
+//   by local, store the evaluations at position pos.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets evaluations, marks maximal terms
+//
+/----------------------------------------------------------------------*/
+
+static void refined_weight_batch(RefinedWeightParam_p local,
+                                 ClauseBatch_p batch, int pos,
+                                 bool count_eq_encoding)
+{
+   Clause_p clause;
+   long     i;
+
+   for(i=0; i<batch->clause_no; i++)
+   {
+      clause = batch->clauses[i];
+      ClauseCondMarkMaximalTerms(local->ocb, clause);
+      clause->evaluations->evals[pos].heuristic =
+         ClauseBatchWeight(batch, i,
+                           local->max_term_multiplier,
+                           local->max_literal_multiplier,
+                           local->pos_multiplier,
+                           local->vweight,
+                           local->fweight,
+                           count_eq_encoding);
+   }
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -63,6 +98,7 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
                 pos_multiplier, double app_var_mult)
 {
    RefinedWeightParam_p data = RefinedWeightParamCellAlloc();
+   WFCB_p               handle;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -72,8 +108,10 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
    data->ocb                    = ocb;
    data->app_var_mult           = app_var_mult;
 
-   return WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
-          ClauseRefinedWeightExit, data);
+   handle = WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
+                      ClauseRefinedWeightExit, data);
+   handle->wfcb_batch_eval = ClauseRefinedWeightBatchCompute;
+   return handle;
 }
 
 
@@ -151,6 +189,25 @@ double ClauseRefinedWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeightBatchCompute()
+//
+//   Batch version of ClauseRefinedWeightCompute().
+//
+// Global Variables: -
+//
+// Side Effects    : Sets evaluations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseRefinedWeightBatchCompute(void* data, ClauseBatch_p batch,
+                                     int pos)
+{
+   refined_weight_batch(data, batch, pos, false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeight2Parse()
@@ -170,6 +227,7 @@ WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
 
    tmp = ClauseRefinedWeightParse(in, ocb, state);
    tmp->wfcb_eval = ClauseRefinedWeight2Compute;
+   tmp->wfcb_batch_eval = ClauseRefinedWeight2BatchCompute;
 
    return tmp;
 }
@@ -202,6 +260,25 @@ double ClauseRefinedWeight2Compute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeight2BatchCompute()
+//
+//   Batch version of ClauseRefinedWeight2Compute().
+//
+// Global Variables: -
+//
+// Side Effects    : Sets evaluations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseRefinedWeight2BatchCompute(void* data, ClauseBatch_p batch,
+                                      int pos)
+{
+   refined_weight_batch(data, batch, pos, true);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeightExit()
@@ -66,11 +66,15 @@ WFCB_p ClauseRefinedWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeightCompute(void* data, Clause_p clause);
+void   ClauseRefinedWeightBatchCompute(void* data, ClauseBatch_p batch,
+                                       int pos);
 
 WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeight2Compute(void* data, Clause_p clause);
+void   ClauseRefinedWeight2BatchCompute(void* data, ClauseBatch_p batch,
+                                        int pos);
 
 void   ClauseRefinedWeightExit(void* data);
 
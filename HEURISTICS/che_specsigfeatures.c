@@ -237,8 +237,8 @@ void ClauseSetCollectSigFeatures(Sig_p sig, ClauseSet_p set,
    Clause_p handle;
    FunCode i;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       if(ClauseIsConjecture(handle))
       {
@@ -162,7 +162,7 @@ static void strc_init(StrucWeightParam_p data)
    
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause) != CPTypeNegConjecture) 
       {
@@ -147,7 +147,7 @@ static void termweight_init(TermWeightParam_p data)
    data->eval_bank = TBAlloc(data->ocb->sig);
 
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause)!=CPTypeNegConjecture) {
          continue;
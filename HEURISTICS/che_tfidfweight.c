@@ -152,7 +152,7 @@ static void tfidf_init(TfIdfWeightParam_p data)
    data->eval_bank = TBAlloc(data->ocb->sig);
    data->documents = PDTreeAlloc(data->eval_bank);
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause)==CPTypeNegConjecture) {
          TBInsertClauseTermsNormalized(
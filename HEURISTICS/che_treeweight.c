@@ -159,7 +159,7 @@ static void ted_init(TreeWeightParam_p data)
    
    // for each axiom ...
    anchor = data->proofstate->axioms->anchor;
-   for (clause=anchor->succ; clause!=anchor; clause=clause->succ)
+   for (clause=ClauseSucc(anchor); clause!=anchor; clause=ClauseSucc(clause))
    {
       if(ClauseQueryTPTPType(clause)!=CPTypeNegConjecture) {
          continue;
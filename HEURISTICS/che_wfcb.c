@@ -63,6 +63,7 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
    handle->wfcb_priority = prio_fun;
    handle->wfcb_exit = wfcb_exit;
    handle->data = data;
+   handle->wfcb_batch_eval = NULL;
 
    return handle;
 }
@@ -37,6 +37,12 @@
   This function is responsible for freeing data, before the WFCB is
   deleted.
 
+  void <eval>BatchCompute(void* data, ClauseBatch_p batch, int pos)
+
+  Optional. Store the evaluations of all clauses in batch at
+  position pos of their evaluation cells. The result has to be
+  identical to that of <eval>Compute().
+
   Copyright 1998-2018 by the authors (see DOC/CONTRIBUTORS).
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -57,6 +63,7 @@
 #include <cio_output.h>
 #include <ccl_proofstate.h>
 #include <che_prio_funs.h>
+#include <che_clausebatch.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -67,6 +74,8 @@
 
 typedef double (*ClauseEvalFun)(void* data, Clause_p
                                 clause);
+typedef void (*ClauseBatchEvalFun)(void* data, ClauseBatch_p batch,
+                                   int pos);
 
 typedef struct wfcb_cell
 {
@@ -77,6 +86,8 @@ typedef struct wfcb_cell
    void*             data;          /* WFCB-Data...each set of
                                        evaluation functions is
                                        responsible for cleaning up...*/
+   ClauseBatchEvalFun wfcb_batch_eval; /* Evaluate a ClauseBatch, may
+                                          be NULL */
 }WFCBCell, *WFCB_p;
 
 typedef WFCB_p (*WeightFunParseFun)(Scanner_p in, OCB_p ocb,
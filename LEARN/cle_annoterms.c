@@ -17,6 +17,8 @@
   Changes
 
   Created: Tue Jul 20 17:49:05 MET DST 1999
+  Mon Oct 19 04:12:37 CEST 2026: Read and write encodings in plain
+  prefix notation.
 
   -----------------------------------------------------------------------*/
 
@@ -100,10 +102,113 @@ void annotation_normalize(Annotation_p anno, DDArray_p max_values)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: annoterm_print_encoding()
+//
+//   Print term in plain prefix notation, including the logical
+//   symbols of the clause encoding ($or, $eq, $neq, $true), so that
+//   AnnoTermEncodingParse() reads back the same term.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void annoterm_print_encoding(FILE* out, Sig_p sig, Term_p term)
+{
+   int i;
+
+   if(TermIsFreeVar(term))
+   {
+      VarPrint(out, term->f_code);
+      return;
+   }
+   fputs(SigFindName(sig, term->f_code), out);
+   if(term->arity)
+   {
+      fputc('(', out);
+      for(i=0; i<term->arity; i++)
+      {
+         if(i)
+         {
+            fputc(',', out);
+         }
+         annoterm_print_encoding(out, sig, term->args[i]);
+      }
+      fputc(')', out);
+   }
+}
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: AnnoTermEncodingParse()
+//
+//   Parse a clause encoding term in plain prefix notation (as printed
+//   by AnnoTermPrint()). Unlike TBTermParse(), arguments of logical
+//   symbols are not parsed as formulas and argument symbols are not
+//   retyped. The term is built bottom-up with TBTermTopInsert(), as
+//   RecEncodeClauseListRep() and FlatEncodeClauseListRep() build
+//   it.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations, changes term bank and
+//                   signature.
+//
+/----------------------------------------------------------------------*/
+
+Term_p AnnoTermEncodingParse(Scanner_p in, TB_p bank)
+{
+   DStr_p       id = DStrAlloc();
+   FuncSymbType id_type;
+   PStack_p     args;
+   Term_p       handle;
+   int          i;
+
+   if((id_type=TermParseOperator(in, id))==FSIdentVar)
+   {
+      handle = VarBankExtNameAssertAlloc(bank->vars, DStrView(id));
+   }
+   else
+   {
+      args = PStackAlloc();
+      if(TestInpTok(in, OpenBracket))
+      {
+         AcceptInpTok(in, OpenBracket);
+         PStackPushP(args, AnnoTermEncodingParse(in, bank));
+         while(TestInpTok(in, Comma))
+         {
+            NextToken(in);
+            PStackPushP(args, AnnoTermEncodingParse(in, bank));
+         }
+         AcceptInpTok(in, CloseBracket);
+      }
+      handle = TermDefaultCellArityAlloc(PStackGetSP(args));
+      for(i=0; i<handle->arity; i++)
+      {
+         handle->args[i] = PStackElementP(args, i);
+      }
+      PStackFree(args);
+      handle->f_code = TermSigInsert(bank->sig, DStrView(id),
+                                     handle->arity, false, id_type);
+      if(!handle->f_code)
+      {
+         AktTokenError(in, "Symbol used with different arity in"
+                       " preceding term", false);
+      }
+      handle = TBTermTopInsert(bank, handle);
+   }
+   DStrFree(id);
+
+   return handle;
+}
+
 
 /*-----------------------------------------------------------------------
 //
@@ -167,8 +272,7 @@ AnnoTerm_p AnnoTermParse(Scanner_p in, TB_p bank, long expected)
    Annotation_p annos = NULL;
    AnnoTerm_p   handle;
 
-   //term = TBRawTermParse(in, bank);
-   term = TBTermParse(in, bank);
+   term = AnnoTermEncodingParse(in, bank);
    AcceptInpTok(in, Colon);
    AnnotationListParse(in, &annos, expected);
    AcceptInpTok(in, Fullstop);
@@ -192,7 +296,14 @@ AnnoTerm_p AnnoTermParse(Scanner_p in, TB_p bank, long expected)
 
 void AnnoTermPrint(FILE* out, TB_p bank, AnnoTerm_p term, bool fullterms)
 {
-   TBPrintTerm(out, bank, term->term, fullterms);
+   if(fullterms)
+   {
+      annoterm_print_encoding(out, bank->sig, term->term);
+   }
+   else
+   {
+      TBPrintTermCompact(out, bank, term->term);
+   }
    fputs(" : ", out);
    AnnotationListPrint(out, term->annotation);
    fputc('.', out);
@@ -17,6 +17,7 @@
   Changes
 
   Create: Tue Jul 20 17:22:38 MET DST 1999
+  Mon Oct 19 04:12:37 CEST 2026: AnnoTermEncodingParse()
 
   -----------------------------------------------------------------------*/
 
@@ -57,6 +58,7 @@ AnnoTerm_p AnnoTermAlloc(Term_p term, Annotation_p annos);
 AnnoTerm_p AnnoTermAllocNoRef(Term_p term, Annotation_p annos);
 void       AnnoTermFree(TB_p bank, AnnoTerm_p junk);
 #define    AnnoTermFreeNoRef(junk) AnnoTermCellFree(junk)
+Term_p     AnnoTermEncodingParse(Scanner_p in, TB_p bank);
 AnnoTerm_p AnnoTermParse(Scanner_p in, TB_p bank, long expected);
 void       AnnoTermPrint(FILE* out, TB_p bank, AnnoTerm_p term, bool
                          fullterms);
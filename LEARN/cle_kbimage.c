@@ -0,0 +1,964 @@
+/*-----------------------------------------------------------------------
+
+File  : cle_kbimage.c
+
+Author: The E developers
+
+Contents
+
+  Writing and (memory-mapped) loading of binary clause pattern
+  images.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 04:12:37 CEST 2026
+    New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    KBImageCheck(), images are checked after writing. Terms are
+    read like AnnoTermEncodingParse() reads them
+
+-----------------------------------------------------------------------*/
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "cle_kbimage.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* State while encoding terms for an image. */
+
+typedef struct image_builder_cell
+{
+   Sig_p     sig;
+   PDArray_p sym_map;  /* f_code -> symbol index+1 */
+   PStack_p  symbols;  /* Of f_codes, in order of first occurrence */
+   PDArray_p var_map;  /* -f_code -> variable number */
+   long      var_no;
+   PStack_p  codes;
+}ImageBuilderCell, *ImageBuilder_p;
+
+/* State while replaying an image into a term bank. */
+
+typedef struct image_loader_cell
+{
+   TB_p            bank;
+   KBImageSymbol_p symbols;
+   int64_t         symbol_no;
+   char            *names;
+   FunCode         *f_codes; /* Per symbol, 0 if not yet inserted */
+   int64_t         *end;     /* End of the codes of the current term */
+   DStr_p          var_name;
+}ImageLoaderCell, *ImageLoader_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_name()
+//
+//   Build the file name of the image of kb in name and return a
+//   pointer to it.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes name
+//
+/----------------------------------------------------------------------*/
+
+static char* image_name(DStr_p name, char* kb)
+{
+   return KBFileName(name, kb, KB_IMAGE_FILE);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_symbol_type()
+//
+//   Return the identifier type of f_code as the parser would have
+//   determined it.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static FuncSymbType image_symbol_type(Sig_p sig, FunCode f_code)
+{
+   if(SigQueryFuncProp(sig, f_code, FPIsInteger))
+   {
+      return FSIdentInt;
+   }
+   if(SigQueryFuncProp(sig, f_code, FPIsFloat))
+   {
+      return FSIdentFloat;
+   }
+   if(SigQueryFuncProp(sig, f_code, FPIsRational))
+   {
+      return FSIdentRational;
+   }
+   if(SigQueryFuncProp(sig, f_code, FPIsObject))
+   {
+      return FSIdentObject;
+   }
+   if(SigQueryFuncProp(sig, f_code, FPInterpreted))
+   {
+      return FSIdentInterpreted;
+   }
+   return FSIdentFreeFun;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_encode_term()
+//
+//   Append the prefix encoding of term to builder->codes.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes builder
+//
+/----------------------------------------------------------------------*/
+
+static void image_encode_term(ImageBuilder_p builder, Term_p term)
+{
+   long code;
+   int  i;
+
+   if(TermIsFreeVar(term))
+   {
+      code = PDArrayElementInt(builder->var_map, -term->f_code);
+      if(!code)
+      {
+         code = ++builder->var_no;
+         PDArrayAssignInt(builder->var_map, -term->f_code, code);
+      }
+      PStackPushInt(builder->codes, -code);
+      return;
+   }
+   code = PDArrayElementInt(builder->sym_map, term->f_code);
+   if(!code)
+   {
+      PStackPushInt(builder->symbols, term->f_code);
+      code = PStackGetSP(builder->symbols);
+      PDArrayAssignInt(builder->sym_map, term->f_code, code);
+   }
+   PStackPushInt(builder->codes, code-1);
+   for(i=0; i<term->arity; i++)
+   {
+      image_encode_term(builder, term->args[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_write()
+//
+//   Write size bytes from data to out, fail on errors.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void image_write(FILE* out, void* data, size_t size)
+{
+   if(size && fwrite(data, 1, size, out) != size)
+   {
+      TmpErrno = errno;
+      SysError("Cannot write knowledge base image", FILE_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_write_int()
+//
+//   Write a single 64 bit integer.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void image_write_int(FILE* out, int64_t value)
+{
+   image_write(out, &value, sizeof(int64_t));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_corrupt()
+//
+//   Fail with an error message about a corrupt image.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates program
+//
+/----------------------------------------------------------------------*/
+
+static void image_corrupt(char* name)
+{
+   DStr_p error = DStrAlloc();
+
+   DStrAppendStr(error, "Knowledge base image '");
+   DStrAppendStr(error, name);
+   DStrAppendStr(error, "' is corrupt (delete it to use the text file)");
+   Error(DStrView(error), INPUT_SEMANTIC_ERROR);
+   DStrFree(error);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_term_build()
+//
+//   Build the term encoded at *pos in loader->bank, advance *pos
+//   behind it. Symbols are inserted into the signature when their
+//   first occurrence is complete, and variables are created in order
+//   of occurrence, just like AnnoTermEncodingParse() does. Return
+//   NULL if the codes are inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank and signature
+//
+/----------------------------------------------------------------------*/
+
+static Term_p image_term_build(ImageLoader_p loader, int64_t **pos)
+{
+   int64_t         code;
+   KBImageSymbol_p symbol;
+   Term_p          handle;
+   FunCode         f_code;
+   DStr_p          error;
+   int             i;
+
+   if(*pos >= loader->end)
+   {
+      return NULL;
+   }
+   code = **pos;
+   (*pos)++;
+   if(code < 0)
+   {
+      DStrReset(loader->var_name);
+      DStrAppendChar(loader->var_name, 'X');
+      DStrAppendInt(loader->var_name, -code);
+      return VarBankExtNameAssertAlloc(loader->bank->vars,
+                                       DStrView(loader->var_name));
+   }
+   if(code >= loader->symbol_no)
+   {
+      return NULL;
+   }
+   symbol = &(loader->symbols[code]);
+   handle = TermDefaultCellArityAlloc(symbol->arity);
+   for(i=0; i<symbol->arity; i++)
+   {
+      handle->args[i] = image_term_build(loader, pos);
+      if(!handle->args[i])
+      {
+         TermTopFree(handle);
+         return NULL;
+      }
+   }
+   f_code = loader->f_codes[code];
+   if(!f_code)
+   {
+      f_code = TermSigInsert(loader->bank->sig,
+                             loader->names+symbol->name,
+                             symbol->arity, false,
+                             (FuncSymbType)symbol->type);
+      if(!f_code)
+      {
+         error = DStrAlloc();
+         DStrAppendStr(error, loader->names+symbol->name);
+         DStrAppendStr(error, " used with arity ");
+         DStrAppendInt(error, symbol->arity);
+         DStrAppendStr(error, " in knowledge base, but registered with"
+                       " a different arity");
+         Error(DStrView(error), SYNTAX_ERROR);
+         DStrFree(error);
+      }
+      loader->f_codes[code] = f_code;
+   }
+   handle->f_code = f_code;
+   return TBTermTopInsert(loader->bank, handle);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_replay()
+//
+//   Replay the (mapped and validated) image into a new AnnoSet over
+//   bank and return it.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank and signature, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AnnoSet_p image_replay(KBImageHeader_p header, char* name,
+                              TB_p bank)
+{
+   AnnoSet_p       set = AnnoSetAlloc(bank);
+   ImageLoaderCell loader;
+   KBImageRecord_p records;
+   int64_t         *codes, *keys, *pos, i, j, k;
+   double          *values;
+   Term_p          term;
+   Annotation_p    annos, handle;
+
+   loader.bank      = bank;
+   loader.symbols   = (KBImageSymbol_p)(header+1);
+   loader.symbol_no = header->symbol_no;
+   records = (KBImageRecord_p)(loader.symbols+header->symbol_no);
+   codes   = (int64_t*)(records+header->record_no+1);
+   keys    = codes+header->code_no;
+   values  = (double*)(keys+header->anno_no);
+   loader.names = (char*)(values+header->anno_no*header->annotation_no);
+   loader.var_name = DStrAlloc();
+   loader.f_codes  = SecureMalloc(MAX(header->symbol_no,1)*sizeof(FunCode));
+   for(i=0; i<header->symbol_no; i++)
+   {
+      if(loader.symbols[i].name < 0 ||
+         loader.symbols[i].name >= header->name_size ||
+         loader.symbols[i].arity < 0)
+      {
+         image_corrupt(name);
+      }
+      loader.f_codes[i] = 0;
+   }
+   if(header->name_size && loader.names[header->name_size-1])
+   {
+      image_corrupt(name);
+   }
+
+   for(i=0; i<header->record_no; i++)
+   {
+      if(records[i].code < 0 || records[i].code > records[i+1].code ||
+         records[i+1].code > header->code_no ||
+         records[i].anno < 0 || records[i].anno > records[i+1].anno ||
+         records[i+1].anno > header->anno_no)
+      {
+         image_corrupt(name);
+      }
+      pos = codes+records[i].code;
+      loader.end = codes+records[i+1].code;
+      term = image_term_build(&loader, &pos);
+      if(!term || pos != loader.end)
+      {
+         image_corrupt(name);
+      }
+      annos = NULL;
+      for(j=records[i].anno; j<records[i+1].anno; j++)
+      {
+         handle = AnnotationAlloc();
+         handle->key = keys[j];
+         for(k=0; k<header->annotation_no; k++)
+         {
+            DDArrayAssign(AnnotationValues(handle), k,
+                          values[j*header->annotation_no+k]);
+         }
+         AnnotationLength(handle) = header->annotation_no;
+         if(NumTreeInsert(&annos, handle))
+         {
+            image_corrupt(name);
+         }
+      }
+      AnnoSetAddTerm(set, AnnoTermAlloc(term, annos));
+   }
+   FREE(loader.f_codes);
+   DStrFree(loader.var_name);
+
+   return set;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_sig_equal()
+//
+//   Return true if sig1 and sig2 have the same symbols (names,
+//   arities and identifier types) with the same codes.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_sig_equal(Sig_p sig1, Sig_p sig2)
+{
+   FunCode i;
+
+   if(sig1->f_count != sig2->f_count)
+   {
+      return false;
+   }
+   for(i=1; i<=sig1->f_count; i++)
+   {
+      if(strcmp(SigFindName(sig1, i), SigFindName(sig2, i)) != 0 ||
+         SigFindArity(sig1, i) != SigFindArity(sig2, i) ||
+         image_symbol_type(sig1, i) != image_symbol_type(sig2, i))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_term_equal()
+//
+//   Return true if t1 and t2 (from different banks with equal
+//   signatures) are built from the same symbols and variables.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool image_term_equal(Term_p t1, Term_p t2)
+{
+   int i;
+
+   if(t1->f_code != t2->f_code || t1->arity != t2->arity)
+   {
+      return false;
+   }
+   for(i=0; i<t1->arity; i++)
+   {
+      if(!image_term_equal(t1->args[i], t2->args[i]))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_annos_equal()
+//
+//   Return true if the annotation trees a1 and a2 have the same keys
+//   with the same values.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool image_annos_equal(Annotation_p a1, Annotation_p a2)
+{
+   PStack_p     stack1 = NumTreeTraverseInit(a1),
+                stack2 = NumTreeTraverseInit(a2);
+   Annotation_p handle1, handle2;
+   bool         res = true;
+   long         i;
+
+   while(res)
+   {
+      handle1 = NumTreeTraverseNext(stack1);
+      handle2 = NumTreeTraverseNext(stack2);
+      if(!handle1 || !handle2)
+      {
+         res = (handle1 == handle2);
+         break;
+      }
+      res = handle1->key == handle2->key &&
+         AnnotationLength(handle1) == AnnotationLength(handle2);
+      for(i=0; res && i<AnnotationLength(handle1); i++)
+      {
+         res = DDArrayElement(AnnotationValues(handle1), i) ==
+            DDArrayElement(AnnotationValues(handle2), i);
+      }
+   }
+   NumTreeTraverseExit(stack2);
+   NumTreeTraverseExit(stack1);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_sets_equal()
+//
+//   Return true if set1 and set2 contain the same terms (with the
+//   same term bank entry numbers) with the same annotations.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool image_sets_equal(AnnoSet_p set1, AnnoSet_p set2)
+{
+   PStack_p   stack1 = NumTreeTraverseInit(set1->set),
+              stack2 = NumTreeTraverseInit(set2->set);
+   NumTree_p  handle1, handle2;
+   AnnoTerm_p term1, term2;
+   bool       res = true;
+
+   while(res)
+   {
+      handle1 = NumTreeTraverseNext(stack1);
+      handle2 = NumTreeTraverseNext(stack2);
+      if(!handle1 || !handle2)
+      {
+         res = (handle1 == handle2);
+         break;
+      }
+      term1 = handle1->val1.p_val;
+      term2 = handle2->val1.p_val;
+      res = handle1->key == handle2->key &&
+         image_term_equal(term1->term, term2->term) &&
+         image_annos_equal(term1->annotation, term2->annotation);
+   }
+   NumTreeTraverseExit(stack2);
+   NumTreeTraverseExit(stack1);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_check_bank_alloc()
+//
+//   Return a new term bank over a new signature initialized from the
+//   signature file of kb, as the knowledge base tools use it.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static TB_p image_check_bank_alloc(char* kb)
+{
+   DStr_p    name = DStrAlloc();
+   Sig_p     sig = SigAlloc(TypeBankAlloc());
+   Scanner_p in;
+
+   in = CreateScanner(StreamTypeFile, KBFileName(name, kb, "signature"),
+                      true, NULL, true);
+   SigParse(in, sig, true);
+   DestroyScanner(in);
+   DStrFree(name);
+
+   return TBAlloc(sig);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_check_bank_free()
+//
+//   Free bank (allocated with image_check_bank_alloc()) and set.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void image_check_bank_free(TB_p bank, AnnoSet_p set)
+{
+   Sig_p      sig = bank->sig;
+   TypeBank_p type_bank = sig->type_bank;
+
+   if(set)
+   {
+      AnnoSetFree(set);
+   }
+   bank->sig = NULL;
+   TBFree(bank);
+   SigFree(sig);
+   TypeBankFree(type_bank);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageWrite()
+//
+//   Parse the clause pattern file of kb and write its image. The
+//   image is written to a temporary file that is then renamed, so
+//   readers never see a partial image. The image is then checked
+//   with KBImageCheck() and removed again if it does not load to the
+//   same patterns as the text file. Return the number of annotated
+//   terms.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long KBImageWrite(char* kb, long expected)
+{
+   DStr_p            source = DStrAlloc(), target = DStrAlloc(),
+                     tmpname = DStrAlloc();
+   TypeBank_p        type_bank = TypeBankAlloc();
+   Sig_p             sig = SigAlloc(type_bank);
+   TB_p              bank = TBAlloc(sig);
+   ImageBuilderCell  builder;
+   KBImageHeaderCell header;
+   KBImageSymbolCell symbol;
+   PStack_p          records = PStackAlloc(), keys = PStackAlloc();
+   DDArray_p         values = DDArrayAlloc(4096, 65536);
+   Annotation_p      annos, handle;
+   Scanner_p         in;
+   FILE              *out;
+   struct stat       stat_buf;
+   FunCode           f_code;
+   Term_p            term;
+   long              i, count, anno_no = 0, name_size = 0;
+
+   KBFileName(source, kb, "clausepatterns");
+   if(stat(DStrView(source), &stat_buf) != 0)
+   {
+      TmpErrno = errno;
+      SysError("Cannot stat clause pattern file", FILE_ERROR);
+   }
+   builder.sig     = sig;
+   builder.sym_map = PDArrayAlloc(64, 64);
+   builder.symbols = PStackAlloc();
+   builder.var_map = PDArrayAlloc(64, 64);
+   builder.var_no  = 0;
+   builder.codes   = PStackAlloc();
+
+   /* Same as AnnoSetParse(), but keep the annotations in the order
+      in which they appear */
+   in = CreateScanner(StreamTypeFile, DStrView(source),
+                      true, NULL, true);
+   while(TestInpTok(in, TermStartToken))
+   {
+      term = AnnoTermEncodingParse(in, bank);
+      AcceptInpTok(in, Colon);
+      PStackPushInt(records, PStackGetSP(builder.codes));
+      PStackPushInt(records, anno_no);
+      image_encode_term(&builder, term);
+      annos = NULL;
+      while(TestInpTok(in, PosInt))
+      {
+         handle = AnnotationParse(in, expected);
+         PStackPushInt(keys, handle->key);
+         for(i=0; i<expected; i++)
+         {
+            DDArrayAssign(values, anno_no*expected+i,
+                          DDArrayElement(AnnotationValues(handle), i));
+         }
+         anno_no++;
+         if(NumTreeInsert(&annos, handle))
+         {
+            AktTokenError(in, "Only one annotation for each proof"
+                          " example allowed", false);
+         }
+         if(TestInpTok(in, Comma))
+         {
+            NextToken(in);
+         }
+      }
+      AcceptInpTok(in, Fullstop);
+      AnnotationTreeFree(annos);
+   }
+   DestroyScanner(in);
+   count = PStackGetSP(records)/2;
+   PStackPushInt(records, PStackGetSP(builder.codes));
+   PStackPushInt(records, anno_no);
+
+   for(i=0; i<PStackGetSP(builder.symbols); i++)
+   {
+      f_code = PStackElementInt(builder.symbols, i);
+      name_size += strlen(SigFindName(sig, f_code))+1;
+   }
+
+   header.magic         = KB_IMAGE_MAGIC;
+   header.version       = KB_IMAGE_VERSION;
+   header.annotation_no = expected;
+   header.source_size   = stat_buf.st_size;
+   header.source_mtime  = stat_buf.st_mtime;
+   header.symbol_no     = PStackGetSP(builder.symbols);
+   header.record_no     = count;
+   header.code_no       = PStackGetSP(builder.codes);
+   header.anno_no       = anno_no;
+   header.name_size     = name_size;
+
+   DStrAppendStr(tmpname, image_name(target, kb));
+   DStrAppendStr(tmpname, ".tmp");
+   out = OutOpen(DStrView(tmpname));
+   image_write(out, &header, sizeof(header));
+   name_size = 0;
+   for(i=0; i<PStackGetSP(builder.symbols); i++)
+   {
+      f_code = PStackElementInt(builder.symbols, i);
+      symbol.name  = name_size;
+      symbol.arity = SigFindArity(sig, f_code);
+      symbol.type  = image_symbol_type(sig, f_code);
+      image_write(out, &symbol, sizeof(symbol));
+      name_size += strlen(SigFindName(sig, f_code))+1;
+   }
+   for(i=0; i<PStackGetSP(records); i++)
+   {
+      image_write_int(out, PStackElementInt(records, i));
+   }
+   for(i=0; i<PStackGetSP(builder.codes); i++)
+   {
+      image_write_int(out, PStackElementInt(builder.codes, i));
+   }
+   for(i=0; i<anno_no; i++)
+   {
+      image_write_int(out, PStackElementInt(keys, i));
+   }
+   if(anno_no)
+   {
+      image_write(out, values->array, anno_no*expected*sizeof(double));
+   }
+   for(i=0; i<PStackGetSP(builder.symbols); i++)
+   {
+      f_code = PStackElementInt(builder.symbols, i);
+      image_write(out, SigFindName(sig, f_code),
+                  strlen(SigFindName(sig, f_code))+1);
+   }
+   OutClose(out);
+   if(rename(DStrView(tmpname), DStrView(target)) != 0)
+   {
+      TmpErrno = errno;
+      SysError("Cannot rename knowledge base image", FILE_ERROR);
+   }
+   if(!KBImageCheck(kb, expected))
+   {
+      unlink(DStrView(target));
+      Warning("Knowledge base image %s does not load to the same"
+              " patterns as the text file, removed", DStrView(target));
+   }
+   else
+   {
+      VERBOUTARG("Knowledge base image written and checked: ",
+                 DStrView(target));
+   }
+
+   PStackFree(builder.codes);
+   PDArrayFree(builder.var_map);
+   PStackFree(builder.symbols);
+   PDArrayFree(builder.sym_map);
+   DDArrayFree(values);
+   PStackFree(keys);
+   PStackFree(records);
+   bank->sig = NULL;
+   TBFree(bank);
+   SigFree(sig);
+   TypeBankFree(type_bank);
+   DStrFree(tmpname);
+   DStrFree(target);
+   DStrFree(source);
+
+   return count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageLoad()
+//
+//   Map the clause pattern image of kb into memory and replay it
+//   into a new AnnoSet over bank. Return NULL if there is no image,
+//   or if it does not match the text file or expected.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank and signature, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AnnoSet_p KBImageLoad(char* kb, TB_p bank, long expected)
+{
+   DStr_p          name = DStrAlloc();
+   AnnoSet_p       set = NULL;
+   KBImageHeader_p header;
+   struct stat     image_stat, source_stat;
+   void            *map;
+   int             fd;
+   int64_t         size;
+
+   if(stat(KBFileName(name, kb, "clausepatterns"), &source_stat) != 0)
+   {
+      DStrFree(name);
+      return NULL;
+   }
+   fd = open(image_name(name, kb), O_RDONLY);
+   if(fd == -1)
+   {
+      DStrFree(name);
+      return NULL;
+   }
+   if(fstat(fd, &image_stat) != 0 ||
+      image_stat.st_size < (off_t)sizeof(KBImageHeaderCell))
+   {
+      close(fd);
+      DStrFree(name);
+      return NULL;
+   }
+   map = mmap(NULL, image_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if(map == MAP_FAILED)
+   {
+      DStrFree(name);
+      return NULL;
+   }
+   header = map;
+   if(header->magic == KB_IMAGE_MAGIC &&
+      header->version == KB_IMAGE_VERSION &&
+      header->annotation_no == expected &&
+      header->source_size == source_stat.st_size &&
+      header->source_mtime == source_stat.st_mtime &&
+      header->symbol_no >= 0 && header->record_no >= 0 &&
+      header->code_no >= 0 && header->anno_no >= 0 &&
+      header->name_size >= 0)
+   {
+      size = sizeof(KBImageHeaderCell)+
+         header->symbol_no*sizeof(KBImageSymbolCell)+
+         (header->record_no+1)*sizeof(KBImageRecordCell)+
+         (header->code_no+header->anno_no)*sizeof(int64_t)+
+         header->anno_no*header->annotation_no*sizeof(double)+
+         header->name_size;
+      if(size == image_stat.st_size)
+      {
+         set = image_replay(header, DStrView(name), bank);
+         VERBOUTARG("Knowledge base image loaded from ", DStrView(name));
+      }
+   }
+   munmap(map, image_stat.st_size);
+   DStrFree(name);
+
+   return set;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBImageCheck()
+//
+//   Load the clause patterns of kb once from the image and once from
+//   the text file, each into a fresh term bank over the signature of
+//   kb. Return true if the image is valid and both loads give the
+//   same signature and the same AnnoSet (terms, term bank entry
+//   numbers and annotations).
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool KBImageCheck(char* kb, long expected)
+{
+   TB_p      image_bank = image_check_bank_alloc(kb),
+             text_bank = image_check_bank_alloc(kb);
+   AnnoSet_p image_set, text_set;
+   DStr_p    name = DStrAlloc();
+   Scanner_p in;
+   bool      res = false;
+
+   image_set = KBImageLoad(kb, image_bank, expected);
+   in = CreateScanner(StreamTypeFile,
+                      KBFileName(name, kb, "clausepatterns"),
+                      true, NULL, true);
+   text_set = AnnoSetParse(in, text_bank, expected);
+   DestroyScanner(in);
+
+   if(image_set)
+   {
+      res = image_sig_equal(image_bank->sig, text_bank->sig) &&
+         image_sets_equal(image_set, text_set);
+   }
+   image_check_bank_free(text_bank, text_set);
+   image_check_bank_free(image_bank, image_set);
+   DStrFree(name);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: KBAnnoSetLoad()
+//
+//   Return the annotated clause patterns of kb, from the image if
+//   possible, otherwise from the text file.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, changes bank and signature, memory
+//                   operations
+//
+/----------------------------------------------------------------------*/
+
+AnnoSet_p KBAnnoSetLoad(char* kb, TB_p bank, long expected)
+{
+   AnnoSet_p set = KBImageLoad(kb, bank, expected);
+   DStr_p    name;
+   Scanner_p in;
+
+   if(!set)
+   {
+      name = DStrAlloc();
+      in = CreateScanner(StreamTypeFile,
+                         KBFileName(name, kb, "clausepatterns"),
+                         true, NULL, true);
+      set = AnnoSetParse(in, bank, expected);
+      DestroyScanner(in);
+      DStrFree(name);
+   }
+   return set;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
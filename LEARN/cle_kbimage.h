@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------
+
+File  : cle_kbimage.h
+
+Author: The E developers
+
+Contents
+
+  Binary images of the clause pattern file of a knowledge base. The
+  text file is the authoritative representation, the image
+  (clausepatterns.img) is a pre-tokenized copy of it that can be
+  mapped into memory and replayed into an AnnoSet without running
+  the scanner. The image records the annotated terms in file order
+  (with symbols and variables in order of first occurrence), so that
+  loading it yields exactly the same set (including signature codes
+  and term bank entry numbers) as parsing the text file.
+
+  The format is native (byte order and word size of the machine that
+  wrote it). An image with the wrong magic number, a different
+  number of annotations, or a size/modification time that does not
+  match the current text file is ignored, and the text file is
+  parsed instead. Every image is loaded and compared with the text
+  file after it has been written, and removed if the two differ.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 04:12:37 CEST 2026
+    New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    KBImageCheck(), version 2 (terms replayed without subterm
+    retyping)
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLE_KBIMAGE
+
+#define CLE_KBIMAGE
+
+#include <stdint.h>
+#include <cle_kbdesc.h>
+#include <cle_annoterms.h>
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define KB_IMAGE_FILE    "clausepatterns.img"
+#define KB_IMAGE_MAGIC   0x31474d49424b45LL  /* "EKBIMG1" */
+#define KB_IMAGE_VERSION 2
+
+/* The image consists of the header, followed by the symbol table,
+   record_no+1 records (the last one marks the end of the code and
+   annotation sections), the term codes, the annotation keys, the
+   annotation values (annotation_no per key), and the symbol
+   names. Terms are stored in prefix order, a code c >= 0 is a
+   function symbol (index into the symbol table), c < 0 is variable
+   number -c. */
+
+typedef struct kb_image_header_cell
+{
+   int64_t magic;
+   int64_t version;
+   int64_t annotation_no;
+   int64_t source_size;   /* Of the text file the image was built */
+   int64_t source_mtime;  /* from */
+   int64_t symbol_no;
+   int64_t record_no;
+   int64_t code_no;
+   int64_t anno_no;
+   int64_t name_size;
+}KBImageHeaderCell, *KBImageHeader_p;
+
+typedef struct kb_image_symbol_cell
+{
+   int64_t name;   /* Offset into the name section */
+   int32_t arity;
+   int32_t type;   /* FuncSymbType */
+}KBImageSymbolCell, *KBImageSymbol_p;
+
+typedef struct kb_image_record_cell
+{
+   int64_t code;   /* First code of the term */
+   int64_t anno;   /* First annotation of the term */
+}KBImageRecordCell, *KBImageRecord_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+long      KBImageWrite(char* kb, long expected);
+AnnoSet_p KBImageLoad(char* kb, TB_p bank, long expected);
+bool      KBImageCheck(char* kb, long expected);
+AnnoSet_p KBAnnoSetLoad(char* kb, TB_p bank, long expected);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -234,8 +234,8 @@ void ComputeClauseSetNumFeatures(Features_p features, ClauseSet_p set,
    features->features[1] = 0;
    features->features[2] = 0;
 
-   for(clause = set->anchor->succ; clause != set->anchor; clause =
-     clause->succ)
+   for(clause = ClauseSucc(set->anchor); clause != set->anchor; clause =
+     ClauseSucc(clause))
    {
       if(ClauseIsUnit(clause))
       {
@@ -17,6 +17,8 @@ Changes
 
 <1> Tue Aug 31 13:47:43 MET DST 1999
     New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Load clause patterns from the binary image if it is current.
 
 -----------------------------------------------------------------------*/
 
@@ -331,21 +333,14 @@ TSMAdmin_p TSMFromKB(bool flat_patterns, double evalweights[], char*
            double set_part, double dist_part, IndexType
            indextype, TSMType tsmtype, long indexdepth)
 {
-   DStr_p         filename = DStrAlloc();
    AnnoSet_p      annoset;
    FlatAnnoSet_p  flatset = FlatAnnoSetAlloc();
    TB_p bank =    TBAlloc(sig);
    TSMAdmin_p     admin;
    PatternSubst_p subst;
-   Scanner_p      in;
    double         eval_default;
 
-   in = CreateScanner(StreamTypeFile,
-                      KBFileName(filename, kb, "clausepatterns"),
-                      true, NULL, true);
-   annoset = AnnoSetParse(in, bank, KB_ANNOTATION_NO);
-   DestroyScanner(in);
-   DStrFree(filename);
+   annoset = KBAnnoSetLoad(kb, bank, KB_ANNOTATION_NO);
 
    eval_default = ExampleSetFromKB(annoset, flatset, flat_patterns,
                bank, evalweights, kb, sig, target,
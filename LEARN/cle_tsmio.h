@@ -28,6 +28,7 @@ Changes
 #include <cle_examplerep.h>
 #include <cle_tsm.h>
 #include <cle_kbdesc.h>
+#include <cle_kbimage.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -42,6 +42,9 @@ char* TONames[]=
    NULL
 };
 
+/* Source of OCB idents */
+static long ocb_ident_counter = 0;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -175,6 +178,7 @@ OCB_p OCBAlloc(TermOrdering type, bool prec_by_weight, Sig_p sig, HoOrderKind ho
 
    handle = OCBCellAlloc();
 
+   handle->ident = ++ocb_ident_counter;
    handle->type  = type;
    handle->sig   = sig;
    handle->min_constants  = PDIntArrayAlloc(16,0);
@@ -59,6 +59,9 @@ typedef enum
 
 typedef struct ocb_cell
 {
+   long          ident;        /* Unique for each OCB, so that cached
+                                  ordering information can be
+                                  attributed reliably */
    TermOrdering  type;
    long          sig_size;
    Sig_p         sig;          /* Slightly hacked...this is only an
@@ -18,9 +18,17 @@
   Changes
 
   Created: Mon Apr  3 23:02:28 GMT 2000
+  Sun Oct 18 23:48:10 CEST 2026: Parallel checking in forked
+  checker processes
+  Mon Oct 19 04:12:37 CEST 2026: Documented that parallel checking
+  preserves verdicts, not verbose output
 
   -----------------------------------------------------------------------*/
 
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
 #include "pcl_proofcheck.h"
 
 
@@ -249,8 +257,8 @@ static void clause_set_print_otter(FILE* out, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       clause_print_otter(out, handle);
       fputc('\n', out);
@@ -489,8 +497,8 @@ static void clause_set_print_dfg(FILE* out, ClauseSet_p set)
 {
    Clause_p handle;
 
-   for(handle = set->anchor->succ; handle!=set->anchor; handle =
-          handle->succ)
+   for(handle = ClauseSucc(set->anchor); handle!=set->anchor; handle =
+          ClauseSucc(handle))
    {
       clause_print_dfg(out, handle);
       fputc('\n', out);
@@ -556,6 +564,330 @@ static bool pcl_verify_spass(ClauseSet_p problem,char *executable,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_collect_steps()
+//
+//   Return a stack with the steps of prot in order.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PStack_p pcl_collect_steps(PCLProt_p prot)
+{
+   PStack_p trav_stack, stack = PStackAlloc();
+   PTree_p  cell;
+
+   trav_stack = PTreeTraverseInit(prot->steps);
+   while((cell=PTreeTraverseNext(trav_stack)))
+   {
+      PStackPushP(stack, cell->key);
+   }
+   PTreeTraverseExit(trav_stack);
+
+   return stack;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_print_check_header()
+//
+//   Announce the check of step.
+//
+// Global Variables: OutputLevel
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_print_check_header(PCLStep_p step)
+{
+   if(OutputLevel)
+   {
+      fprintf(GlobalOut, "# Checking ");
+      PCLStepPrint(GlobalOut, step);
+      fputc('\n', GlobalOut);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_print_check_result()
+//
+//   Print the outcome of a step check. Return 1 if the step counts
+//   as verified, 0 otherwise. Increase *unchecked for unsupported
+//   steps.
+//
+// Global Variables: OutputLevel
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static long pcl_print_check_result(PCLCheckType check, long *unchecked)
+{
+   long res = 0;
+
+   switch(check)
+   {
+   case CheckByAssumption:
+         OUTPRINT(1,"# Checked (by assumption)\n\n");
+         res = 1;
+         break;
+   case CheckOk:
+         OUTPRINT(1,"# Checked (by prover)\n\n");
+         res = 1;
+         break;
+   case CheckFail:
+         OUTPRINT(1,"# FAILED\n\n");
+         break;
+   case CheckNotImplemented:
+         OUTPRINT(1,"# Check not implemented, assuming true!\n\n");
+         (*unchecked)++;
+         break;
+   default:
+         assert(false);
+         break;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_fd_read()
+//
+//   Read exactly size bytes from fd. Return false on end of file or
+//   error.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads from fd
+//
+/----------------------------------------------------------------------*/
+
+static bool pcl_fd_read(int fd, void* buf, size_t size)
+{
+   char    *pos = buf;
+   ssize_t got;
+
+   while(size)
+   {
+      got = read(fd, pos, size);
+      if(got < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(got <= 0)
+      {
+         return false;
+      }
+      pos  += got;
+      size -= got;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_fd_write()
+//
+//   Write size bytes to fd. Return false on error (e.g. if the
+//   reader has terminated).
+//
+// Global Variables: -
+//
+// Side Effects    : Writes to fd
+//
+/----------------------------------------------------------------------*/
+
+static bool pcl_fd_write(int fd, void* buf, size_t size)
+{
+   char    *pos = buf;
+   ssize_t done;
+
+   while(size)
+   {
+      done = write(fd, pos, size);
+      if(done < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(done <= 0)
+      {
+         return false;
+      }
+      pos  += done;
+      size -= done;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_check_worker()
+//
+//   Main loop of a checker process: Read step numbers from req_fd,
+//   check the steps with output going to out, and send the results
+//   to res_fd. Terminates the process when req_fd is closed.
+//
+// Global Variables: GlobalOut
+//
+// Side Effects    : Runs the prover, output, terminates the process
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_check_worker(PCLProt_p prot, PStack_p steps,
+                             ProverType prover, char* executable,
+                             long time_limit, long worker,
+                             int req_fd, int res_fd, FILE* out)
+{
+   PCLCheckResultCell result;
+   long               i;
+
+   GlobalOut = out;
+   while(pcl_fd_read(req_fd, &i, sizeof(long)))
+   {
+      assert(i >= 0 && i < PStackGetSP(steps));
+      result.step      = i;
+      result.worker    = worker;
+      result.out_start = ftell(out);
+      result.res       = PCLStepCheck(prot, PStackElementP(steps, i),
+                                      prover, executable, time_limit);
+      fflush(out);
+      result.out_end   = ftell(out);
+      if(!pcl_fd_write(res_fd, &result, sizeof(result)))
+      {
+         break;
+      }
+   }
+   /* Do not run the atexit() handlers of the parent */
+   _exit(NO_ERROR);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_start_worker()
+//
+//   Fork a checker process for the steps and initialize the worker
+//   cell workers[index]. The first index cells are already running
+//   and their file descriptors are closed in the child.
+//
+// Global Variables: GlobalOut
+//
+// Side Effects    : Creates a process, pipes and a temporary file
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_start_worker(PCLProt_p prot, PStack_p steps,
+                             ProverType prover, char* executable,
+                             long time_limit, PCLCheckWorker_p workers,
+                             long index)
+{
+   int  req[2], res[2];
+   long i;
+   PCLCheckWorker_p worker = &(workers[index]);
+
+   worker->out = tmpfile();
+   if(!worker->out || pipe(req) || pipe(res))
+   {
+      TmpErrno = errno;
+      SysError("Cannot create checker worker", SYS_ERROR);
+   }
+   fflush(GlobalOut);
+   fflush(stdout);
+   fflush(stderr);
+   worker->pid = fork();
+   if(worker->pid < 0)
+   {
+      TmpErrno = errno;
+      SysError("Cannot fork checker worker", SYS_ERROR);
+   }
+   if(worker->pid == 0)
+   {
+      close(req[1]);
+      close(res[0]);
+      for(i=0; i<index; i++)
+      {
+         close(workers[i].req_fd);
+         close(workers[i].res_fd);
+      }
+      pcl_check_worker(prot, steps, prover, executable, time_limit,
+                       index, req[0], res[1], worker->out);
+   }
+   close(req[0]);
+   close(res[1]);
+   worker->req_fd = req[1];
+   worker->res_fd = res[0];
+   worker->step   = -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_stop_worker()
+//
+//   Close the request pipe of a worker and wait for it to
+//   terminate.
+//
+// Global Variables: -
+//
+// Side Effects    : Process control
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_stop_worker(PCLCheckWorker_p worker)
+{
+   if(worker->pid)
+   {
+      close(worker->req_fd);
+      close(worker->res_fd);
+      waitpid(worker->pid, NULL, 0);
+      worker->pid = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pcl_copy_worker_output()
+//
+//   Copy the bytes [start, end) of a worker output file to GlobalOut.
+//
+// Global Variables: GlobalOut
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void pcl_copy_worker_output(FILE* in, long start, long end)
+{
+   char    buf[4096];
+   ssize_t got;
+
+   while(start < end)
+   {
+      got = pread(fileno(in), buf, MIN(end-start, (long)sizeof(buf)),
+                  start);
+      if(got <= 0)
+      {
+         TmpErrno = errno;
+         SysError("Cannot read checker worker output", FILE_ERROR);
+      }
+      fwrite(buf, 1, got, GlobalOut);
+      start += got;
+   }
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -754,55 +1086,191 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
 long PCLProtCheck(PCLProt_p prot, ProverType prover, char* executable,
                   long time_limit, long *unchecked)
 {
-   PStack_p      trav_stack,stack = PStackAlloc();
+   PStack_p      stack = pcl_collect_steps(prot);
    PStackPointer i;
-   PTree_p       cell;
    PCLStep_p     step;
    long          res=0;
    PCLCheckType  check;
 
    *unchecked = 0;
-   trav_stack = PTreeTraverseInit(prot->steps);
-   while((cell=PTreeTraverseNext(trav_stack)))
+   for(i=0; i<PStackGetSP(stack); i++)
    {
-      step=cell->key;
-      PStackPushP(stack, step);
+      step = PStackElementP(stack,i);
+      pcl_print_check_header(step);
+      check = PCLStepCheck(prot, step, prover, executable,
+                           time_limit);
+      res += pcl_print_check_result(check, unchecked);
    }
-   PTreeTraverseExit(trav_stack);
+   PStackFree(stack);
+   return res;
+}
 
-   for(i=0; i<PStackGetSP(stack); i++)
+
+/*-----------------------------------------------------------------------
+//
+// Function: PCLProtCheckParallel()
+//
+//   As PCLProtCheck(), but check the steps with up to workers
+//   checker processes forked from the current one. Each step is
+//   still checked by PCLStepCheck(), i.e. by a run of the external
+//   prover, so the gain is only that up to workers of these runs
+//   proceed at the same time. The proof obligation of a step depends only on the text of its
+//   premises, not on whether they have been verified, so all steps
+//   can be checked independently. Each worker has at most one step
+//   in flight, and its output is buffered in a private temporary
+//   file and printed with the result in protocol order, so that the
+//   verdicts and their order are the same as for the sequential
+//   check. With OutputLevel > 1 the printed proof obligations are
+//   not byte-identical, as every worker numbers the clauses it
+//   creates (i_0_N) independently. Steps of a worker that dies are
+//   considered failed, if all workers are gone the remaining steps
+//   are checked sequentially.
+//
+// Global Variables: GlobalOut, OutputLevel
+//
+// Side Effects    : Creates processes, runs the prover, output
+//
+/----------------------------------------------------------------------*/
+
+long PCLProtCheckParallel(PCLProt_p prot, ProverType prover,
+                          char* executable, long time_limit,
+                          int workers, long *unchecked)
+{
+   PStack_p           stack;
+   PCLCheckWorker_p   worker_array;
+   PCLCheckResultCell result, *results;
+   struct pollfd      *fds;
+   long               i, steps, next = 0, printed = 0, res = 0;
+   int                active;
+   void               (*old_handler)(int);
+
+   if(workers <= 1 || PCLProtStepNo(prot) <= 1)
    {
-      step = PStackElementP(stack,i);
-      if(OutputLevel)
+      return PCLProtCheck(prot, prover, executable, time_limit, unchecked);
+   }
+   *unchecked   = 0;
+   stack        = pcl_collect_steps(prot);
+   steps        = PStackGetSP(stack);
+   workers      = MIN(workers, steps);
+   results      = SecureMalloc(steps*sizeof(PCLCheckResultCell));
+   worker_array = SecureMalloc(workers*sizeof(PCLCheckWorkerCell));
+   fds          = SecureMalloc(workers*sizeof(struct pollfd));
+   for(i=0; i<steps; i++)
+   {
+      results[i].step      = i;
+      results[i].worker    = -1;
+      results[i].out_start = -1;
+   }
+   /* A worker dying between two steps must not kill us */
+   old_handler = signal(SIGPIPE, SIG_IGN);
+   for(i=0; i<workers; i++)
+   {
+      pcl_start_worker(prot, stack, prover, executable, time_limit,
+                       worker_array, i);
+   }
+   active = workers;
+
+   while(printed < steps)
+   {
+      /* Hand out steps to idle workers */
+      for(i=0; i<workers && next<steps; i++)
       {
-         fprintf(GlobalOut, "# Checking ");
-         PCLStepPrint(GlobalOut, step);
-         fputc('\n', GlobalOut);
+         if(worker_array[i].pid && worker_array[i].step == -1)
+         {
+            if(pcl_fd_write(worker_array[i].req_fd, &next, sizeof(long)))
+            {
+               worker_array[i].step = next++;
+            }
+            else
+            {
+               pcl_stop_worker(&(worker_array[i]));
+               active--;
+            }
+         }
       }
-      check = PCLStepCheck(prot, step, prover, executable,
-                           time_limit);
-      switch(check)
+      /* Print finished steps in order */
+      while(printed < steps && results[printed].out_start != -1)
       {
-      case CheckByAssumption:
-            OUTPRINT(1,"# Checked (by assumption)\n\n");
-            res++;
-            break;
-      case CheckOk:
-            OUTPRINT(1,"# Checked (by prover)\n\n");
-            res++;
-            break;
-      case CheckFail:
-            OUTPRINT(1,"# FAILED\n\n");
-            break;
-      case CheckNotImplemented:
-            OUTPRINT(1,"# Check not implemented, assuming true!\n\n");
-            (*unchecked)++;
-            break;
-      default:
-            assert(false);
-            break;
+         pcl_print_check_header(PStackElementP(stack, printed));
+         if(results[printed].worker != -1)
+         {
+            pcl_copy_worker_output(worker_array[results[printed].worker].out,
+                                   results[printed].out_start,
+                                   results[printed].out_end);
+         }
+         res += pcl_print_check_result(results[printed].res, unchecked);
+         printed++;
+      }
+      if(printed == steps)
+      {
+         break;
+      }
+      if(!active)
+      {
+         /* No workers left, do it ourselves */
+         assert(printed == next);
+         pcl_print_check_header(PStackElementP(stack, next));
+         results[next].res = PCLStepCheck(prot, PStackElementP(stack, next),
+                                          prover, executable, time_limit);
+         res += pcl_print_check_result(results[next].res, unchecked);
+         printed = ++next;
+         continue;
+      }
+      /* Wait for results */
+      for(i=0; i<workers; i++)
+      {
+         fds[i].fd      = worker_array[i].pid? worker_array[i].res_fd : -1;
+         fds[i].events  = POLLIN;
+         fds[i].revents = 0;
+      }
+      if(poll(fds, workers, -1) < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         TmpErrno = errno;
+         SysError("Cannot wait for checker workers", SYS_ERROR);
       }
+      for(i=0; i<workers; i++)
+      {
+         if(!fds[i].revents || !worker_array[i].pid)
+         {
+            continue;
+         }
+         if(pcl_fd_read(worker_array[i].res_fd, &result, sizeof(result)))
+         {
+            assert(result.step == worker_array[i].step);
+            results[result.step] = result;
+         }
+         else
+         {
+            /* The worker died, count its step as failed */
+            if(worker_array[i].step != -1)
+            {
+               result.step      = worker_array[i].step;
+               result.res       = CheckFail;
+               result.worker    = -1;
+               result.out_start = 0;
+               result.out_end   = 0;
+               results[result.step] = result;
+            }
+            pcl_stop_worker(&(worker_array[i]));
+            active--;
+         }
+         worker_array[i].step = -1;
+      }
+   }
+
+   for(i=0; i<workers; i++)
+   {
+      pcl_stop_worker(&(worker_array[i]));
+      fclose(worker_array[i].out);
    }
+   signal(SIGPIPE, old_handler);
+   FREE(fds);
+   FREE(worker_array);
+   FREE(results);
    PStackFree(stack);
    return res;
 }
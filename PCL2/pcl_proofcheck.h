@@ -19,6 +19,8 @@ Changes
 
 <1> Mon Apr  3 22:49:51 GMT 2000
     New
+<2> Sun Oct 18 23:48:10 CEST 2026
+    Parallel checking in forked checker processes
 
 -----------------------------------------------------------------------*/
 
@@ -26,6 +28,7 @@ Changes
 
 #define PCL_PROOFCHECK
 
+#include <sys/types.h>
 #include <cio_tempfile.h>
 #include <pcl_protocol.h>
 
@@ -51,6 +54,32 @@ typedef enum
 }ProverType;
 
 
+/* A checker process forked by PCLProtCheckParallel(). It keeps its
+   own copy of the protocol and checks the steps it is sent, each
+   with a separate run of the external prover. */
+
+typedef struct pcl_check_worker_cell
+{
+   pid_t pid;      /* 0 if the worker has terminated */
+   int   req_fd;   /* Parent writes step numbers here... */
+   int   res_fd;   /* ...and reads the results from here */
+   FILE  *out;     /* Output the worker produced */
+   long  step;     /* Step being checked, -1 if idle */
+}PCLCheckWorkerCell, *PCLCheckWorker_p;
+
+/* Result of a single step. The output of the check is
+   [out_start, out_end) in the file of the worker. */
+
+typedef struct pcl_check_result_cell
+{
+   long         step;
+   PCLCheckType res;
+   long         worker;    /* -1 if checked by the parent */
+   long         out_start; /* -1 if not yet checked */
+   long         out_end;
+}PCLCheckResultCell, *PCLCheckResult_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -70,6 +99,9 @@ PCLCheckType PCLStepCheck(PCLProt_p prot, PCLStep_p step, ProverType
 long PCLProtCheck(PCLProt_p prot, ProverType
         prover, char* executable, long time_limit, long*
         unchecked);
+long PCLProtCheckParallel(PCLProt_p prot, ProverType prover,
+                          char* executable, long time_limit,
+                          int workers, long* unchecked);
 
 #endif
 
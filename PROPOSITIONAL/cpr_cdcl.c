@@ -0,0 +1,1715 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_cdcl.c
+
+Author: The E developers
+
+Contents
+
+  A CDCL SAT solver in the style of MiniSat/Glucose, see
+  cpr_cdcl.h.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 00:41:26 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <ctype.h>
+#include <string.h>
+#include "cpr_cdcl.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define LIT_VAR(lit)  ((lit)>>1)
+#define LIT_NEG(lit)  ((lit)^1)
+#define LIT_SIGN(lit) ((lit)&1)
+
+/* Value of a literal: 1 true, -1 false, 0 open */
+#define LIT_VALUE(solver, lit) \
+   (LIT_SIGN(lit)? -(solver)->vals[LIT_VAR(lit)]:(solver)->vals[LIT_VAR(lit)])
+
+#define DECISION_LEVEL(solver) PStackGetSP((solver)->trail_lim)
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_code()
+//
+//   Return the internal code of a DIMACS literal.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline int lit_code(int lit)
+{
+   return lit > 0 ? 2*lit : 2*(-lit)+1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_up()
+//
+//   Move the heap element at position i up until the heap property
+//   holds.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the heap
+//
+/----------------------------------------------------------------------*/
+
+static void heap_up(CDCLSolver_p solver, int i)
+{
+   int var = solver->heap[i], parent;
+
+   while(i)
+   {
+      parent = (i-1)/2;
+      if(solver->activity[solver->heap[parent]] >= solver->activity[var])
+      {
+         break;
+      }
+      solver->heap[i] = solver->heap[parent];
+      solver->heap_pos[solver->heap[i]] = i;
+      i = parent;
+   }
+   solver->heap[i] = var;
+   solver->heap_pos[var] = i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_down()
+//
+//   Move the heap element at position i down until the heap property
+//   holds.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the heap
+//
+/----------------------------------------------------------------------*/
+
+static void heap_down(CDCLSolver_p solver, int i)
+{
+   int var = solver->heap[i], child;
+
+   while((child = 2*i+1) < solver->heap_size)
+   {
+      if(child+1 < solver->heap_size &&
+         solver->activity[solver->heap[child+1]] >
+         solver->activity[solver->heap[child]])
+      {
+         child++;
+      }
+      if(solver->activity[solver->heap[child]] <= solver->activity[var])
+      {
+         break;
+      }
+      solver->heap[i] = solver->heap[child];
+      solver->heap_pos[solver->heap[i]] = i;
+      i = child;
+   }
+   solver->heap[i] = var;
+   solver->heap_pos[var] = i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_insert()
+//
+//   Insert var into the heap of decision candidates (if it is not
+//   already there).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the heap
+//
+/----------------------------------------------------------------------*/
+
+static void heap_insert(CDCLSolver_p solver, int var)
+{
+   if(solver->heap_pos[var] == -1)
+   {
+      solver->heap[solver->heap_size] = var;
+      solver->heap_pos[var] = solver->heap_size;
+      solver->heap_size++;
+      heap_up(solver, solver->heap_size-1);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_extract_max()
+//
+//   Remove and return the variable with the highest activity.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the heap
+//
+/----------------------------------------------------------------------*/
+
+static int heap_extract_max(CDCLSolver_p solver)
+{
+   int res = solver->heap[0];
+
+   solver->heap_size--;
+   solver->heap_pos[res] = -1;
+   if(solver->heap_size)
+   {
+      solver->heap[0] = solver->heap[solver->heap_size];
+      solver->heap_pos[solver->heap[0]] = 0;
+      heap_down(solver, 0);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_bump()
+//
+//   Increase the activity of var (EVSIDS), rescaling all activities
+//   if they become too large.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities and heap
+//
+/----------------------------------------------------------------------*/
+
+static void var_bump(CDCLSolver_p solver, int var)
+{
+   int i;
+
+   solver->activity[var] += solver->var_inc;
+   if(solver->activity[var] > 1e100)
+   {
+      for(i=1; i<=solver->var_no; i++)
+      {
+         solver->activity[i] *= 1e-100;
+      }
+      solver->var_inc *= 1e-100;
+   }
+   if(solver->heap_pos[var] != -1)
+   {
+      heap_up(solver, solver->heap_pos[var]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_bump()
+//
+//   Increase the activity of a learned clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities
+//
+/----------------------------------------------------------------------*/
+
+static void clause_bump(CDCLSolver_p solver, CDCLClause_p clause)
+{
+   PStackPointer i;
+   CDCLClause_p  handle;
+
+   clause->activity += solver->cla_inc;
+   if(clause->activity > 1e20)
+   {
+      for(i=0; i<PStackGetSP(solver->learnts); i++)
+      {
+         handle = PStackElementP(solver->learnts, i);
+         handle->activity *= 1e-20;
+      }
+      solver->cla_inc *= 1e-20;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: grow_vars()
+//
+//   Make sure that variables up to var exist.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void grow_vars(CDCLSolver_p solver, int var)
+{
+   int i, cap;
+
+   if(var <= solver->var_no)
+   {
+      return;
+   }
+   if(var >= solver->var_cap)
+   {
+      cap = MAX(2*solver->var_cap, var+1);
+      solver->vals        = SecureRealloc(solver->vals, cap*sizeof(signed char));
+      solver->levels      = SecureRealloc(solver->levels, cap*sizeof(int));
+      solver->reasons     = SecureRealloc(solver->reasons,
+                                          cap*sizeof(CDCLClause_p));
+      solver->units       = SecureRealloc(solver->units, cap*sizeof(long));
+      solver->activity    = SecureRealloc(solver->activity, cap*sizeof(double));
+      solver->phase       = SecureRealloc(solver->phase, cap*sizeof(signed char));
+      solver->model       = SecureRealloc(solver->model, cap*sizeof(signed char));
+      solver->seen        = SecureRealloc(solver->seen, cap*sizeof(signed char));
+      solver->failed      = SecureRealloc(solver->failed, cap*sizeof(signed char));
+      solver->level_stamp = SecureRealloc(solver->level_stamp, cap*sizeof(long));
+      solver->heap        = SecureRealloc(solver->heap, cap*sizeof(int));
+      solver->heap_pos    = SecureRealloc(solver->heap_pos, cap*sizeof(int));
+      solver->trail       = SecureRealloc(solver->trail, cap*sizeof(int));
+      solver->watches     = SecureRealloc(solver->watches,
+                                          2*cap*sizeof(CDCLWatchListCell));
+      for(i=2*solver->var_cap; i<2*cap; i++)
+      {
+         solver->watches[i].watches  = NULL;
+         solver->watches[i].size     = 0;
+         solver->watches[i].capacity = 0;
+      }
+      for(i=solver->var_cap; i<cap; i++)
+      {
+         solver->level_stamp[i] = 0;
+      }
+      solver->var_cap = cap;
+   }
+   for(i=solver->var_no+1; i<=var; i++)
+   {
+      solver->vals[i]     = 0;
+      solver->levels[i]   = 0;
+      solver->reasons[i]  = NULL;
+      solver->units[i]    = -1;
+      solver->activity[i] = 0.0;
+      solver->phase[i]    = 1;
+      solver->model[i]    = 0;
+      solver->seen[i]     = 0;
+      solver->failed[i]   = 0;
+      solver->heap_pos[i] = -1;
+      heap_insert(solver, i);
+   }
+   solver->var_no = var;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: watch_push()
+//
+//   Add a watch for clause to the list of lit.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void watch_push(CDCLSolver_p solver, int lit, CDCLClause_p clause,
+                       int blocker)
+{
+   CDCLWatchList_p list = &(solver->watches[lit]);
+
+   if(list->size == list->capacity)
+   {
+      list->capacity = MAX(4, 2*list->capacity);
+      list->watches  = SecureRealloc(list->watches,
+                                     list->capacity*sizeof(CDCLWatchCell));
+   }
+   list->watches[list->size].clause  = clause;
+   list->watches[list->size].blocker = blocker;
+   list->size++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: trace_record()
+//
+//   Create a new trace record for original clause orig (or -1 for a
+//   derived one) with the antecedents collected in solver->ante.
+//   Return its number.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, resets solver->ante
+//
+/----------------------------------------------------------------------*/
+
+static long trace_record(CDCLSolver_p solver, long orig)
+{
+   long res = PStackGetSP(solver->trace_orig);
+
+   PStackPushInt(solver->trace_start, PStackGetSP(solver->trace_ante));
+   PStackPushInt(solver->trace_orig, orig);
+   PStackPushStack(solver->trace_ante, solver->ante);
+   PStackReset(solver->ante);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: trace_push_units()
+//
+//   Add the trace records of the level 0 values of the literals of
+//   clause (except for the first skip ones) to solver->ante.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void trace_push_units(CDCLSolver_p solver, CDCLClause_p clause,
+                             int skip)
+{
+   int i;
+
+   for(i=skip; i<clause->size; i++)
+   {
+      PStackPushInt(solver->ante, solver->units[LIT_VAR(clause->lits[i])]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: assign()
+//
+//   Make lit true at the current decision level with the given
+//   reason. When tracing, level 0 values get a trace record: unit
+//   (for values without reason) or one derived from the reason.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the assignment
+//
+/----------------------------------------------------------------------*/
+
+static void assign(CDCLSolver_p solver, int lit, CDCLClause_p reason,
+                   long unit)
+{
+   int var = LIT_VAR(lit);
+
+   assert(!solver->vals[var]);
+   solver->vals[var]    = LIT_SIGN(lit)? -1 : 1;
+   solver->levels[var]  = DECISION_LEVEL(solver);
+   solver->reasons[var] = reason;
+   solver->trail[solver->trail_size++] = lit;
+
+   if(solver->trace && !DECISION_LEVEL(solver))
+   {
+      if(reason)
+      {
+         PStackPushInt(solver->ante, reason->id);
+         trace_push_units(solver, reason, 1);
+         unit = trace_record(solver, -1);
+      }
+      solver->units[var] = unit;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cancel_until()
+//
+//   Undo all assignments above the given decision level, saving the
+//   phases of the variables.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the assignment
+//
+/----------------------------------------------------------------------*/
+
+static void cancel_until(CDCLSolver_p solver, long level)
+{
+   int lim, var;
+
+   if(DECISION_LEVEL(solver) <= level)
+   {
+      return;
+   }
+   lim = PStackElementInt(solver->trail_lim, level);
+   while(solver->trail_size > lim)
+   {
+      solver->trail_size--;
+      var = LIT_VAR(solver->trail[solver->trail_size]);
+      solver->phase[var]   = LIT_SIGN(solver->trail[solver->trail_size]);
+      solver->vals[var]    = 0;
+      solver->reasons[var] = NULL;
+      heap_insert(solver, var);
+   }
+   solver->prop_head = lim;
+   while(DECISION_LEVEL(solver) > level)
+   {
+      PStackDiscardTop(solver->trail_lim);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: propagate()
+//
+//   Perform unit propagation on all pending assignments. Return a
+//   conflict clause, or NULL if there is no conflict.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the assignment and watch lists
+//
+/----------------------------------------------------------------------*/
+
+static CDCLClause_p propagate(CDCLSolver_p solver)
+{
+   CDCLClause_p    conflict = NULL, clause;
+   CDCLWatchList_p list;
+   CDCLWatchCell   watch;
+   long            i, j;
+   int             false_lit, first, k, tmp;
+
+   while(solver->prop_head < solver->trail_size)
+   {
+      false_lit = LIT_NEG(solver->trail[solver->prop_head++]);
+      list = &(solver->watches[false_lit]);
+      solver->propagations++;
+
+      for(i=0, j=0; i<list->size;)
+      {
+         watch = list->watches[i++];
+         if(LIT_VALUE(solver, watch.blocker) == 1)
+         {
+            list->watches[j++] = watch;
+            continue;
+         }
+         clause = watch.clause;
+         if(clause->lits[0] == false_lit)
+         {
+            clause->lits[0] = clause->lits[1];
+            clause->lits[1] = false_lit;
+         }
+         first = clause->lits[0];
+         watch.blocker = first;
+         if(LIT_VALUE(solver, first) == 1)
+         {
+            list->watches[j++] = watch;
+            continue;
+         }
+         for(k=2; k<clause->size; k++)
+         {
+            if(LIT_VALUE(solver, clause->lits[k]) != -1)
+            {
+               tmp = clause->lits[k];
+               clause->lits[k] = false_lit;
+               clause->lits[1] = tmp;
+               watch_push(solver, tmp, clause, first);
+               goto next_watch;
+            }
+         }
+         /* Clause is unit or conflicting */
+         list->watches[j++] = watch;
+         if(LIT_VALUE(solver, first) == -1)
+         {
+            conflict = clause;
+            solver->prop_head = solver->trail_size;
+            while(i < list->size)
+            {
+               list->watches[j++] = list->watches[i++];
+            }
+         }
+         else
+         {
+            assign(solver, first, clause, -1);
+         }
+      next_watch:
+         ;
+      }
+      list->size = j;
+      if(conflict)
+      {
+         break;
+      }
+   }
+   return conflict;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_alloc()
+//
+//   Allocate a clause with the literals in lits (internal codes).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static CDCLClause_p clause_alloc(PStack_p lits, bool learnt, long id)
+{
+   int          size = PStackGetSP(lits), i;
+   CDCLClause_p handle = SecureMalloc(sizeof(CDCLClauseCell)+size*sizeof(int));
+
+   handle->id       = id;
+   handle->size     = size;
+   handle->lbd      = 0;
+   handle->learnt   = learnt;
+   handle->deleted  = false;
+   handle->activity = 0.0;
+   for(i=0; i<size; i++)
+   {
+      handle->lits[i] = PStackElementInt(lits, i);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_attach()
+//
+//   Watch the first two literals of clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void clause_attach(CDCLSolver_p solver, CDCLClause_p clause)
+{
+   assert(clause->size >= 2);
+   watch_push(solver, clause->lits[0], clause, clause->lits[1]);
+   watch_push(solver, clause->lits[1], clause, clause->lits[0]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: analyze()
+//
+//   Derive the first-UIP clause from a conflict into
+//   solver->learnt_lits (asserting literal first, a literal of the
+//   backjump level second), minimize it, and return the backjump
+//   level. When tracing, the antecedents are collected in
+//   solver->ante.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activities
+//
+/----------------------------------------------------------------------*/
+
+static long analyze(CDCLSolver_p solver, CDCLClause_p conflict)
+{
+   PStack_p     learnt = solver->learnt_lits;
+   long         level = DECISION_LEVEL(solver), res = 0;
+   int          path = 0, lit = -1, idx = solver->trail_size-1;
+   int          i, j, k, var, max_i;
+   CDCLClause_p reason;
+   bool         redundant;
+
+   PStackReset(learnt);
+   PStackPushInt(learnt, 0); /* Room for the asserting literal */
+   do
+   {
+      assert(conflict);
+      if(solver->trace)
+      {
+         PStackPushInt(solver->ante, conflict->id);
+      }
+      if(conflict->learnt)
+      {
+         clause_bump(solver, conflict);
+      }
+      for(i = (lit == -1)? 0 : 1; i<conflict->size; i++)
+      {
+         var = LIT_VAR(conflict->lits[i]);
+         if(solver->seen[var])
+         {
+            continue;
+         }
+         if(solver->levels[var] > 0)
+         {
+            solver->seen[var] = 1;
+            var_bump(solver, var);
+            if(solver->levels[var] >= level)
+            {
+               path++;
+            }
+            else
+            {
+               PStackPushInt(learnt, conflict->lits[i]);
+            }
+         }
+         else if(solver->trace)
+         {
+            PStackPushInt(solver->ante, solver->units[var]);
+         }
+      }
+      while(!solver->seen[LIT_VAR(solver->trail[idx])])
+      {
+         idx--;
+      }
+      lit = solver->trail[idx--];
+      conflict = solver->reasons[LIT_VAR(lit)];
+      solver->seen[LIT_VAR(lit)] = 0;
+      path--;
+   }while(path > 0);
+   PStackAssignInt(learnt, 0, LIT_NEG(lit));
+
+   /* Local minimization: Drop literals implied by the others. They
+      are marked with seen = 2 first, as they still justify the
+      removal of other literals. */
+   for(i=1; i<PStackGetSP(learnt); i++)
+   {
+      var = LIT_VAR(PStackElementInt(learnt, i));
+      reason = solver->reasons[var];
+      redundant = reason != NULL;
+      for(k=1; redundant && k<reason->size; k++)
+      {
+         if(!solver->seen[LIT_VAR(reason->lits[k])] &&
+            solver->levels[LIT_VAR(reason->lits[k])] > 0)
+         {
+            redundant = false;
+         }
+      }
+      if(redundant)
+      {
+         solver->seen[var] = 2;
+         if(solver->trace)
+         {
+            PStackPushInt(solver->ante, reason->id);
+            for(k=1; k<reason->size; k++)
+            {
+               if(!solver->levels[LIT_VAR(reason->lits[k])])
+               {
+                  PStackPushInt(solver->ante,
+                                solver->units[LIT_VAR(reason->lits[k])]);
+               }
+            }
+         }
+      }
+   }
+   for(i=1, j=1; i<PStackGetSP(learnt); i++)
+   {
+      var = LIT_VAR(PStackElementInt(learnt, i));
+      if(solver->seen[var] == 1)
+      {
+         PStackAssignInt(learnt, j, PStackElementInt(learnt, i));
+         j++;
+      }
+      solver->seen[var] = 0;
+   }
+   while(PStackGetSP(learnt) > j)
+   {
+      PStackDiscardTop(learnt);
+   }
+
+   /* Find the backjump level */
+   if(PStackGetSP(learnt) > 1)
+   {
+      max_i = 1;
+      for(i=2; i<PStackGetSP(learnt); i++)
+      {
+         if(solver->levels[LIT_VAR(PStackElementInt(learnt, i))] >
+            solver->levels[LIT_VAR(PStackElementInt(learnt, max_i))])
+         {
+            max_i = i;
+         }
+      }
+      k = PStackElementInt(learnt, max_i);
+      PStackAssignInt(learnt, max_i, PStackElementInt(learnt, 1));
+      PStackAssignInt(learnt, 1, k);
+      res = solver->levels[LIT_VAR(k)];
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: compute_lbd()
+//
+//   Return the number of distinct decision levels in the learned
+//   clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Uses level stamps
+//
+/----------------------------------------------------------------------*/
+
+static int compute_lbd(CDCLSolver_p solver, PStack_p lits)
+{
+   PStackPointer i;
+   int           level, res = 0;
+
+   solver->stamp++;
+   for(i=0; i<PStackGetSP(lits); i++)
+   {
+      level = solver->levels[LIT_VAR(PStackElementInt(lits, i))];
+      if(solver->level_stamp[level] != solver->stamp)
+      {
+         solver->level_stamp[level] = solver->stamp;
+         res++;
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: analyze_final()
+//
+//   The assumption lit is false. Mark the assumptions responsible for
+//   this in solver->failed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes solver->failed
+//
+/----------------------------------------------------------------------*/
+
+static void analyze_final(CDCLSolver_p solver, int lit)
+{
+   int          i, k, var;
+   CDCLClause_p reason;
+
+   solver->failed[LIT_VAR(lit)] = 1;
+   if(!DECISION_LEVEL(solver))
+   {
+      return;
+   }
+   solver->seen[LIT_VAR(lit)] = 1;
+   for(i=solver->trail_size-1;
+       i>=PStackElementInt(solver->trail_lim, 0); i--)
+   {
+      var = LIT_VAR(solver->trail[i]);
+      if(!solver->seen[var])
+      {
+         continue;
+      }
+      reason = solver->reasons[var];
+      if(!reason)
+      {
+         solver->failed[var] = 1;
+      }
+      else
+      {
+         for(k=1; k<reason->size; k++)
+         {
+            if(solver->levels[LIT_VAR(reason->lits[k])] > 0)
+            {
+               solver->seen[LIT_VAR(reason->lits[k])] = 1;
+            }
+         }
+      }
+      solver->seen[var] = 0;
+   }
+   solver->seen[LIT_VAR(lit)] = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_lits()
+//
+//   Compare two literal codes on a PStack.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cmp_lits(const void* l1, const void* l2)
+{
+   const long lit1 = ((const IntOrP*)l1)->i_val;
+   const long lit2 = ((const IntOrP*)l2)->i_val;
+
+   return (lit1 > lit2) - (lit1 < lit2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_learnts()
+//
+//   Order learned clauses from least to most useful: Higher LBD
+//   first, then lower activity.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cmp_learnts(const void* c1, const void* c2)
+{
+   const CDCLClause_p clause1 = ((const IntOrP*)c1)->p_val;
+   const CDCLClause_p clause2 = ((const IntOrP*)c2)->p_val;
+
+   if(clause1->lbd != clause2->lbd)
+   {
+      return clause1->lbd > clause2->lbd ? -1 : 1;
+   }
+   if(clause1->activity != clause2->activity)
+   {
+      return clause1->activity < clause2->activity ? -1 : 1;
+   }
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: reduce_learnts()
+//
+//   Delete the less useful half of the learned clauses, keeping
+//   clauses with LBD <= 2 and reasons of current assignments.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void reduce_learnts(CDCLSolver_p solver)
+{
+   PStackPointer   i, j, limit;
+   CDCLClause_p    clause;
+   CDCLWatchList_p list;
+   long            k, l;
+
+   PStackSort(solver->learnts, cmp_learnts);
+   limit = PStackGetSP(solver->learnts)/2;
+   for(i=0; i<limit; i++)
+   {
+      clause = PStackElementP(solver->learnts, i);
+      if(clause->lbd > 2 &&
+         !(solver->reasons[LIT_VAR(clause->lits[0])] == clause &&
+           LIT_VALUE(solver, clause->lits[0]) == 1))
+      {
+         clause->deleted = true;
+      }
+   }
+   for(k=2; k<2*(solver->var_no+1); k++)
+   {
+      list = &(solver->watches[k]);
+      for(l=0, j=0; l<list->size; l++)
+      {
+         if(!list->watches[l].clause->deleted)
+         {
+            list->watches[j++] = list->watches[l];
+         }
+      }
+      list->size = j;
+   }
+   for(i=0, j=0; i<PStackGetSP(solver->learnts); i++)
+   {
+      clause = PStackElementP(solver->learnts, i);
+      if(clause->deleted)
+      {
+         FREE(clause);
+         solver->deleted_no++;
+      }
+      else
+      {
+         PStackAssignP(solver->learnts, j, clause);
+         j++;
+      }
+   }
+   while(PStackGetSP(solver->learnts) > j)
+   {
+      PStackDiscardTop(solver->learnts);
+   }
+   solver->reductions++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: luby()
+//
+//   Return the i-th element (starting with 0) of the Luby sequence
+//   1, 1, 2, 1, 1, 2, 4, ...
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long luby(long i)
+{
+   long size = 1, seq = 0, res = 1;
+
+   while(size < i+1)
+   {
+      seq++;
+      size = 2*size+1;
+   }
+   while(size-1 != i)
+   {
+      size = (size-1)/2;
+      seq--;
+      i = i % size;
+   }
+   while(seq--)
+   {
+      res *= 2;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: learn()
+//
+//   Backjump after a conflict at a decision level > 0 and assert the
+//   learned clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+static void learn(CDCLSolver_p solver, CDCLClause_p conflict)
+{
+   long         level = analyze(solver, conflict), id = -1;
+   CDCLClause_p clause;
+   int          lbd = compute_lbd(solver, solver->learnt_lits);
+
+   cancel_until(solver, level);
+   if(solver->trace)
+   {
+      id = trace_record(solver, -1);
+   }
+   solver->learnt_no++;
+   if(PStackGetSP(solver->learnt_lits) == 1)
+   {
+      assign(solver, PStackElementInt(solver->learnt_lits, 0), NULL, id);
+   }
+   else
+   {
+      clause = clause_alloc(solver->learnt_lits, true, id);
+      clause->lbd = lbd;
+      clause_attach(solver, clause);
+      clause_bump(solver, clause);
+      PStackPushP(solver->learnts, clause);
+      assign(solver, clause->lits[0], clause, -1);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: add_clause()
+//
+//   Add the clause in solver->add_buf (DIMACS literals) as original
+//   clause at decision level 0. Return its number.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+static long add_clause(CDCLSolver_p solver)
+{
+   long          res = solver->orig_no++, id = -1;
+   PStack_p      lits = solver->learnt_lits;
+   PStackPointer i, j;
+   int           lit, prev = -1;
+   CDCLClause_p  clause;
+
+   assert(!DECISION_LEVEL(solver));
+   if(solver->core)
+   {
+      FREE(solver->core);
+   }
+   PStackReset(lits);
+   for(i=0; i<PStackGetSP(solver->add_buf); i++)
+   {
+      lit = PStackElementInt(solver->add_buf, i);
+      grow_vars(solver, ABS(lit));
+      PStackPushInt(lits, lit_code(lit));
+   }
+   PStackReset(solver->add_buf);
+   if(solver->trace)
+   {
+      id = trace_record(solver, res);
+   }
+   if(solver->unsat)
+   {
+      return res;
+   }
+   PStackSort(lits, cmp_lits);
+
+   /* Remove duplicates and false literals, drop tautologies and
+      satisfied clauses */
+   for(i=0, j=0; i<PStackGetSP(lits); i++)
+   {
+      lit = PStackElementInt(lits, i);
+      if(lit == prev)
+      {
+         continue;
+      }
+      if(lit == LIT_NEG(prev) || LIT_VALUE(solver, lit) == 1)
+      {
+         PStackReset(solver->ante);
+         return res;
+      }
+      prev = lit;
+      if(LIT_VALUE(solver, lit) == -1)
+      {
+         if(solver->trace)
+         {
+            if(PStackEmpty(solver->ante))
+            {
+               PStackPushInt(solver->ante, id);
+            }
+            PStackPushInt(solver->ante, solver->units[LIT_VAR(lit)]);
+         }
+         continue;
+      }
+      PStackAssignInt(lits, j, lit);
+      j++;
+   }
+   while(PStackGetSP(lits) > j)
+   {
+      PStackDiscardTop(lits);
+   }
+   if(solver->trace && !PStackEmpty(solver->ante))
+   {
+      id = trace_record(solver, -1);
+   }
+
+   switch(PStackGetSP(lits))
+   {
+   case 0:
+         solver->unsat    = true;
+         solver->empty_id = id;
+         break;
+   case 1:
+         assign(solver, PStackElementInt(lits, 0), NULL, id);
+         break;
+   default:
+         clause = clause_alloc(lits, false, id);
+         clause_attach(solver, clause);
+         PStackPushP(solver->clauses, clause);
+         break;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: compute_core()
+//
+//   Mark the original clauses used in the derivation of the empty
+//   clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void compute_core(CDCLSolver_p solver)
+{
+   long     records = PStackGetSP(solver->trace_orig), id, orig, i, end;
+   char     *visited = SecureMalloc(MAX(records, 1));
+   PStack_p stack = PStackAlloc();
+
+   memset(visited, 0, MAX(records, 1));
+   solver->core = SecureMalloc(MAX(solver->orig_no, 1));
+   memset(solver->core, 0, MAX(solver->orig_no, 1));
+
+   PStackPushInt(stack, solver->empty_id);
+   while(!PStackEmpty(stack))
+   {
+      id = PStackPopInt(stack);
+      if(id < 0 || visited[id])
+      {
+         continue;
+      }
+      visited[id] = 1;
+      orig = PStackElementInt(solver->trace_orig, id);
+      if(orig >= 0)
+      {
+         solver->core[orig] = 1;
+      }
+      end = (id+1 < records)?
+         PStackElementInt(solver->trace_start, id+1):
+         PStackGetSP(solver->trace_ante);
+      for(i=PStackElementInt(solver->trace_start, id); i<end; i++)
+      {
+         PStackPushInt(stack, PStackElementInt(solver->trace_ante, i));
+      }
+   }
+   PStackFree(stack);
+   FREE(visited);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLSolverAlloc()
+//
+//   Allocate an empty solver.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+CDCLSolver_p CDCLSolverAlloc(void)
+{
+   CDCLSolver_p handle = CDCLSolverCellAlloc();
+
+   memset(handle, 0, sizeof(CDCLSolverCell));
+   handle->trail_lim   = PStackAlloc();
+   handle->clauses     = PStackAlloc();
+   handle->learnts     = PStackAlloc();
+   handle->assumptions = PStackAlloc();
+   handle->add_buf     = PStackAlloc();
+   handle->learnt_lits = PStackAlloc();
+   handle->ante        = PStackAlloc();
+   handle->trace_start = PStackAlloc();
+   handle->trace_orig  = PStackAlloc();
+   handle->trace_ante  = PStackAlloc();
+   handle->var_inc     = 1.0;
+   handle->cla_inc     = 1.0;
+   handle->empty_id    = -1;
+   handle->next_reduce = CDCL_REDUCE_FIRST;
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLSolverFree()
+//
+//   Free a solver and all its clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void CDCLSolverFree(CDCLSolver_p junk)
+{
+   CDCLClause_p clause;
+   int          i;
+
+   while(!PStackEmpty(junk->clauses))
+   {
+      clause = PStackPopP(junk->clauses);
+      FREE(clause);
+   }
+   while(!PStackEmpty(junk->learnts))
+   {
+      clause = PStackPopP(junk->learnts);
+      FREE(clause);
+   }
+   if(junk->var_cap)
+   {
+      for(i=0; i<2*junk->var_cap; i++)
+      {
+         if(junk->watches[i].watches)
+         {
+            FREE(junk->watches[i].watches);
+         }
+      }
+      FREE(junk->watches);
+      FREE(junk->vals);
+      FREE(junk->levels);
+      FREE(junk->reasons);
+      FREE(junk->units);
+      FREE(junk->activity);
+      FREE(junk->phase);
+      FREE(junk->model);
+      FREE(junk->seen);
+      FREE(junk->failed);
+      FREE(junk->level_stamp);
+      FREE(junk->heap);
+      FREE(junk->heap_pos);
+      FREE(junk->trail);
+   }
+   if(junk->core)
+   {
+      FREE(junk->core);
+   }
+   PStackFree(junk->trail_lim);
+   PStackFree(junk->clauses);
+   PStackFree(junk->learnts);
+   PStackFree(junk->assumptions);
+   PStackFree(junk->add_buf);
+   PStackFree(junk->learnt_lits);
+   PStackFree(junk->ante);
+   PStackFree(junk->trace_start);
+   PStackFree(junk->trace_orig);
+   PStackFree(junk->trace_ante);
+   CDCLSolverCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLEnableTrace()
+//
+//   Record the resolution trace needed for CDCLCoreClause(). Has to
+//   be called before any clauses are added.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void CDCLEnableTrace(CDCLSolver_p solver)
+{
+   assert(!solver->orig_no);
+   solver->trace = true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLAdd()
+//
+//   Add a literal to the current clause, or (for 0) add the clause
+//   to the solver. Return the number of the added clause (original
+//   clauses are numbered from 0) or -1.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+long CDCLAdd(CDCLSolver_p solver, int lit)
+{
+   if(lit)
+   {
+      PStackPushInt(solver->add_buf, lit);
+      return -1;
+   }
+   return add_clause(solver);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLAddLits()
+//
+//   Add the 0-terminated clause lits to the solver and return its
+//   number.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+long CDCLAddLits(CDCLSolver_p solver, int *lits)
+{
+   while(*lits)
+   {
+      CDCLAdd(solver, *lits);
+      lits++;
+   }
+   return CDCLAdd(solver, 0);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLAssume()
+//
+//   Assume lit for the next call of CDCLSolve().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+void CDCLAssume(CDCLSolver_p solver, int lit)
+{
+   assert(lit);
+   grow_vars(solver, ABS(lit));
+   PStackPushInt(solver->assumptions, lit);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLSolve()
+//
+//   Decide satisfiability of the clauses under the current
+//   assumptions (which are cleared afterwards). Give up with
+//   CDCL_UNKNOWN after decision_limit decisions (-1 for no limit).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+int CDCLSolve(CDCLSolver_p solver, long decision_limit)
+{
+   CDCLClause_p conflict;
+   long long    decision_max = decision_limit < 0 ? -1 :
+      solver->decisions + decision_limit;
+   long         restart_limit, restart_conflicts = 0, level;
+   int          res = CDCL_UNKNOWN, lit, var, i;
+
+   for(i=1; i<=solver->var_no; i++)
+   {
+      solver->failed[i] = 0;
+   }
+   restart_limit = CDCL_RESTART_BASE*luby(solver->restarts);
+   while(!solver->unsat)
+   {
+      conflict = propagate(solver);
+      if(conflict)
+      {
+         solver->conflicts++;
+         restart_conflicts++;
+         if(!DECISION_LEVEL(solver))
+         {
+            solver->unsat = true;
+            if(solver->trace)
+            {
+               PStackPushInt(solver->ante, conflict->id);
+               trace_push_units(solver, conflict, 0);
+               solver->empty_id = trace_record(solver, -1);
+            }
+            break;
+         }
+         learn(solver, conflict);
+         solver->var_inc /= CDCL_VAR_DECAY;
+         solver->cla_inc /= CDCL_CLAUSE_DECAY;
+         continue;
+      }
+      if(restart_conflicts >= restart_limit)
+      {
+         cancel_until(solver, 0);
+         solver->restarts++;
+         restart_conflicts = 0;
+         restart_limit = CDCL_RESTART_BASE*luby(solver->restarts);
+         continue;
+      }
+      if(solver->conflicts >= solver->next_reduce)
+      {
+         solver->next_reduce += CDCL_REDUCE_FIRST +
+            CDCL_REDUCE_INC*(solver->reductions+1);
+         reduce_learnts(solver);
+      }
+      /* Assumptions come first, each on its own level */
+      lit = -1;
+      while((level = DECISION_LEVEL(solver)) <
+            PStackGetSP(solver->assumptions))
+      {
+         lit = lit_code(PStackElementInt(solver->assumptions, level));
+         if(LIT_VALUE(solver, lit) == 1)
+         {
+            PStackPushInt(solver->trail_lim, solver->trail_size);
+            lit = -1;
+         }
+         else if(LIT_VALUE(solver, lit) == -1)
+         {
+            analyze_final(solver, lit);
+            res = CDCL_UNSATISFIABLE;
+            goto done;
+         }
+         else
+         {
+            break;
+         }
+      }
+      if(lit == -1)
+      {
+         if(decision_max >= 0 && solver->decisions >= decision_max)
+         {
+            res = CDCL_UNKNOWN;
+            goto done;
+         }
+         while(solver->heap_size &&
+               solver->vals[solver->heap[0]])
+         {
+            heap_extract_max(solver);
+         }
+         if(!solver->heap_size)
+         {
+            for(var=1; var<=solver->var_no; var++)
+            {
+               solver->model[var] = solver->vals[var];
+            }
+            res = CDCL_SATISFIABLE;
+            goto done;
+         }
+         var = heap_extract_max(solver);
+         lit = 2*var + solver->phase[var];
+         solver->decisions++;
+      }
+      PStackPushInt(solver->trail_lim, solver->trail_size);
+      assign(solver, lit, NULL, -1);
+   }
+   res = CDCL_UNSATISFIABLE;
+done:
+   cancel_until(solver, 0);
+   PStackReset(solver->assumptions);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLDeref()
+//
+//   Return the value of lit in the model found by the last
+//   successful call of CDCLSolve(): 1 (true), -1 (false) or 0
+//   (unknown variable).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+int CDCLDeref(CDCLSolver_p solver, int lit)
+{
+   int var = ABS(lit);
+
+   if(var > solver->var_no)
+   {
+      return 0;
+   }
+   return lit > 0 ? solver->model[var] : -solver->model[var];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLFailedAssumption()
+//
+//   Return true if lit was an assumption responsible for the last
+//   CDCL_UNSATISFIABLE result.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool CDCLFailedAssumption(CDCLSolver_p solver, int lit)
+{
+   int var = ABS(lit);
+
+   return var <= solver->var_no && solver->failed[var];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLCoreClause()
+//
+//   Return true if the original clause with the given number is part
+//   of the unsatisfiable core found. Requires tracing and a
+//   CDCL_UNSATISFIABLE result without assumptions.
+//
+// Global Variables: -
+//
+// Side Effects    : Computes the core on the first call
+//
+/----------------------------------------------------------------------*/
+
+bool CDCLCoreClause(CDCLSolver_p solver, long clause)
+{
+   assert(solver->trace);
+   assert(clause >= 0 && clause < solver->orig_no);
+
+   if(!solver->unsat)
+   {
+      return false;
+   }
+   if(!solver->core)
+   {
+      compute_core(solver);
+   }
+   return solver->core[clause];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLParseDimacs()
+//
+//   Add the clauses of a DIMACS CNF file to the solver. Return the
+//   number of clauses read. Besides the standard 'c' lines, lines
+//   starting with '%' or '#' (as written by eground) are skipped as
+//   comments. Literals are read with getc(), as fscanf() per literal
+//   dominates the run time on large, easy instances.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, changes the solver state
+//
+/----------------------------------------------------------------------*/
+
+long CDCLParseDimacs(CDCLSolver_p solver, FILE* in)
+{
+   long res = 0;
+   int  c, lit, vars;
+   long clauses;
+   bool neg;
+
+   while((c = getc(in)) != EOF)
+   {
+      if(isspace(c))
+      {
+         continue;
+      }
+      if(c == 'c' || c == '%' || c == '#')
+      {
+         while((c = getc(in)) != EOF && c != '\n')
+         {
+            /* Skip comment */
+         }
+         continue;
+      }
+      if(c == 'p')
+      {
+         if(fscanf(in, " cnf %d %ld", &vars, &clauses) != 2)
+         {
+            Error("Malformed DIMACS problem line", SYNTAX_ERROR);
+         }
+         grow_vars(solver, vars);
+         continue;
+      }
+      neg = (c == '-');
+      if(neg)
+      {
+         c = getc(in);
+      }
+      if(!isdigit(c))
+      {
+         Error("Literal expected in DIMACS input", SYNTAX_ERROR);
+      }
+      for(lit = 0; isdigit(c); c = getc(in))
+      {
+         lit = 10*lit + (c-'0');
+      }
+      if(c != EOF)
+      {
+         ungetc(c, in);
+      }
+      if(neg)
+      {
+         lit = -lit;
+      }
+      if(!lit)
+      {
+         res++;
+      }
+      CDCLAdd(solver, lit);
+   }
+   if(!PStackEmpty(solver->add_buf))
+   {
+      CDCLAdd(solver, 0);
+      res++;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CDCLSolverPrintStatistics()
+//
+//   Print statistics about the search.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void CDCLSolverPrintStatistics(FILE* out, CDCLSolver_p solver)
+{
+   fprintf(out,
+           "# CDCL variables                     : %d\n"
+           "# CDCL original clauses              : %ld\n"
+           "# CDCL decisions                     : %lld\n"
+           "# CDCL propagations                  : %lld\n"
+           "# CDCL conflicts                     : %lld\n"
+           "# CDCL restarts                      : %ld\n"
+           "# CDCL learned clauses               : %ld\n"
+           "# CDCL learned clauses deleted       : %ld (%ld reductions)\n",
+           solver->var_no,
+           solver->orig_no,
+           solver->decisions,
+           solver->propagations,
+           solver->conflicts,
+           solver->restarts,
+           solver->learnt_no,
+           solver->deleted_no,
+           solver->reductions);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,169 @@
+/*-----------------------------------------------------------------------
+
+File  : cpr_cdcl.h
+
+Author: The E developers
+
+Contents
+
+  A conflict-driven clause learning SAT solver: Two-watched-literal
+  unit propagation (with blocking literals), first-UIP conflict
+  analysis with local clause minimization, EVSIDS decision heuristic
+  with phase saving, Luby restarts and periodic reduction of learned
+  clauses by literal block distance.
+
+  The interface follows PicoSAT so that the solver can replace it
+  for ground checks: Literals are DIMACS integers, clauses are added
+  incrementally (also between calls), assumptions hold for the next
+  call only, and an optional resolution trace allows the extraction
+  of an unsatisfiable core of the original clauses.
+
+  The solver only depends on the BASICS library.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 00:41:26 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CPR_CDCL
+
+#define CPR_CDCL
+
+#include <clb_pstacks.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Results, compatible with PicoSAT */
+
+#define CDCL_UNKNOWN        0
+#define CDCL_SATISFIABLE    10
+#define CDCL_UNSATISFIABLE  20
+
+#define CDCL_RESTART_BASE   100   /* Conflicts per Luby unit */
+#define CDCL_REDUCE_FIRST   2000  /* Conflicts before first reduction */
+#define CDCL_REDUCE_INC     300   /* Growth of the reduction interval */
+#define CDCL_VAR_DECAY      0.95
+#define CDCL_CLAUSE_DECAY   0.999
+
+/* Literals are coded as 2*var for positive and 2*var+1 for negative
+   literals. The implied literal of a reason clause is lits[0], the
+   watched literals are lits[0] and lits[1]. */
+
+typedef struct cdcl_clause_cell
+{
+   long   id;       /* Trace record, -1 if not tracing */
+   int    size;
+   int    lbd;      /* Literal block distance when learned */
+   bool   learnt;
+   bool   deleted;
+   double activity;
+   int    lits[];
+}CDCLClauseCell, *CDCLClause_p;
+
+typedef struct cdcl_watch_cell
+{
+   CDCLClause_p clause;
+   int          blocker;  /* Some other literal of the clause */
+}CDCLWatchCell;
+
+typedef struct cdcl_watch_list_cell
+{
+   CDCLWatchCell *watches;
+   long          size;
+   long          capacity;
+}CDCLWatchListCell, *CDCLWatchList_p;
+
+typedef struct cdcl_solver_cell
+{
+   int             var_no;      /* Variables are 1..var_no */
+   int             var_cap;
+   signed char     *vals;       /* Per variable: 1, -1, or 0 (open) */
+   int             *levels;
+   CDCLClause_p    *reasons;
+   long            *units;      /* Trace records of level 0 values */
+   double          *activity;
+   signed char     *phase;      /* Saved polarity, 1 for negative */
+   signed char     *model;
+   signed char     *seen;       /* Scratch for conflict analysis */
+   signed char     *failed;     /* Failed assumptions of last call */
+   long            *level_stamp;
+   long            stamp;
+   CDCLWatchList_p watches;     /* Indexed by literal code */
+   int             *heap;       /* Open variables by activity... */
+   int             *heap_pos;   /* ...and their positions, or -1 */
+   int             heap_size;
+   int             *trail;
+   int             trail_size;
+   int             prop_head;
+   PStack_p        trail_lim;   /* Trail size at each decision */
+   PStack_p        clauses;     /* Original clauses (non-unit) */
+   PStack_p        learnts;
+   PStack_p        assumptions; /* DIMACS literals for the next call */
+   PStack_p        add_buf;     /* Clause being added with CDCLAdd() */
+   PStack_p        learnt_lits; /* Scratch */
+   PStack_p        ante;        /* Scratch for trace records */
+   double          var_inc;
+   double          cla_inc;
+   bool            unsat;       /* Empty clause derived */
+   long            orig_no;     /* Original clauses added */
+   /* Resolution trace for unsatisfiable cores */
+   bool            trace;
+   PStack_p        trace_start; /* Per record: first antecedent... */
+   PStack_p        trace_orig;  /* ...and original clause or -1 */
+   PStack_p        trace_ante;
+   long            empty_id;
+   char            *core;       /* Per original clause, or NULL */
+   /* Search control and statistics */
+   long            next_reduce;
+   long long       conflicts;
+   long long       decisions;
+   long long       propagations;
+   long            restarts;
+   long            reductions;
+   long            learnt_no;
+   long            deleted_no;
+}CDCLSolverCell, *CDCLSolver_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define CDCLSolverCellAlloc() \
+   (CDCLSolverCell*)SizeMalloc(sizeof(CDCLSolverCell))
+#define CDCLSolverCellFree(junk) SizeFree(junk, sizeof(CDCLSolverCell))
+
+CDCLSolver_p CDCLSolverAlloc(void);
+void         CDCLSolverFree(CDCLSolver_p junk);
+void         CDCLEnableTrace(CDCLSolver_p solver);
+
+#define      CDCLVarNo(solver)           ((solver)->var_no)
+#define      CDCLOriginalClauses(solver) ((solver)->orig_no)
+
+long         CDCLAdd(CDCLSolver_p solver, int lit);
+long         CDCLAddLits(CDCLSolver_p solver, int *lits);
+void         CDCLAssume(CDCLSolver_p solver, int lit);
+int          CDCLSolve(CDCLSolver_p solver, long decision_limit);
+int          CDCLDeref(CDCLSolver_p solver, int lit);
+bool         CDCLFailedAssumption(CDCLSolver_p solver, int lit);
+bool         CDCLCoreClause(CDCLSolver_p solver, long clause);
+
+long         CDCLParseDimacs(CDCLSolver_p solver, FILE* in);
+void         CDCLSolverPrintStatistics(FILE* out, CDCLSolver_p solver);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Apr  7 16:14:02 MET DST 2000
     New
+<2> Sun Oct 18 23:48:10 CEST 2026
+    Parallel checking, throughput report
 
 -----------------------------------------------------------------------*/
 
@@ -47,7 +49,8 @@ typedef enum
    OPT_OUTPUTLEVEL,
    OPT_PROVERTYPE,
    OPT_EXECUTABLE,
-   OPT_TIME_LIMIT
+   OPT_TIME_LIMIT,
+   OPT_WORKERS
 }OptionCodes;
 
 
@@ -117,6 +120,15 @@ OptCell opts[] =
     "Limit the CPU time prover may spend on a single step. Default is"
     " 10 seconds."},
 
+   {OPT_WORKERS,
+    'j', "workers",
+    ReqArg, NULL,
+    "Check up to the given number of steps at the same time. Every"
+    " step is still checked by a separate run of the external prover,"
+    " only these runs overlap. The verdicts are the same as for"
+    " sequential checking (the default, equivalent to 1), but clause"
+    " idents in verbose output may differ."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -128,6 +140,7 @@ long       time_limit  = 10;
 char       *executable = NULL;
 ProverType prover      = EProver;
 bool       app_encode  = false;
+int        workers     = 1;
 
 
 /*---------------------------------------------------------------------*/
@@ -148,6 +161,7 @@ int main(int argc, char* argv[])
    Scanner_p   in;
    PCLProt_p   prot;
    long        steps,res,unchecked;
+   long long   start, time_used;
    int         i;
 
    assert(argv[0]);
@@ -183,7 +197,15 @@ int main(int argc, char* argv[])
    }
    VERBOUT2("PCL input read\n");
 
-   res = PCLProtCheck(prot,prover,executable,time_limit, &unchecked);
+   start = GetUSecTime();
+   res = PCLProtCheckParallel(prot,prover,executable,time_limit,workers,
+                              &unchecked);
+   time_used = MAX(GetUSecTime()-start, 1);
+
+   fprintf(GlobalOut,
+           "# Checked %ld steps in %.3f s (%.1f steps/s, %d worker%s)\n",
+           steps, time_used/1000000.0, steps*1000000.0/time_used,
+           workers, workers==1?"":"s");
 
    fprintf(GlobalOut,
          "# Successfully checked %ld of %ld steps (%ld unchecked): ",
@@ -298,6 +320,14 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_TIME_LIMIT:
        time_limit = CLStateGetIntArg(handle, arg);
        break;
+      case OPT_WORKERS:
+       workers = CLStateGetIntArg(handle, arg);
+       if(workers < 1)
+       {
+          Error("Option -j (--workers) requires a positive argument",
+                USAGE_ERROR);
+       }
+       break;
       default:
     assert(false);
     break;
@@ -101,6 +101,7 @@ typedef enum
    OPT_FUN_MEDIUM_LIMIT,
    OPT_FUN_LARGE_LIMIT,
    OPT_MERGED_CLASSIFICATION,
+   OPT_FEATURE_WORKERS,
 }OptionCodes;
 
 
@@ -470,6 +471,13 @@ OptCell opts[] =
     "Perform classification that merges formula and clause properties. "
     "The required argument is the timeout given to clausification (seconds)."},
 
+   {OPT_FEATURE_WORKERS,
+    '\0', "feature-workers",
+    ReqArg, NULL,
+    "Use up to <arg> forked worker processes to compute the features "
+    "of very large clause sets. The result does not depend on <arg>. "
+    "Use 0 for the number of available cores."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -488,7 +496,8 @@ bool tptp_header      = false,
    new_cnf          = true,
    parse_features   = false,
    app_encode       = false;
-int cnf_timeout = -1;
+int cnf_timeout = -1,
+   feature_workers = 1;
 long eqdef_maxclauses = DEFAULT_EQDEF_MAXCLAUSES,
    miniscope_limit  = 1000;
 long eqdef_incrlimit  = DEFAULT_EQDEF_INCRLIMIT;
@@ -899,8 +908,10 @@ int main(int argc, char* argv[])
             }
             if(!specsig_classify)
             {
-               SpecFeaturesCompute(&features, fstate->axioms, fstate->f_axioms,
-                                   fstate->f_ax_archive, fstate->terms);
+               SpecFeaturesComputeParallel(&features, fstate->axioms,
+                                           fstate->f_axioms,
+                                           fstate->f_ax_archive,
+                                           fstate->terms, feature_workers);
                features.order = raw_features.order;
                features.goal_order = raw_features.conj_order;
                features.num_of_definitions = raw_features.num_of_definitions;
@@ -1157,6 +1168,13 @@ CLState_p process_options(int argc, char* argv[], SpecLimits_p limits)
       case OPT_MERGED_CLASSIFICATION:
             cnf_timeout = CLStateGetIntArg(handle, arg);
             break;
+      case OPT_FEATURE_WORKERS:
+            feature_workers = CLStateGetIntArgCheckRange(handle, arg, 0, INT_MAX);
+            if(!feature_workers)
+            {
+               feature_workers = GetCoreNumber();
+            }
+            break;
       default:
             assert(false);
             break;
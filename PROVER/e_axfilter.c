@@ -19,6 +19,8 @@ Changes
 
 <1> Mon Feb 21 13:24:04 CET 2011
     New (but borrowing from LTB runner)
+<2> Mon Oct 19 02:14:37 CEST 2026
+    One-pass evaluation of all filters, parallel output
 
 -----------------------------------------------------------------------*/
 
@@ -52,6 +54,8 @@ typedef enum
    OPT_SEED_SUBSAMPLE,
    OPT_SEED_METHODS,
    OPT_DUMP_FILTER,
+   OPT_ONE_PASS,
+   OPT_WORKERS,
    OPT_PRINT_STATISTICS,
    OPT_SILENT,
    OPT_OUTPUTLEVEL,
@@ -73,6 +77,21 @@ typedef enum
 }SubSampleMethod;
 
 
+/* Everything needed to write the result files of several filters in
+ * parallel. */
+
+typedef struct filter_output_cell
+{
+   StructFOFSpec_p ctrl;
+   PStack_p        filters;   /* AxFilter_p */
+   PStack_p        filenames; /* DStr_p */
+   PStack_p        clauses;   /* PStack_p of selected clauses... */
+   PStack_p        formulas;  /* ...and formulas for each filter */
+   char*           corename;
+   char*           desc;
+}FilterOutputCell, *FilterOutput_p;
+
+
 
 /*---------------------------------------------------------------------*/
 /*                        Global Variables                             */
@@ -165,6 +184,28 @@ OptCell opts[] =
     NoArg, NULL,
      "Print the filter definition in force."},
 
+   {OPT_ONE_PASS,
+    '\0', "one-pass",
+    NoArg, NULL,
+    "Compute the selections of all filters before writing any output. "
+    "GSinE filters that agree on the generality measure and on the "
+    "treatment of implications and definitions then share a single "
+    "traversal of the axioms (and the generality and D-relation "
+    "computation based on it). The result files are the same as "
+    "without this option."},
+
+   {OPT_WORKERS,
+    'j', "workers",
+    ReqArg, NULL,
+    "Write the result files of the different filters with up to the "
+    "given number of parallel processes. Implies --one-pass."},
+
+   {OPT_PRINT_STATISTICS,
+    '\0', "print-statistics",
+    NoArg, NULL,
+    "Print the number of filters and the time spent on selection and "
+    "output in --one-pass mode."},
+
    {OPT_LOP_PARSE,
     '\0', "lop-in",
     NoArg, NULL,
@@ -245,6 +286,10 @@ char*    seedstr      = NULL;
 SubSampleMethod subsample   = SubSNone;
 long            sample_size = LONG_MAX;
 
+bool     one_pass         = false,
+         print_statistics = false;
+int      workers          = 1;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -258,6 +303,64 @@ void print_help(FILE* out);
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: filter_file_name()
+//
+//   Append the name of the result file for filter on the problem with
+//   the given core name to filename.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void filter_file_name(DStr_p filename, char* corename,
+                      AxFilter_p filter)
+{
+   DStrAppendStr(filename, corename);
+   DStrAppendChar(filename, '_');
+   DStrAppendStr(filename, filter->name);
+   DStrAppendStr(filename, ".p");
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: write_filter_result()
+//
+//   Write the clauses and formulas selected by filter into the named
+//   file.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O (writes result file)
+//
+/----------------------------------------------------------------------*/
+
+void write_filter_result(StructFOFSpec_p ctrl,
+                         AxFilter_p filter,
+                         char* filename,
+                         char* corename, char* desc,
+                         PStack_p clauses, PStack_p formulas)
+{
+   FILE *fp;
+
+   fp = fopen(filename, "w");
+   fprintf(fp, "%% Filter %s on file %s\n",
+           filter->name, corename);
+   if(desc)
+   {
+      fprintf(fp, "%s", desc);
+   }
+   SigPrintTypeDeclsTSTP(fp, ctrl->terms->sig);
+   PStackClausePrintTSTP(fp, clauses);
+   PStackFormulaPrintTSTP(fp, formulas);
+   fclose(fp);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: filter_problem()
@@ -279,12 +382,8 @@ void filter_problem(StructFOFSpec_p ctrl,
 {
    DStr_p   filename = DStrAlloc();
    PStack_p formulas, clauses;
-   FILE     *fp;
 
-   DStrAppendStr(filename, corename);
-   DStrAppendChar(filename, '_');
-   DStrAppendStr(filename, filter->name);
-   DStrAppendStr(filename, ".p");
+   filter_file_name(filename, corename, filter);
 
    formulas = PStackAlloc();
    clauses  = PStackAlloc();
@@ -298,30 +397,127 @@ void filter_problem(StructFOFSpec_p ctrl,
            filter->name,
            DStrView(filename));
 
-   fp = fopen(DStrView(filename), "w");
-   fprintf(fp, "%% Filter %s on file %s\n",
-           filter->name, corename);
-   if(desc)
-   {
-      fprintf(fp, "%s", desc);
-   }
-   SigPrintTypeDeclsTSTP(fp, ctrl->terms->sig);
-   PStackClausePrintTSTP(fp, clauses);
-   PStackFormulaPrintTSTP(fp, formulas);
-   fclose(fp);
+   write_filter_result(ctrl, filter, DStrView(filename), corename, desc,
+                       clauses, formulas);
 
    PStackFree(clauses);
    PStackFree(formulas);
    DStrFree(filename);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: write_filter_output()
+//
+//   ForkMapLong() callback: Write the result file of the idx-th
+//   filter described by data (a FilterOutput_p).
+//
+// Global Variables: -
+//
+// Side Effects    : I/O (writes result file)
+//
+/----------------------------------------------------------------------*/
+
+long write_filter_output(void* data, long idx)
+{
+   FilterOutput_p output = data;
+
+   write_filter_result(output->ctrl,
+                       PStackElementP(output->filters, idx),
+                       DStrView(PStackElementP(output->filenames, idx)),
+                       output->corename,
+                       output->desc,
+                       PStackElementP(output->clauses, idx),
+                       PStackElementP(output->formulas, idx));
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: filter_problem_one_pass()
+//
+//   Apply all filters on the stack to the problem at once (sharing
+//   the traversal of the axioms between compatible filters), then
+//   write the result files with up to workers processes.
+//
+// Global Variables: workers, print_statistics
+//
+// Side Effects    : I/O (writes result files), Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void filter_problem_one_pass(StructFOFSpec_p ctrl,
+                             PStack_p filters,
+                             char* corename, char* desc)
+{
+   FilterOutputCell output;
+   PStackPointer    i, size = PStackGetSP(filters);
+   DStr_p           filename;
+   long             *results;
+   long long        start, selected;
+
+   output.ctrl      = ctrl;
+   output.filters   = filters;
+   output.filenames = PStackAlloc();
+   output.clauses   = PStackAlloc();
+   output.formulas  = PStackAlloc();
+   output.corename  = corename;
+   output.desc      = desc;
+
+   for(i=0; i<size; i++)
+   {
+      filename = DStrAlloc();
+      filter_file_name(filename, corename, PStackElementP(filters, i));
+      PStackPushP(output.filenames, filename);
+      PStackPushP(output.clauses, PStackAlloc());
+      PStackPushP(output.formulas, PStackAlloc());
+   }
+
+   start = GetUSecTime();
+   StructFOFSpecGetProblems(ctrl, filters, output.clauses, output.formulas);
+   selected = GetUSecTime();
+
+   for(i=0; i<size; i++)
+   {
+      fprintf(GlobalOut, "# Filter: %s goes into file %s\n",
+              ((AxFilter_p)PStackElementP(filters, i))->name,
+              DStrView(PStackElementP(output.filenames, i)));
+   }
+   fflush(GlobalOut);
+
+   results = SizeMalloc((size+1)*sizeof(long));
+   ForkMapLong(size, workers, write_filter_output, &output, results);
+   SizeFree(results, (size+1)*sizeof(long));
+
+   if(print_statistics)
+   {
+      fprintf(GlobalOut, "# Filters            : %ld\n", (long)size);
+      fprintf(GlobalOut, "# Selection time     : %.3f s\n",
+              (selected-start)/1000000.0);
+      fprintf(GlobalOut, "# Output time        : %.3f s\n",
+              (GetUSecTime()-selected)/1000000.0);
+   }
+
+   for(i=0; i<size; i++)
+   {
+      DStrFree(PStackElementP(output.filenames, i));
+      PStackFree(PStackElementP(output.clauses, i));
+      PStackFree(PStackElementP(output.formulas, i));
+   }
+   PStackFree(output.filenames);
+   PStackFree(output.clauses);
+   PStackFree(output.formulas);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: all_filters_problem()
 //
 //   Apply all filters to problems.
 //
-// Global Variables:
+// Global Variables: one_pass
 //
 // Side Effects    : Writes result files
 //
@@ -333,8 +529,23 @@ void all_filters_problem(StructFOFSpec_p ctrl,
                          bool hypo_filter_only,
                          char *desc)
 {
-   int i;
+   int      i;
+   PStack_p active;
 
+   if(one_pass)
+   {
+      active = PStackAlloc();
+      for(i=0; i<AxFilterSetElements(filters); i++)
+      {
+         if(!hypo_filter_only || AxFilterSetGetFilter(filters,i)->use_hypotheses)
+         {
+            PStackPushP(active, AxFilterSetGetFilter(filters,i));
+         }
+      }
+      filter_problem_one_pass(ctrl, active, corename, desc);
+      PStackFree(active);
+      return;
+   }
    for(i=0; i<AxFilterSetElements(filters); i++)
    {
       /* SigPrint(stdout,ctrl->sig); */
@@ -935,6 +1146,21 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_FILTER:
             filtername = arg;
             break;
+      case OPT_ONE_PASS:
+            one_pass = true;
+            break;
+      case OPT_WORKERS:
+            workers = CLStateGetIntArg(handle, arg);
+            if(workers < 1)
+            {
+               Error("Option -j (--workers) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            one_pass = true;
+            break;
+      case OPT_PRINT_STATISTICS:
+            print_statistics = true;
+            break;
       case OPT_SEED_METHODS:
             seed_all = false;
             CheckOptionLetterString(arg, "lda", "-m (--seed-methods)");
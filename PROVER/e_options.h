@@ -153,6 +153,8 @@ typedef enum
    OPT_FORWARD_CSR,
    OPT_FORWARD_CSR_AGGRESSIVE,
    OPT_BACKWARD_CSR,
+   OPT_GROUND_CC,
+   OPT_NF_CACHE,
    OPT_RULES_GENERAL,
    OPT_FORWARD_DEMOD,
    OPT_DEMOD_LAMBDA,
@@ -165,10 +167,16 @@ typedef enum
    OPT_SAT_NORMCONST,
    OPT_SAT_NORMALIZE,
    OPT_SAT_DEC_LIMIT,
+   OPT_SAT_SOLVER,
    OPT_WATCHLIST,
    OPT_STATIC_WATCHLIST,
    OPT_WATCHLIST_NO_SIMPLIFY,
+   OPT_CHECKPOINT,
+   OPT_RESTORE_CHECKPOINT,
+   OPT_PERF_TRACE,
+   OPT_PERF_TRACE_FORMAT,
    OPT_FW_SUMBSUMPTION_AGGRESSIVE,
+   OPT_NO_BATCH_EVALUATION,
    OPT_NO_INDEXED_SUBSUMPTION,
    OPT_FVINDEX_STYLE,
    OPT_FVINDEX_FEATURETYPES,
@@ -208,6 +216,8 @@ typedef enum
    OPT_PRED_ELIM_IGNORE_CONJ_SYMS,
    OPT_PRED_ELIM_MAX_OCCS,
    OPT_PRED_ELIM_TOLERANCE,
+   OPT_ELIM_WORKERS,
+   OPT_FEATURE_WORKERS,
    OPT_LIFT_LAMBDAS,
    OPT_ETA_NORMALIZE,
    OPT_HO_ORDER_KIND,
@@ -230,6 +240,7 @@ typedef enum
    OPT_FIXPOINT_ORACLE,
    OPT_MAX_UNIFIERS,
    OPT_MAX_UNIF_STEPS,
+   OPT_CSU_CACHE_MEM,
    OPT_CNF_TIMEOUT_PORTION,
    OPT_PREINSTANTIATE_INDUCTION,
    OPT_SERIALIZE_SCHEDULE,
@@ -1222,6 +1233,31 @@ OptCell opts[] =
     "Apply contextual simplify-reflect with the given clause to "
     "processed clauses."},
 
+   {OPT_GROUND_CC,
+    '\0', "ground-congruence-closure",
+    NoArg, NULL,
+    "Maintain the congruence closure of the processed ground positive "
+    "unit clauses. Ground negative literals of new clauses whose sides "
+    "are equal under these units are deleted, and clauses with such a "
+    "positive ground literal are discarded if all units needed to show "
+    "the equality are smaller than the literal. This subsumes ground "
+    "simplify-reflect with units that are not yet fully interreduced. "
+    "Discarding such redundant clauses changes the search and can save "
+    "time, while deleting the negative literals alone is little faster "
+    "than rewriting them. Ignored for higher-order problems."},
+
+   {OPT_NF_CACHE,
+    '\0', "nf-cache",
+    OptArg, "100000",
+    "Keep track of the top symbols of the processed demodulators, so "
+    "that terms in normal form only have to be rewritten again if a "
+    "new demodulator can apply to one of their symbols. In addition, "
+    "remember the normal forms of up to the given number of clause "
+    "terms and keep them (with their rewrite chains) alive across "
+    "garbage collections, so that regenerated terms do not have to be "
+    "normalized from scratch. A value of 0 only enables the symbol "
+    "check. Ignored for higher-order problems."},
+
    {OPT_RULES_GENERAL,
     'g', "prefer-general-demodulators",
     NoArg, NULL,
@@ -1287,6 +1323,14 @@ OptCell opts[] =
     "If the option is not given, the built-in value is 10000. Use -1 to "
     "allow unlimited decision."},
 
+   {OPT_SAT_SOLVER,
+    '\0', "satcheck-solver",
+    ReqArg, NULL,
+    "Select the SAT solver used for ground checks. The default is "
+    "'PicoSAT'. 'CDCL' selects E's experimental built-in conflict-driven "
+    "clause learning solver, which lacks recursive clause minimisation "
+    "and is several times slower than PicoSAT on hard instances."},
+
    {OPT_SAT_NORMCONST,
     '\0', "satcheck-normalize-const",
     NoArg, NULL,
@@ -1315,7 +1359,10 @@ OptCell opts[] =
     " Use the argument " WATCHLIST_INLINE_QSTRING " (or no argument)"
     " and the special clause type "
     "'watchlist' if you want to put watchlist clauses into the normal input"
-    " stream. This is only supported for TPTP input formats."},
+    " stream. This is only supported for TPTP input formats. The option"
+    " can be given more than once, the clauses from all watchlists are"
+    " merged into a single watchlist, and statistics are reported for"
+    " each file separately."},
 
    {OPT_STATIC_WATCHLIST,
     '\0', "static-watchlist",
@@ -1332,6 +1379,47 @@ OptCell opts[] =
     "to the current processed clause set and certain simplifications. "
     "This option disables simplification for the watchlist."},
 
+   {OPT_CHECKPOINT,
+    '\0', "checkpoint",
+    ReqArg, NULL,
+    "If the saturation loop stops because of a resource limit (without "
+    "a proof or saturation), write its state (processed and unprocessed "
+    "clauses, statistics, selection heuristic position) to the given "
+    "file. The search can be continued later with "
+    "--restore-checkpoint. In automatic scheduling mode, every "
+    "strategy writes its own file, named <file>.<preprocessing "
+    "slot>.<heuristic>. Only supported for untyped first-order "
+    "problems."},
+
+   {OPT_RESTORE_CHECKPOINT,
+    '\0', "restore-checkpoint",
+    ReqArg, NULL,
+    "Continue the search from a checkpoint written by --checkpoint "
+    "instead of starting from the initial clauses. The prover must be "
+    "run on the same problem with the same preprocessing options and "
+    "search heuristic as the run that wrote the checkpoint. In "
+    "automatic scheduling mode, every strategy continues from its own "
+    "file (see --checkpoint), strategies without one start from "
+    "scratch. Time and other limits apply to the resumed run only. "
+    "Proof objects show restored clauses as introduced(checkpoint)."},
+
+   {OPT_PERF_TRACE,
+    '\0', "perf-trace",
+    ReqArg, NULL,
+    "After each iteration of the main loop, write the number of calls "
+    "and the time spent in each instrumented phase of the prover "
+    "(forward contraction, backward simplification, generation, "
+    "index operations, ...) during that iteration to the given file. "
+    "The format is selected with --perf-trace-format."},
+
+   {OPT_PERF_TRACE_FORMAT,
+    '\0', "perf-trace-format",
+    ReqArg, NULL,
+    "Select the format of the --perf-trace output. 'json' (the "
+    "default) writes one JSON object per iteration and line, "
+    "'chrome' writes the trace event format that can be loaded into "
+    "Chrome's about:tracing or Perfetto."},
+
    {OPT_FW_SUMBSUMPTION_AGGRESSIVE,
     '\0', "fw-subsumption-aggressive",
     NoArg, NULL,
@@ -1339,6 +1427,17 @@ OptCell opts[] =
     "are evaluated. This is particularly useful if heuristic evaluation is "
     "very expensive, e.g. via externally connected neural networks."},
 
+   {OPT_NO_BATCH_EVALUATION,
+    '\0', "no-batch-evaluation",
+    NoArg, NULL,
+    "Evaluate newly generated clauses one at a time. By default, weight "
+    "functions that are weighted symbol counts (e.g. Clauseweight, "
+    "Refinedweight and the symbol-based weights like "
+    "ConjectureRelativeSymbolWeight) evaluate all clauses generated "
+    "in one step together from symbol counts computed only once. The "
+    "evaluations are identical, this option is only useful for "
+    "performance comparisons."},
+
    {OPT_NO_INDEXED_SUBSUMPTION,
     '\0', "conventional-subsumption",
     NoArg, NULL,
@@ -1395,7 +1494,10 @@ OptCell opts[] =
     "\"NoIndex\" will disable paramodulation indexing. For a list "
     "of the other values run '" NAME " --pm-index=none'. FPX functions "
     "will use a fingerprint of X positions, the letters disambiguate "
-    "between different fingerprints with the same sample size."},
+    "between different fingerprints with the same sample size. "
+    "The special value \"PathIndex\" selects a path index that only "
+    "retrieves instances of the (linear parts of the) rule's left hand "
+    "side (for first-order problems, FP7 is used otherwise)."},
 
    {OPT_PM_FROM_INDEX,
     '\0', "pm-from-index",
@@ -1420,7 +1522,10 @@ OptCell opts[] =
    {OPT_FP_INDEX,
     '\0', "fp-index",
     OptArg, "FP7",
-    "Select fingerprint function for all fingerprint indices. See above."},
+    "Select fingerprint function for all fingerprint indices. See above. "
+    "\"FPAdapt\" selects adaptive indices that sample up to 15 positions, "
+    "but only split a leaf on the next position once it holds more than "
+    "16 terms. Their leaf occupancy is reported with the statistics."},
 
    {OPT_FP_NO_SIZECONSTR,
     '\0', "fp-no-size-constr",
@@ -1678,6 +1783,16 @@ OptCell opts[] =
     "Maximal number of variable bindings that can "
     "be done in one single call to copmuting the next unifier."},
 
+    {OPT_CSU_CACHE_MEM,
+    '\0', "csu-cache-mem",
+    ReqArg, NULL,
+    "Experimental: Memory (in MB) for caching the unifiers found for "
+    "pairs of terms in multi-unifier mode. Cached unifiers are replayed "
+    "(with the variables introduced by unification renamed) when the "
+    "same pair is unified again. If more unifiers are needed than have "
+    "been cached, the search is redone. 0 (the default) disables the "
+    "cache."},
+
     {OPT_CNF_TIMEOUT_PORTION,
     '\0', "classification-timeout-portion",
     ReqArg, NULL,
@@ -1723,6 +1838,23 @@ OptCell opts[] =
     '\0', "pred-elim-ignore-conj-syms", ReqArg, NULL,
      "Disable eliminating symbols that occur in the conjecture."},
 
+    {OPT_ELIM_WORKERS,
+    '\0', "elim-workers", ReqArg, NULL,
+     "Use up to <arg> forked worker processes to check independent "
+     "candidates for blocked clause elimination and predicate "
+     "elimination concurrently. The result is deterministic for a "
+     "given value of <arg>, but may differ from the sequential (default) "
+     "setting of 1, since independent eliminations are evaluated in "
+     "batches. Use 0 for the number of available cores."},
+
+    {OPT_FEATURE_WORKERS,
+    '\0', "feature-workers", ReqArg, NULL,
+     "Use up to <arg> forked worker processes to compute the problem "
+     "features for automatic strategy selection. Only very large "
+     "clause sets are split, and the result is the same as for "
+     "the sequential (default) setting of 1. Use 0 for the number of "
+     "available cores."},
+
 
 
    {OPT_NOOPT,
@@ -18,6 +18,8 @@ Changes
 
 <1> Thu May  1 20:40:24 CEST 2003
     New
+<2> Mon Oct 19 00:41:26 CEST 2026
+    Decide DIMACS input with the CDCL solver
 
 -----------------------------------------------------------------------*/
 
@@ -25,6 +27,7 @@ Changes
 #include <cio_output.h>
 #include <cio_signals.h>
 #include <cpr_dpll.h>
+#include <cpr_cdcl.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -44,6 +47,8 @@ typedef enum
    OPT_OUTPUTLEVEL,
    OPT_TPTP_PARSE,
    OPT_DIMACS_PRINT,
+   OPT_DIMACS_PARSE,
+   OPT_DECISION_LIMIT,
    OPT_MEM_LIMIT,
    OPT_CPU_LIMIT,
    OPT_SOFTCPU_LIMIT,
@@ -103,6 +108,20 @@ OptCell opts[] =
     "Print output in the DIMACS format suitable for many propositional "
     "provers."},
 
+   {OPT_DIMACS_PARSE,
+    '\0', "dimacs-in",
+    NoArg, NULL,
+    "Read propositional clauses in DIMACS format (as e.g. printed by "
+    "eground) and decide them with the experimental built-in CDCL "
+    "solver. The result is printed as a line 's SATISFIABLE' or 's UNSATISFIABLE', at "
+    "output level 2 and above followed by the model."},
+
+   {OPT_DECISION_LIMIT,
+    '\0', "decision-limit",
+    ReqArg, NULL,
+    "Give up (with result 's UNKNOWN') after the given number of "
+    "decisions of the CDCL solver. The default is -1 (no limit)."},
+
    {OPT_MEM_LIMIT,
     'm', "memory-limit",
     ReqArg, NULL,
@@ -139,6 +158,8 @@ OptCell opts[] =
 char     *outname = NULL;
 IOFormat parse_format = LOPFormat;
 bool     dimacs_format = false;
+bool     dimacs_in = false;
+long     decision_limit = -1;
 bool     app_encode = false;
 
 /*---------------------------------------------------------------------*/
@@ -152,6 +173,65 @@ void print_help(FILE* out);
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: solve_dimacs()
+//
+//   Read the DIMACS files given in state, decide them with the CDCL
+//   solver and print the result.
+//
+// Global Variables: decision_limit, OutputLevel
+//
+// Side Effects    : Input, output
+//
+/----------------------------------------------------------------------*/
+
+static void solve_dimacs(CLState_p state)
+{
+   CDCLSolver_p solver = CDCLSolverAlloc();
+   FILE         *in;
+   int          i, res;
+   long long    start;
+
+   for(i=0; state->argv[i]; i++)
+   {
+      in = InputOpen(state->argv[i], true);
+      CDCLParseDimacs(solver, in);
+      InputClose(in);
+   }
+   start = GetUSecClock();
+   res   = CDCLSolve(solver, decision_limit);
+   switch(res)
+   {
+   case CDCL_SATISFIABLE:
+         fprintf(GlobalOut, "s SATISFIABLE\n");
+         if(OutputLevel >= 2)
+         {
+            fprintf(GlobalOut, "v");
+            for(i=1; i<=CDCLVarNo(solver); i++)
+            {
+               fprintf(GlobalOut, " %d", CDCLDeref(solver, i) > 0 ? i : -i);
+            }
+            fprintf(GlobalOut, " 0\n");
+         }
+         break;
+   case CDCL_UNSATISFIABLE:
+         fprintf(GlobalOut, "s UNSATISFIABLE\n");
+         break;
+   default:
+         fprintf(GlobalOut, "s UNKNOWN\n");
+         break;
+   }
+   if(OutputLevel)
+   {
+      CDCLSolverPrintStatistics(GlobalOut, solver);
+      fprintf(GlobalOut, "# CDCL search time                   : %.3f s\n",
+              (GetUSecClock()-start)/1000000.0);
+   }
+   CDCLSolverFree(solver);
+}
+
+
 int main(int argc, char* argv[])
 {
    TypeBank_p      typebank;
@@ -178,26 +258,34 @@ int main(int argc, char* argv[])
       CLStateInsertArg(state, "-");
    }
 
-   typebank = TypeBankAlloc();
-   sig      = SigAlloc(typebank);
-   form     = DPLLFormulaAlloc();
-   for(i=0; state->argv[i]; i++)
+   if(dimacs_in)
    {
-      in = CreateScanner(StreamTypeFile, state->argv[i] , true, NULL, true);
-      ScannerSetFormat(in, parse_format);
-
-      DPLLFormulaParseLOP(in, sig, form);
-      DestroyScanner(in);
+      solve_dimacs(state);
+      CLStateFree(state);
    }
-   dpllstate = DPLLStateAlloc(form);
+   else
+   {
+      typebank = TypeBankAlloc();
+      sig      = SigAlloc(typebank);
+      form     = DPLLFormulaAlloc();
+      for(i=0; state->argv[i]; i++)
+      {
+         in = CreateScanner(StreamTypeFile, state->argv[i] , true, NULL, true);
+         ScannerSetFormat(in, parse_format);
+
+         DPLLFormulaParseLOP(in, sig, form);
+         DestroyScanner(in);
+      }
+      dpllstate = DPLLStateAlloc(form);
 
-   CLStateFree(state);
-   UNUSED(dpllstate); /* Stiffle warning for now */
+      CLStateFree(state);
+      UNUSED(dpllstate); /* Stiffle warning for now */
 #ifndef FAST_EXIT
-   DPLLStateFree(dpllstate);
-   SigFree(sig);
-   TypeBankFree(typebank);
+      DPLLStateFree(dpllstate);
+      SigFree(sig);
+      TypeBankFree(typebank);
 #endif
+   }
    fflush(GlobalOut);
    OutClose(GlobalOut);
    ExitIO();
@@ -262,6 +350,12 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DIMACS_PRINT:
        dimacs_format = true;
        break;
+      case OPT_DIMACS_PARSE:
+       dimacs_in = true;
+       break;
+      case OPT_DECISION_LIMIT:
+       decision_limit = CLStateGetIntArgCheckRange(handle, arg, -1, LONG_MAX);
+       break;
       case OPT_MEM_LIMIT:
             if(strcmp(arg, "Auto")==0)
             {
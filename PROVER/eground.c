@@ -17,6 +17,8 @@
   Run "eprover -h" for contact information.
 
   Created: Sun May 27 23:35:28 CEST 2001
+  Mon Oct 19 01:32:08 CEST 2026: Parallel grounding with streamed
+  DIMACS output
 
   -----------------------------------------------------------------------*/
 
@@ -71,7 +73,8 @@ typedef enum
    OPT_GIVE_UP,
    OPT_CONSTRAINTS,
    OPT_LOCAL_CONSTRAINTS,
-   OPT_FIX_MINISAT
+   OPT_FIX_MINISAT,
+   OPT_WORKERS
 }OptionCodes;
 
 
@@ -335,6 +338,16 @@ OptCell opts[] =
     "to compensate for MiniSAT's problematic interpretation of "
     "the DIMAC syntax."},
 
+   {OPT_WORKERS,
+    'j', "workers",
+    ReqArg, NULL,
+    "Ground the non-unit clauses with the given number of worker "
+    "processes and stream the result in DIMACS format (implies "
+    "--dimacs). Ground clauses are written to temporary files as they "
+    "are created, so that only unit clauses are kept in memory. The "
+    "header always gives the exact maximal variable index. Not "
+    "compatible with --add-one-instance."},
+
     {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -357,6 +370,7 @@ bool   new_cnf          = true,
        print_result = true,
        fix_minisat = false,
        app_encode = false;
+int    workers = 0;
 long   give_up = 0,
        miniscope_limit  = 1000,
        initial_literals = 0,
@@ -382,7 +396,10 @@ int main(int argc, char* argv[])
    Sig_p           sig;
    ClauseSet_p     clauses, dummy;
    FormulaSet_p    formulas, f_ax_archive;
-   GroundSet_p     groundset;
+   GroundSet_p     groundset = NULL;
+   GroundSetState  complete;
+   GroundStreamStatsCell stream_stats;
+   long            generated_clauses, generated_literals;
    Scanner_p       in;
    int             i;
    CLState_p       state;
@@ -454,11 +471,6 @@ int main(int argc, char* argv[])
    }
    VarBankFree(freshvars);
 
-   TBGCDeregisterFormulaSet(terms, formulas);
-   FormulaSetFree(formulas);
-   TBGCDeregisterFormulaSet(terms, f_ax_archive);
-   FormulaSetFree(f_ax_archive);
-
    ClauseSetRemoveSuperfluousLiterals(clauses);
 
    cspec = FVCollectAlloc(FVIACFeatures,
@@ -478,6 +490,11 @@ int main(int argc, char* argv[])
 
    SpecFeaturesCompute(&features, clauses, formulas, f_ax_archive, terms);
 
+   TBGCDeregisterFormulaSet(terms, formulas);
+   FormulaSetFree(formulas);
+   TBGCDeregisterFormulaSet(terms, f_ax_archive);
+   FormulaSetFree(f_ax_archive);
+
    if(!SpecNoEq(&features))
    {
       Warning("Recoding equational literals. Be sure to include"
@@ -513,49 +530,73 @@ int main(int argc, char* argv[])
 
    ClauseSetSort(clauses, ClauseCmpByLen);
 
-   groundset = GroundSetAlloc(terms);
-
-   if(constraints)
+   if(workers)
    {
-      ClauseSetCreateConstrGroundInstances(terms, clauses,
-                                           groundset,
-                                           unit_sub,
-                                           unit_res,
-                                           taut_check,
-                                           give_up,
-                                           0);
+      complete = ClauseSetStreamGroundInstancesDimacs(print_result?GlobalOut:NULL,
+                                                      terms, clauses,
+                                                      unit_sub,
+                                                      unit_res,
+                                                      taut_check,
+                                                      constraints,
+                                                      give_up,
+                                                      workers,
+                                                      &stream_stats);
+      generated_clauses  = stream_stats.clauses;
+      generated_literals = stream_stats.literals;
    }
    else
    {
-      ClauseSetCreateGroundInstances(terms, clauses,
-                                     groundset,
-                                     unit_sub,
-                                     unit_res,
-                                     taut_check,
-                                     give_up);
-   }
-   if((groundset->complete!=cpl_complete) && add_single_instance)
-   {
-      GroundSetState gss_cache = groundset->complete;
-      MemIsLow = false; /* Kind of optimistic, but otherwise
-                           ClauseSetCreateConstrGroundInstances() will
-                           fail immediately */
-      ClauseSetCreateConstrGroundInstances(terms, clauses,
-                                           groundset,
-                                           unit_sub,
-                                           unit_res,
-                                           taut_check,
-                                           give_up,
-                                           selected_symbol);
-      groundset->complete = gss_cache;
-   }
-   if(OutputLevel == 1)
-   {
-      fputc('\n', GlobalOut);
+      groundset = GroundSetAlloc(terms);
+
+      if(constraints)
+      {
+         ClauseSetCreateConstrGroundInstances(terms, clauses,
+                                              groundset,
+                                              unit_sub,
+                                              unit_res,
+                                              taut_check,
+                                              give_up,
+                                              0);
+      }
+      else
+      {
+         ClauseSetCreateGroundInstances(terms, clauses,
+                                        groundset,
+                                        unit_sub,
+                                        unit_res,
+                                        taut_check,
+                                        give_up);
+      }
+      if((groundset->complete!=cpl_complete) && add_single_instance)
+      {
+         GroundSetState gss_cache = groundset->complete;
+         MemIsLow = false; /* Kind of optimistic, but otherwise
+                              ClauseSetCreateConstrGroundInstances() will
+                              fail immediately */
+         ClauseSetCreateConstrGroundInstances(terms, clauses,
+                                              groundset,
+                                              unit_sub,
+                                              unit_res,
+                                              taut_check,
+                                              give_up,
+                                              selected_symbol);
+         groundset->complete = gss_cache;
+      }
+      if(OutputLevel == 1)
+      {
+         fputc('\n', GlobalOut);
+      }
+      complete           = groundset->complete;
+      generated_clauses  = GroundSetMembers(groundset);
+      generated_literals = GroundSetLiterals(groundset);
    }
    if(print_result)
    {
-      if(dimacs_format)
+      if(!groundset)
+      {
+         /* Already written while grounding */
+      }
+      else if(dimacs_format)
       {
          long max_lit =  groundset->max_literal;
 
@@ -572,7 +613,7 @@ int main(int argc, char* argv[])
       {
          GroundSetPrint(GlobalOut, groundset);
       }
-      switch(groundset->complete)
+      switch(complete)
       {
       case cpl_complete:
             fprintf(GlobalOut,
@@ -603,11 +644,14 @@ int main(int argc, char* argv[])
               "# Generated clauses                    : %ld\n"
               "# Generated literals                   : %ld\n",
               initial_clauses, initial_literals,
-              GroundSetMembers(groundset),
-              GroundSetLiterals(groundset));
+              generated_clauses,
+              generated_literals);
    }
 #ifndef FAST_EXIT
-   GroundSetFree(groundset);
+   if(groundset)
+   {
+      GroundSetFree(groundset);
+   }
    ClauseSetFree(clauses);
 
    terms->sig = NULL;
@@ -812,6 +856,15 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_FIX_MINISAT:
             fix_minisat = true;
             break;
+      case OPT_WORKERS:
+            workers = CLStateGetIntArg(handle, arg);
+            if(workers < 1)
+            {
+               Error("Option -j (--workers) requires a positive argument",
+                     USAGE_ERROR);
+            }
+            dimacs_format = true;
+            break;
       default:
             assert(false);
             break;
@@ -851,6 +904,11 @@ CLState_p process_options(int argc, char* argv[])
          SysError("Unable to prevent core dumps", SYS_ERROR);
       }
    }
+   if(workers && add_single_instance)
+   {
+      Error("Option -i (--add-one-instance) cannot be combined with "
+            "-j (--workers)", USAGE_ERROR);
+   }
    SetMemoryLimit(mem_limit);
    return state;
 }
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Jul 23 17:46:15 MET DST 1999
     New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Write the clause pattern image.
 
 -----------------------------------------------------------------------*/
 
@@ -25,7 +27,7 @@ Changes
 #include <sys/stat.h>
 #include <cio_commandline.h>
 #include <cio_output.h>
-#include <cle_kbdesc.h>
+#include <cle_kbimage.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -45,9 +47,6 @@ typedef enum
    OPT_SELECT_EVAL
 }OptionCodes;
 
-ProblemType problemType  = PROBLEM_NOT_INIT;
-
-
 
 /*---------------------------------------------------------------------*/
 /*                        Global Variables                             */
@@ -91,6 +90,7 @@ OptCell opts[] =
 
 double neg_proportion = 1.0;
 long   neg_examples   =   0;
+bool   app_encode     = false;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -171,6 +171,7 @@ int main(int argc, char* argv[])
    fprintf(out,
       "# Individual annotated patterns. \n");
    OutClose(out);
+   KBImageWrite(basename, KB_ANNOTATION_NO);
 
    VERBOUT("...done.\nCreating subdirectory FILES...\n");
 
@@ -18,12 +18,15 @@ Changes
 
 <1> Wed Jul 28 16:21:33 MET DST 1999
     New
+<2> Mon Oct 19 04:12:37 CEST 2026
+    Load and write the clause pattern image.
 
 -----------------------------------------------------------------------*/
 
 #include <cio_commandline.h>
 #include <cio_output.h>
 #include <cle_kbinsert.h>
+#include <cle_kbimage.h>
 #include <e_version.h>
 
 
@@ -134,11 +137,7 @@ int main(int argc, char* argv[])
    typetable = TypeBankAlloc();
    sig = SigAlloc(typetable);
    annoterms = TBAlloc(sig);
-   in = CreateScanner(StreamTypeFile,
-            KBFileName(name, kb_name, "clausepatterns"),
-                      true, NULL, true);
-   clause_examples = AnnoSetParse(in, annoterms, KB_ANNOTATION_NO);
-   DestroyScanner(in);
+   clause_examples = KBAnnoSetLoad(kb_name, annoterms, KB_ANNOTATION_NO);
 
    VERBOUT("Old knowledge base files parsed successfully\n");
 
@@ -173,6 +172,7 @@ int main(int argc, char* argv[])
    out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
    AnnoSetPrint(out, clause_examples);
    OutClose(out);
+   KBImageWrite(kb_name, KB_ANNOTATION_NO);
 
    out = OutOpen(KBFileName(name, kb_name, "problems"));
    ExampleSetPrint(out, proof_examples);
@@ -15,6 +15,8 @@
   Run "eprover -h" for contact information.
 
   Created: Jul 28 16:21:33 MET DST 1999
+  Mon Oct 19 04:12:37 CEST 2026: Load and write the clause pattern
+  image.
 
   -----------------------------------------------------------------------*/
 
@@ -22,6 +24,7 @@
 #include <cio_output.h>
 #include <cio_fileops.h>
 #include <cle_kbinsert.h>
+#include <cle_kbimage.h>
 #include <e_version.h>
 
 /*---------------------------------------------------------------------*/
@@ -140,12 +143,8 @@ int main(int argc, char* argv[])
    SigParse(in, reserved_symbols, true);
    DestroyScanner(in);
 
-   in = CreateScanner(StreamTypeFile,
-                      KBFileName(name, kb_name, "clausepatterns"),
-                      true, NULL, true);
    annoterms = TBAlloc(reserved_symbols);
-   clause_examples = AnnoSetParse(in, annoterms, KB_ANNOTATION_NO);
-   DestroyScanner(in);
+   clause_examples = KBAnnoSetLoad(kb_name, annoterms, KB_ANNOTATION_NO);
 
    VERBOUT("Old knowledge base files parsed successfully\n");
 
@@ -211,6 +210,7 @@ int main(int argc, char* argv[])
    out = OutOpen(KBFileName(name, kb_name, "clausepatterns"));
    AnnoSetPrint(out, clause_examples);
    OutClose(out);
+   KBImageWrite(kb_name, KB_ANNOTATION_NO);
 
    out = OutOpen(KBFileName(name, kb_name, "problems"));
    ExampleSetPrint(out, proof_examples);
@@ -575,9 +575,9 @@ int main(int argc, char* argv[])
                              FormulaDefLimit);
          }
 
-         for(clause = fstate->axioms->anchor->succ;
+         for(clause = ClauseSucc(fstate->axioms->anchor);
              clause != fstate->axioms->anchor;
-             clause = clause->succ)
+             clause = ClauseSucc(clause))
          {
             PatternSubstBacktrack(pat_subst, 0);
             listrep = PStackAlloc();
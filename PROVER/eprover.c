@@ -36,6 +36,8 @@
 #include <che_new_autoschedule.h>
 #include <ccl_bce.h>
 #include <ccl_pred_elim.h>
+#include <cte_ho_csu.h>
+#include <cco_checkpoint.h>
 #include <sys/mman.h>
 
 
@@ -55,8 +57,12 @@ PERF_CTR_DEFINE(SatTimer);
 /*---------------------------------------------------------------------*/
 
 char              *outname = NULL;
-char              *watchlist_filename = NULL;
+PStack_p          watchlist_files;
 char              *parse_strategy_filename = NULL;
+char              *checkpoint_filename = NULL,
+                  *restore_filename = NULL,
+                  *perf_trace_filename = NULL;
+PerfCtrTraceFormat perf_trace_format = PCTraceJSON;
 HeuristicParms_p  h_parms;
 FVIndexParms_p    fvi_parms;
 bool              print_sat = false,
@@ -100,6 +106,7 @@ long              step_limit = LONG_MAX,
 long long tb_insert_limit = LLONG_MAX;
 bool lift_lambdas = true;
 int num_cpus = 1;
+int feature_workers = 1;
 UnifMode unif_mode = SingleUnif;
 
 int force_deriv_output = 0;
@@ -237,6 +244,42 @@ ProofState_p parse_spec(CLState_p state,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: register_perf_counters()
+//
+//   Register the performance counters of the prover for printing
+//   and tracing.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void register_perf_counters(void)
+{
+   PERF_CTR_REGISTER(SatTimer);
+   PERF_CTR_REGISTER(FwContractTimer);
+   PERF_CTR_REGISTER(BwSimplifyTimer);
+   PERF_CTR_REGISTER(GenerateTimer);
+   PERF_CTR_REGISTER(NewClausesTimer);
+   PERF_CTR_REGISTER(MguTimer);
+   PERF_CTR_REGISTER(ParamodTimer);
+   PERF_CTR_REGISTER(PMIndexTimer);
+   PERF_CTR_REGISTER(IndexUnifTimer);
+   PERF_CTR_REGISTER(BWRWTimer);
+   PERF_CTR_REGISTER(BWRWIndexTimer);
+   PERF_CTR_REGISTER(IndexMatchTimer);
+   PERF_CTR_REGISTER(FreqVecTimer);
+   PERF_CTR_REGISTER(FVIndexTimer);
+   PERF_CTR_REGISTER(SubsumeTimer);
+   PERF_CTR_REGISTER(SetSubsumeTimer);
+   PERF_CTR_REGISTER(ContextSRTimer);
+   PERF_CTR_REGISTER(ClauseEvalTimer);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: print_info()
@@ -264,6 +307,39 @@ static void print_info(void)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: add_watchlist_file()
+//
+//   Add name to the watchlist files unless it is already
+//   there. Options are processed more than once, so this has to be
+//   idempotent.
+//
+// Global Variables: watchlist_files
+//
+// Side Effects    : Changes watchlist_files
+//
+/----------------------------------------------------------------------*/
+
+static void add_watchlist_file(char* name)
+{
+   PStackPointer i;
+   char*         handle;
+
+   for(i=0; i<PStackGetSP(watchlist_files); i++)
+   {
+      handle = PStackElementP(watchlist_files, i);
+      if(handle == name ||
+         (handle != UseInlinedWatchList && name != UseInlinedWatchList &&
+          strcmp(handle, name)==0))
+      {
+         return;
+      }
+   }
+   PStackPushP(watchlist_files, name);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: strategy_io()
@@ -359,6 +435,57 @@ int handle_auto_modes_preproc(ProofState_p proofstate,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: slice_file_name()
+//
+//   Derive the checkpoint file name of one strategy of a schedule
+//   from the user-supplied name base, so that strategies running in
+//   parallel do not overwrite each other's checkpoints. The name is
+//   stored in store and returned.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes store
+//
+/----------------------------------------------------------------------*/
+
+static char* slice_file_name(DStr_p store, char* base, int sched_idx,
+                             char* heuristic)
+{
+   DStrReset(store);
+   DStrAppendStr(store, base);
+   DStrAppendChar(store, '.');
+   DStrAppendInt(store, sched_idx);
+   DStrAppendChar(store, '.');
+   DStrAppendStr(store, heuristic);
+   return DStrView(store);
+}
+
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: print_index_occupancy()
+//
+//   Print the leaf occupancy of an FP index, if it is adaptive (the
+//   other FP indices are only described with PRINT_INDEX_STATS).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void print_index_occupancy(char* name, FPIndex_p index)
+{
+   if(index && FPIndexIsAdaptive(index))
+   {
+      fprintf(GlobalOut, "# %s index occupancy:\n", name);
+      FPIndexOccupancyPrint(GlobalOut, index);
+   }
+}
+
 
 /*-----------------------------------------------------------------------
 //
@@ -435,6 +562,7 @@ static void print_proof_stats(ProofState_p proofstate,
               CondensationAttempts);
       fprintf(GlobalOut, "# Condensation successes               : %ld\n",
               CondensationSuccesses);
+      CSUCachePrintStatistics(GlobalOut);
 
 #ifdef MEASURE_UNIFICATION
       fprintf(GlobalOut, "# Unification attempts                 : %ld\n",
@@ -448,19 +576,12 @@ static void print_proof_stats(ProofState_p proofstate,
 #endif
       fprintf(GlobalOut, "# Termbank termtop insertions          : %lld\n",
               proofstate->terms->insertions);
-      PERF_CTR_PRINT(GlobalOut, MguTimer);
-      PERF_CTR_PRINT(GlobalOut, SatTimer);
-      PERF_CTR_PRINT(GlobalOut, ParamodTimer);
-      PERF_CTR_PRINT(GlobalOut, PMIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, IndexUnifTimer);
-      PERF_CTR_PRINT(GlobalOut, BWRWTimer);
-      PERF_CTR_PRINT(GlobalOut, BWRWIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, IndexMatchTimer);
-      PERF_CTR_PRINT(GlobalOut, FreqVecTimer);
-      PERF_CTR_PRINT(GlobalOut, FVIndexTimer);
-      PERF_CTR_PRINT(GlobalOut, SubsumeTimer);
-      PERF_CTR_PRINT(GlobalOut, SetSubsumeTimer);
-      PERF_CTR_PRINT(GlobalOut, ClauseEvalTimer);
+      fprintf(GlobalOut, "# Clauses evaluated in sets            : %ld\n",
+              HCBSetEvalClauses);
+      fprintf(GlobalOut, "# ...evaluations per second            : %.0f\n",
+              HCBSetEvalTicks?
+              HCBSetEvalClauses/(PerfCtrTicksToUSec(HCBSetEvalTicks)/1000000.0):0.0);
+      PerfCtrPrintRegistered(GlobalOut);
 
 #ifdef PRINT_INDEX_STATS
       fprintf(GlobalOut, "# Backwards rewriting index : ");
@@ -484,6 +605,19 @@ static void print_proof_stats(ProofState_p proofstate,
       FPIndexDistribDataPrint(GlobalOut, proofstate->gindices.pm_negp_index);
       fprintf(GlobalOut, "\n");
 #endif
+      if(proofstate->gindices.bw_rw_paths)
+      {
+         fprintf(GlobalOut, "# Backwards rewriting path index       : "
+                 "%ld terms, %ld nodes\n",
+                 PathIndexTerms(proofstate->gindices.bw_rw_paths),
+                 PathIndexNodes(proofstate->gindices.bw_rw_paths));
+      }
+      print_index_occupancy("Backwards rewriting",
+                            proofstate->gindices.bw_rw_index);
+      print_index_occupancy("Paramod-from", proofstate->gindices.pm_from_index);
+      print_index_occupancy("Paramod-into", proofstate->gindices.pm_into_index);
+      print_index_occupancy("Paramod-neg-atom",
+                            proofstate->gindices.pm_negp_index);
       // PDTreePrint(GlobalOut, proofstate->processed_pos_rules->demod_index);
    }
 }
@@ -510,7 +644,8 @@ int main(int argc, char* argv[])
    ProofControl_p   proofcontrol;
    Clause_p         success = NULL,
       filter_success;
-   bool             out_of_clauses;
+   bool             out_of_clauses,
+      restored = false;
    char             *finals_state = "exists",
       *sat_status = "Derivation";
    long             cnf_size = 0,
@@ -527,6 +662,9 @@ int main(int argc, char* argv[])
    Schedule_p preproc_schedule = NULL;
    rlim_t wc_sched_limit;
    Derivation_p deriv;
+   char         *slice_heuristic = NULL;
+   DStr_p       checkpoint_slice = NULL,
+      restore_slice = NULL;
 
    assert(argv[0]);
 
@@ -534,6 +672,7 @@ int main(int argc, char* argv[])
    INCREASE_STACK_SIZE;
 #endif
 
+   PerfCtrInit();
    InitIO(NAME);
    pid = getpid();
    setpgid(0, 0);
@@ -544,8 +683,10 @@ int main(int argc, char* argv[])
    fvi_parms = FVIndexParmsAlloc();
    wfcb_definitions = PStackAlloc();
    hcb_definitions = PStackAlloc();
+   watchlist_files = PStackAlloc();
 
    state = process_options(argc, argv);
+   register_perf_counters();
 
    OpenGlobalOut(outname);
 
@@ -654,7 +795,7 @@ int main(int argc, char* argv[])
    }
 
    raw_clause_no = proofstate->axioms->members;
-   ProofStateLoadWatchlist(proofstate, watchlist_filename, parse_format);
+   ProofStateLoadWatchlist(proofstate, watchlist_files, parse_format);
 
    ClauseSetArchiveCopy(proofstate->ax_archive, proofstate->axioms);
    if(!h_parms->no_preproc)
@@ -699,6 +840,7 @@ int main(int argc, char* argv[])
       // todo: eventually check if the problem in HO syntax is FO.
       EliminateBlockedClauses(proofstate->axioms, proofstate->archive,
                               h_parms->bce_max_occs,
+                              h_parms->elim_workers,
                               proofstate->tmp_terms);
    }
 
@@ -710,6 +852,12 @@ int main(int argc, char* argv[])
                            proofstate->tmp_terms, proofstate->freshvars);
    }
 
+   if(proofstate->watchlist)
+   {
+      /* Computed once here, so that all forked strategies share it */
+      proofstate->wladmin = WatchlistAdminAlloc(proofstate->watchlist);
+   }
+
    if((strategy_scheduling && sched_idx != -1) || auto_conf)
    {
       if(!limits)
@@ -717,8 +865,10 @@ int main(int argc, char* argv[])
          limits = CreateDefaultSpecLimits();
       }
       const int choice_max_depth = h_parms->inst_choice_max_depth;
-      SpecFeaturesCompute(&features, proofstate->axioms, proofstate->f_axioms,
-                          proofstate->f_ax_archive, proofstate->terms);
+      SpecFeaturesComputeParallel(&features, proofstate->axioms,
+                                  proofstate->f_axioms,
+                                  proofstate->f_ax_archive,
+                                  proofstate->terms, feature_workers);
       // order info can be affected by clausification
       // (imagine new symbols being introduced)
       features.order = raw_features.order;
@@ -767,6 +917,7 @@ int main(int argc, char* argv[])
                exit(RESOURCE_OUT);
             }
          }
+         slice_heuristic = h_parms->heuristic_name;
          GetHeuristicWithName(h_parms->heuristic_name, h_parms);
          h_parms->inst_choice_max_depth = choice_max_depth;
       }
@@ -784,6 +935,34 @@ int main(int argc, char* argv[])
       state = process_options(argc, argv); // refilling the h_parms with user options
       h_parms->heuristic_name = h_parms->heuristic_def;
    }
+   if(slice_heuristic)
+   {
+      /* Every strategy of the schedule has its own checkpoint */
+      if(checkpoint_filename)
+      {
+         checkpoint_slice = DStrAlloc();
+         checkpoint_filename = slice_file_name(checkpoint_slice,
+                                               checkpoint_filename,
+                                               sched_idx, slice_heuristic);
+         /* Treat the CPU limit of the slice as soft, so that the
+            search stops and writes its checkpoint instead of being
+            terminated */
+         TimeLimitIsSoft = true;
+      }
+      if(restore_filename)
+      {
+         restore_slice = DStrAlloc();
+         restore_filename = slice_file_name(restore_slice,
+                                            restore_filename,
+                                            sched_idx, slice_heuristic);
+         if(!FileExists(restore_filename))
+         {
+            fprintf(GlobalOut, "# No checkpoint %s, starting from the "
+                    "initial clauses\n", restore_filename);
+            restore_filename = NULL;
+         }
+      }
+   }
 
    if(limits)
    {
@@ -808,6 +987,18 @@ int main(int argc, char* argv[])
 
    ProofStateInit(proofstate, proofcontrol);
    //printf("Alive (2)!\n");
+   if(restore_filename &&
+      ProofStateCheckpointRestore(restore_filename, proofstate, proofcontrol))
+   {
+      restored = true;
+      fprintf(GlobalOut, "# Saturation state restored from %s\n",
+              restore_filename);
+      if(PrintProofObject)
+      {
+         fprintf(GlobalOut, "# Proof objects are conditional on the "
+                 "restored clauses (introduced(checkpoint))\n");
+      }
+   }
 
    VERBOUT2("Prover state initialized\n");
    preproc_time = GetTotalCPUTime();
@@ -816,7 +1007,9 @@ int main(int argc, char* argv[])
       fprintf(GlobalOut, "# Preprocessing time       : %.3f s\n", preproc_time);
    }
 
-   if(proofcontrol->heuristic_parms.presat_interreduction)
+   /* A restored state has been interreduced before it was saved,
+      and resetting it would lose the processed clauses */
+   if(proofcontrol->heuristic_parms.presat_interreduction && !restored)
    {
       LiteralSelectionFun sel_strat =
          proofcontrol->heuristic_parms.selection_strategy;
@@ -846,13 +1039,24 @@ int main(int argc, char* argv[])
 
    if(!success)
    {
+      if(perf_trace_filename)
+      {
+         PerfCtrTraceOpen(perf_trace_filename, perf_trace_format);
+      }
       success = Saturate(proofstate, proofcontrol, step_limit,
                          proc_limit, unproc_limit, total_limit,
                          generated_limit, tb_insert_limit, answer_limit);
+      PerfCtrTraceClose();
    }
    PERF_CTR_EXIT(SatTimer);
 
    out_of_clauses = ClauseSetEmpty(proofstate->unprocessed);
+   if(checkpoint_filename && !success && !out_of_clauses &&
+      ProofStateCheckpointSave(checkpoint_filename, proofstate, proofcontrol))
+   {
+      fprintf(GlobalOut, "# Saturation state saved to %s\n",
+              checkpoint_filename);
+   }
    if(filter_sat)
    {
       filter_success = ProofStateFilterUnprocessed(proofstate,
@@ -1085,6 +1289,7 @@ int main(int argc, char* argv[])
            ProofStateStorage(proofstate));
    MemFreeListPrint(GlobalOut);
 #endif
+   CSUCacheFree();
    ProofControlFree(proofcontrol);
 #endif
 cleanup1:
@@ -1092,9 +1297,18 @@ cleanup1:
    ProofStateFree(proofstate);
    CLStateFree(state);
    PStackFree(hcb_definitions);
+   PStackFree(watchlist_files);
    PStackFree(wfcb_definitions);
    FVIndexParmsFree(fvi_parms);
    HeuristicParmsFree(h_parms);
+   if(checkpoint_slice)
+   {
+      DStrFree(checkpoint_slice);
+   }
+   if(restore_slice)
+   {
+      DStrFree(restore_slice);
+   }
 #ifdef FULL_MEM_STATS
    MemFreeListPrint(GlobalOut);
 #endif
@@ -1777,6 +1991,14 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_BACKWARD_CSR:
             h_parms->backward_context_sr = true;
             break;
+      case OPT_GROUND_CC:
+            h_parms->ground_cc = true;
+            break;
+      case OPT_NF_CACHE:
+            h_parms->nf_cache = true;
+            h_parms->nf_cache_size = CLStateGetIntArgCheckRange(handle, arg,
+                                                                0, LONG_MAX);
+            break;
       case OPT_RULES_GENERAL:
             h_parms->prefer_general = true;
             break;
@@ -1831,6 +2053,20 @@ CLState_p process_options(int argc, char* argv[])
             h_parms->sat_check_decision_limit =
                CLStateGetIntArgCheckRange(handle, arg, -1, INT_MAX);
             break;
+      case OPT_SAT_SOLVER:
+            tmp = StringIndex(arg, SatSolverNames);
+            if(tmp < 0)
+            {
+               DStr_p err = DStrAlloc();
+               DStrAppendStr(err,
+                             "Wrong argument to option --satcheck-solver. "
+                             "Possible values: ");
+               DStrAppendStrArray(err, SatSolverNames, ", ");
+               Error(DStrView(err), USAGE_ERROR);
+               DStrFree(err);
+            }
+            SatSolverDefault = tmp;
+            break;
       case OPT_STATIC_WATCHLIST:
             h_parms->watchlist_is_static = true;
             //intentional fall-through
@@ -1838,19 +2074,46 @@ CLState_p process_options(int argc, char* argv[])
             if(strcmp(WATCHLIST_INLINE_STRING, arg)==0 ||
                strcmp(WATCHLIST_INLINE_QSTRING, arg)==0  )
             {
-               watchlist_filename = UseInlinedWatchList;
+               add_watchlist_file(UseInlinedWatchList);
             }
             else
             {
-               watchlist_filename = arg;
+               add_watchlist_file(arg);
             }
             break;
       case OPT_WATCHLIST_NO_SIMPLIFY:
             h_parms->watchlist_simplify = false;
             break;
+      case OPT_CHECKPOINT:
+            checkpoint_filename = arg;
+            break;
+      case OPT_RESTORE_CHECKPOINT:
+            restore_filename = arg;
+            break;
+      case OPT_PERF_TRACE:
+            perf_trace_filename = arg;
+            break;
+      case OPT_PERF_TRACE_FORMAT:
+            if(strcmp(arg, "json")==0)
+            {
+               perf_trace_format = PCTraceJSON;
+            }
+            else if(strcmp(arg, "chrome")==0)
+            {
+               perf_trace_format = PCTraceChrome;
+            }
+            else
+            {
+               Error("Option --perf-trace-format requires json or chrome "
+                     "as an argument", USAGE_ERROR);
+            }
+            break;
       case OPT_FW_SUMBSUMPTION_AGGRESSIVE:
             h_parms->forward_subsumption_aggressive = true;
             break;
+      case OPT_NO_BATCH_EVALUATION:
+            HCBBatchEvaluation = false;
+            break;
       case OPT_NO_INDEXED_SUBSUMPTION:
             fvi_parms->cspec.features = FVINoFeatures;
             break;
@@ -1932,7 +2195,10 @@ CLState_p process_options(int argc, char* argv[])
             fvi_parms->symbol_slack = CLStateGetIntArgCheckRange(handle, arg, 0, LONG_MAX);
             break;
       case OPT_RW_BW_INDEX:
-            check_fp_index_arg(arg, "--rw-bw-index");
+            if(strcmp(arg, PATH_INDEX_NAME)!=0)
+            {
+               check_fp_index_arg(arg, "--rw-bw-index");
+            }
             strcpy(h_parms->rw_bw_index_type, arg);
             break;
       case OPT_PM_FROM_INDEX:
@@ -2061,6 +2327,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_MAX_UNIF_STEPS:
             h_parms->max_unif_steps = CLStateGetIntArgCheckRange(handle, arg, 0, 100000);
             break;
+      case OPT_CSU_CACHE_MEM:
+            h_parms->csu_cache_mem = CLStateGetIntArgCheckRange(handle, arg, 0, LONG_MAX/MEGA);
+            break;
       case OPT_UNIF_MODE:
             unif_mode = STR2UM(arg);
             if(unif_mode==-1)
@@ -2109,6 +2378,20 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_PRED_ELIM_IGNORE_CONJ_SYMS:
             h_parms->pred_elim_ignore_conj_syms = CLStateGetBoolArg(handle, arg);
             break;
+      case OPT_ELIM_WORKERS:
+            h_parms->elim_workers = CLStateGetIntArgCheckRange(handle, arg, 0, INT_MAX);
+            if(!h_parms->elim_workers)
+            {
+               h_parms->elim_workers = GetCoreNumber();
+            }
+            break;
+      case OPT_FEATURE_WORKERS:
+            feature_workers = CLStateGetIntArgCheckRange(handle, arg, 0, INT_MAX);
+            if(!feature_workers)
+            {
+               feature_workers = GetCoreNumber();
+            }
+            break;
       case OPT_LAMBDA_TO_FORALL:
             h_parms->lambda_to_forall = CLStateGetBoolArg(handle, arg);
             break;
@@ -0,0 +1,520 @@
+#!/usr/bin/env python3
+
+"""
+e_perf_regress 0.1
+
+Usage: e_perf_regress.py run [options] -o <report>
+       e_perf_regress.py compare [options] <base_report> <new_report>
+
+Performance regression benchmark for the prover core.
+
+"run" runs a fixed set of problems (the example problems that come
+with E plus a family of generated problems of increasing size) under
+a fixed set of strategies with --print-statistics, and writes a JSON
+report with the result status, the numbers of processed and generated
+clauses, the times of the performance counters (i.e. of the phases of
+the proof search), CPU time and peak resident set size of each job.
+
+"compare" compares two such reports (typically from two builds of
+the prover) and lists all jobs where the new build is worse than the
+base build by more than the given thresholds. The exit status is 1
+if there are regressions, 0 otherwise.
+
+Everything runs locally, sequentially by default. Times are CPU
+times (user+system) of the prover process, the peak RSS is taken
+from the kernel (wait4()), so no external tools are needed.
+
+Options for "run":
+
+-h Print this help.
+
+-b <binary>
+   Prover binary to benchmark (default PROVER/eprover or, if that
+   does not exist, PROVER/eprover-ho).
+
+-o <file>
+   Write the report to file (default: stdout).
+
+-t <seconds>
+   CPU time limit per job (default 10).
+
+-r <n>
+   Run each job n times and report the median CPU time and the
+   largest RSS (default 1).
+
+-j <n>
+   Run n jobs in parallel (default 1). This makes times less
+   reliable.
+
+-p <dir>
+   Directory with example problems (default EXAMPLE_PROBLEMS).
+
+-s <list>
+   Comma-separated list of strategies to use (default: all, see
+   "strategies" below).
+
+Options for "compare":
+
+-T <fraction>
+   Relative CPU time increase of a job that counts as regression
+   (default 0.1).
+
+-M <fraction>
+   Relative increase of the peak RSS that counts as regression
+   (default 0.1).
+
+-P <fraction>
+   Relative increase of the time in a perf counter that counts as
+   regression (default 0.2).
+
+-m <seconds>
+   Ignore time differences of jobs/counters with a base time below
+   this (default 0.5).
+
+-c Also count changes in the number of processed or generated
+   clauses as regressions (by default they are only reported).
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+"""
+
+import sys
+import os
+import re
+import json
+import time
+import glob
+import random
+import getopt
+import tempfile
+import platform
+import subprocess
+
+
+# Strategies. All are run with deterministic clause sorting, so that
+# the counts of two builds are comparable.
+
+strategies = {
+    "auto" : ["--auto"],
+    "fixed": ["-tKBO6", "-WSelectMaxLComplexAvoidPosPred",
+              "-H(4*Refinedweight(PreferGoals,1,2,1.5,2,1),"
+              "1*FIFOWeight(ConstPrio))"],
+    "fifo" : ["-tLPO4", "-WNoSelection", "-H(1*FIFOWeight(ConstPrio))"]
+}
+
+common_args = ["-s", "--print-statistics", "--detsort-rw", "--detsort-new"]
+
+example_dirs = ["SMOKETEST", "TPTP"]
+
+status_re  = re.compile(r"^# SZS status (\S+)")
+stat_re    = re.compile(r"^# (Processed clauses|Generated clauses)\s*:\s*(\d+)")
+pctime_re  = re.compile(r"^# PC\((\w+)\)\s*:\s*([0-9.]+)\s*$")
+pccalls_re = re.compile(r"^# PC\((\w+)\) calls\s*:\s*(\d+)\s*$")
+include_re = re.compile(r"^\s*include\(\s*'([^']*)'")
+
+solved = set(["Theorem", "Unsatisfiable", "CounterSatisfiable",
+              "Satisfiable", "ContradictoryAxioms"])
+
+
+#----------------------------------------------------------------------
+# Problem set
+#----------------------------------------------------------------------
+
+def includes_available(path, tptp):
+    """
+    Return True if all files included by the problem exist.
+    """
+    with open(path) as fp:
+        for line in fp:
+            mo = include_re.match(line)
+            if mo and not os.path.exists(os.path.join(tptp, mo.group(1))):
+                return False
+    return True
+
+
+def example_problems(probdir):
+    """
+    Return the example problems (as (name, path) pairs) that can be
+    parsed without missing include files.
+    """
+    res = []
+    tptp = os.path.join(probdir, "TPTP")
+    for sub in example_dirs:
+        for path in sorted(glob.glob(os.path.join(probdir, sub, "*.p"))):
+            if includes_available(path, tptp):
+                res.append((sub+"/"+os.path.basename(path), path))
+    return res
+
+
+def gen_chain(n):
+    """
+    Horn chain p0(a), p_i(X) => p_i+1(f(X)), ~p_n(f^n(a)). Proof
+    length and number of clauses grow linearly.
+    """
+    res = ["cnf(start,axiom,p0(a))."]
+    for i in range(n):
+        res.append("cnf(step%d,axiom,~p%d(X)|p%d(f(X)))."%(i, i, i+1))
+    goal = "a"
+    for i in range(n):
+        goal = "f(%s)"%goal
+    res.append("cnf(goal,negated_conjecture,~p%d(%s))."%(n, goal))
+    return res
+
+
+def gen_group(k, m):
+    """
+    Group theory with a goal stating that k double inverses of a
+    product of m constants can be removed. Exercises unit-equational
+    reasoning and rewriting on growing terms.
+    """
+    res = ["cnf(left_identity,axiom,mult(e,X)=X).",
+           "cnf(left_inverse,axiom,mult(inv(X),X)=e).",
+           "cnf(assoc,axiom,mult(mult(X,Y),Z)=mult(X,mult(Y,Z)))."]
+    prod = "a%d"%(m-1)
+    for i in range(m-2, -1, -1):
+        prod = "mult(a%d,%s)"%(i, prod)
+    lhs = prod
+    for i in range(k):
+        lhs = "inv(inv(%s))"%lhs
+    res.append("cnf(goal,negated_conjecture,%s!=%s)."%(lhs, prod))
+    return res
+
+
+def gen_ground(seed, eqns, consts):
+    """
+    Random ground equations over a unary and a binary function and a
+    set of clauses with ground disequations guarding a predicate.
+    """
+    rnd = random.Random(seed)
+    cs = ["c%d"%i for i in range(consts)]
+
+    def term(d):
+        if d == 0 or rnd.random() < 0.4:
+            return rnd.choice(cs)
+        if rnd.random() < 0.5:
+            return "f(%s)"%term(d-1)
+        return "g(%s,%s)"%(term(d-1), term(d-1))
+
+    res = []
+    for i in range(eqns):
+        res.append("cnf(e%d,axiom,%s=%s)."%(i, term(3), term(3)))
+    for i in range(eqns//2):
+        lits = ["%s!=%s"%(term(2), term(2))
+                for j in range(rnd.randint(1, 3))]
+        lits.append("p(%s)"%term(1))
+        res.append("cnf(n%d,axiom,%s)."%(i, "|".join(lits)))
+    res.append("cnf(goal,negated_conjecture,~p(X)).")
+    return res
+
+
+def generated_problems(tmpdir):
+    """
+    Write the generated problems to tmpdir and return them as (name,
+    path) pairs.
+    """
+    problems = [("GEN/chain_100",    gen_chain(100)),
+                ("GEN/chain_200",    gen_chain(200)),
+                ("GEN/group_2_4",    gen_group(2, 4)),
+                ("GEN/group_4_8",    gen_group(4, 8)),
+                ("GEN/ground_40",    gen_ground(1, 40, 10)),
+                ("GEN/ground_160",   gen_ground(2, 160, 30)),
+                ("GEN/ground_640",   gen_ground(3, 640, 100))]
+    res = []
+    for name, clauses in problems:
+        path = os.path.join(tmpdir, os.path.basename(name)+".p")
+        with open(path, "w") as fp:
+            fp.write("\n".join(clauses)+"\n")
+        res.append((name, path))
+    return res
+
+
+#----------------------------------------------------------------------
+# Running jobs
+#----------------------------------------------------------------------
+
+def parse_output(out):
+    """
+    Extract status, counts and perf counters from prover output.
+    """
+    res = {"status": "NoStatus", "processed": None, "generated": None,
+           "phases": {}, "calls": {}}
+    for line in out.splitlines():
+        mo = status_re.match(line)
+        if mo:
+            res["status"] = mo.group(1)
+            continue
+        mo = stat_re.match(line)
+        if mo:
+            key = "processed" if mo.group(1).startswith("P") else "generated"
+            res[key] = int(mo.group(2))
+            continue
+        mo = pctime_re.match(line)
+        if mo:
+            res["phases"][mo.group(1)] = float(mo.group(2))
+            continue
+        mo = pccalls_re.match(line)
+        if mo:
+            res["calls"][mo.group(1)] = int(mo.group(2))
+    return res
+
+
+def start_job(binary, strat, path, limit):
+    args = [binary]+common_args+strategies[strat]+\
+           ["--cpu-limit=%d"%limit, path]
+    return subprocess.Popen(args, stdout=subprocess.PIPE,
+                            stderr=subprocess.DEVNULL,
+                            universal_newlines=True)
+
+
+def finish_job(proc):
+    """
+    Wait for the job and return its parsed output with CPU time and
+    peak RSS (in KB).
+    """
+    out = proc.stdout.read()
+    proc.stdout.close()
+    pid, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = status
+    res = parse_output(out)
+    res["cpu"] = usage.ru_utime+usage.ru_stime
+    res["rss"] = usage.ru_maxrss
+    return res
+
+
+def merge_runs(runs):
+    """
+    Combine repeated runs of a job: median CPU time, largest RSS,
+    counts of the first run (and a flag if they differ).
+    """
+    res = dict(runs[0])
+    cpus = sorted(r["cpu"] for r in runs)
+    res["cpu"] = cpus[len(cpus)//2]
+    res["rss"] = max(r["rss"] for r in runs)
+    for key in res["phases"]:
+        vals = sorted(r["phases"].get(key, 0.0) for r in runs)
+        res["phases"][key] = vals[len(vals)//2]
+    res["deterministic"] = all(
+        (r["processed"], r["generated"], r["status"]) ==
+        (res["processed"], res["generated"], res["status"])
+        for r in runs)
+    return res
+
+
+def run_bench(binary, probdir, limit, repeat, parallel, strats):
+    tmpdir = tempfile.mkdtemp(prefix="e_perf_")
+    try:
+        problems = example_problems(probdir)+generated_problems(tmpdir)
+        jobs = [(strat, name, path) for name, path in problems
+                for strat in strats for i in range(repeat)]
+        results = {}
+        running = []
+        while jobs or running:
+            while jobs and len(running) < parallel:
+                strat, name, path = jobs.pop(0)
+                running.append((strat, name,
+                                start_job(binary, strat, path, limit)))
+            strat, name, proc = running.pop(0)
+            results.setdefault((strat, name), []).append(finish_job(proc))
+            sys.stderr.write("%-6s %-30s %s\n"%
+                             (strat, name, results[(strat, name)][-1]["status"]))
+    finally:
+        for path in glob.glob(os.path.join(tmpdir, "*")):
+            os.remove(path)
+        os.rmdir(tmpdir)
+
+    report = {"binary": os.path.abspath(binary),
+              "date": time.strftime("%Y-%m-%d %H:%M:%S"),
+              "host": platform.node(),
+              "cpu_limit": limit,
+              "repeat": repeat,
+              "strategies": dict((s, strategies[s]) for s in strats),
+              "jobs": []}
+    for (strat, name), runs in sorted(results.items()):
+        job = merge_runs(runs)
+        job["strategy"] = strat
+        job["problem"] = name
+        report["jobs"].append(job)
+    return report
+
+
+#----------------------------------------------------------------------
+# Comparing reports
+#----------------------------------------------------------------------
+
+def worse(base, new, threshold, minimum):
+    return base >= minimum and new > base*(1+threshold)
+
+
+def compare_reports(base, new, time_thr, rss_thr, phase_thr, min_time,
+                    strict_counts):
+    """
+    Print all differences between the two reports and return the
+    number of regressions.
+    """
+    bjobs = dict(((j["strategy"], j["problem"]), j) for j in base["jobs"])
+    regressions = 0
+    changes = 0
+    btotal = ntotal = 0.0
+    bphases = {}
+    nphases = {}
+
+    print("# Base: %s (%s)"%(base["binary"], base["date"]))
+    print("# New : %s (%s)"%(new["binary"], new["date"]))
+    for n in new["jobs"]:
+        key = (n["strategy"], n["problem"])
+        if key not in bjobs:
+            print("%-6s %-30s only in new report"%key)
+            continue
+        b = bjobs[key]
+        msgs = []
+        bad = False
+        if b["status"] in solved and n["status"] not in solved:
+            msgs.append("status %s -> %s"%(b["status"], n["status"]))
+            bad = True
+        elif b["status"] != n["status"]:
+            msgs.append("status %s -> %s"%(b["status"], n["status"]))
+        if b["status"] in solved and n["status"] in solved:
+            btotal += b["cpu"]
+            ntotal += n["cpu"]
+            for ph, val in b["phases"].items():
+                bphases[ph] = bphases.get(ph, 0.0)+val
+            for ph, val in n["phases"].items():
+                nphases[ph] = nphases.get(ph, 0.0)+val
+            if worse(b["cpu"], n["cpu"], time_thr, min_time):
+                msgs.append("cpu %.2fs -> %.2fs"%(b["cpu"], n["cpu"]))
+                bad = True
+        # Ignore RSS noise below 1MB
+        if worse(b["rss"], n["rss"], rss_thr, 0) and n["rss"]-b["rss"] > 1024:
+            msgs.append("rss %dKB -> %dKB"%(b["rss"], n["rss"]))
+            bad = True
+        for count in ["processed", "generated"]:
+            if b[count] != n[count]:
+                msgs.append("%s %s -> %s"%(count, b[count], n[count]))
+                bad = bad or strict_counts
+        if msgs:
+            print("%-6s %-30s %s %s"%(key[0], key[1],
+                                      "REGRESSION" if bad else "changed",
+                                      ", ".join(msgs)))
+            if bad:
+                regressions += 1
+            else:
+                changes += 1
+
+    print("# Total CPU time of jobs solved by both: %.2fs -> %.2fs"%
+          (btotal, ntotal))
+    if worse(btotal, ntotal, time_thr, min_time):
+        print("# REGRESSION in total CPU time")
+        regressions += 1
+    for ph in sorted(bphases):
+        if ph in nphases and worse(bphases[ph], nphases[ph], phase_thr,
+                                   min_time):
+            print("# REGRESSION in PC(%s): %.2fs -> %.2fs"%
+                  (ph, bphases[ph], nphases[ph]))
+            regressions += 1
+    print("# %d regressions, %d other changes"%(regressions, changes))
+    return regressions
+
+
+#----------------------------------------------------------------------
+# Main
+#----------------------------------------------------------------------
+
+def usage():
+    print(__doc__)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2 or sys.argv[1] not in ["run", "compare"]:
+        usage()
+        sys.exit(2)
+    mode = sys.argv[1]
+
+    try:
+        opts, args = getopt.gnu_getopt(sys.argv[2:], "hb:o:t:r:j:p:s:T:M:P:m:c")
+    except getopt.GetoptError as err:
+        print(err)
+        sys.exit(2)
+
+    binary   = None
+    outfile  = None
+    limit    = 10
+    repeat   = 1
+    parallel = 1
+    probdir  = "EXAMPLE_PROBLEMS"
+    strats   = sorted(strategies.keys())
+    time_thr = 0.1
+    rss_thr  = 0.1
+    phase_thr= 0.2
+    min_time = 0.5
+    strict   = False
+
+    for option, optarg in opts:
+        if option == "-h":
+            usage()
+            sys.exit()
+        elif option == "-b":
+            binary = optarg
+        elif option == "-o":
+            outfile = optarg
+        elif option == "-t":
+            limit = int(optarg)
+        elif option == "-r":
+            repeat = max(1, int(optarg))
+        elif option == "-j":
+            parallel = max(1, int(optarg))
+        elif option == "-p":
+            probdir = optarg
+        elif option == "-s":
+            strats = optarg.split(",")
+            for s in strats:
+                if s not in strategies:
+                    sys.exit("Unknown strategy "+s)
+        elif option == "-T":
+            time_thr = float(optarg)
+        elif option == "-M":
+            rss_thr = float(optarg)
+        elif option == "-P":
+            phase_thr = float(optarg)
+        elif option == "-m":
+            min_time = float(optarg)
+        elif option == "-c":
+            strict = True
+
+    if mode == "run":
+        if not binary:
+            binary = "PROVER/eprover"
+            if not os.path.exists(binary):
+                binary = "PROVER/eprover-ho"
+        report = run_bench(binary, probdir, limit, repeat, parallel, strats)
+        if outfile:
+            with open(outfile, "w") as fp:
+                json.dump(report, fp, indent=1, sort_keys=True)
+        else:
+            json.dump(report, sys.stdout, indent=1, sort_keys=True)
+    else:
+        if len(args) != 2:
+            usage()
+            sys.exit(2)
+        with open(args[0]) as fp:
+            base = json.load(fp)
+        with open(args[1]) as fp:
+            new = json.load(fp)
+        if compare_reports(base, new, time_thr, rss_thr, phase_thr,
+                           min_time, strict):
+            sys.exit(1)
@@ -0,0 +1,299 @@
+/*-----------------------------------------------------------------------
+
+File  : bench_clausesets.c
+
+Author: The E developers
+
+Contents
+
+  Microbenchmark for the memory footprint of clause cells and the
+  traversal of clause sets via ClauseSucc(), on a full set and after
+  most members have been removed. Build with and without
+  COMPACT_CLAUSES to compare the linked list and the slot vector
+  representation.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 04:12:37 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <ccl_clausesets.h>
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_SIZE,
+   OPT_ROUNDS
+}OptionCodes;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_SIZE,
+    'n', "size",
+    ReqArg, NULL,
+    "Number of clauses allocated (default 2000000). Every second one "
+    "is put into the set that is traversed, the others into a second "
+    "set, so that the members of a set are not adjacent in memory."},
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of traversals per measurement (default 10)."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+bool app_encode = false;
+
+static long  size   = 2000000;
+static long  rounds = 10;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+void      print_help(FILE* out);
+CLState_p process_options(int argc, char* argv[]);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_traverse()
+//
+//   Traverse set rounds times via ClauseSucc(), touching each member,
+//   and print the time per visited clause.
+//
+// Global Variables: rounds
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void bench_traverse(char* name, ClauseSet_p set)
+{
+   Clause_p  handle;
+   long      i, visited = 0, weight = 0;
+   long long start;
+
+   start = GetUSecTime();
+   for(i=0; i<rounds; i++)
+   {
+      for(handle = ClauseSucc(set->anchor);
+          handle != set->anchor;
+          handle = ClauseSucc(handle))
+      {
+         weight += handle->weight;
+         visited++;
+      }
+   }
+   printf("%-28s %10.1f ns/clause\n", name,
+          1000.0*(GetUSecTime()-start)/visited);
+   UNUSED(weight); assert(visited == rounds*set->members);
+}
+
+
+#ifdef COMPACT_CLAUSES
+/*-----------------------------------------------------------------------
+//
+// Function: bench_slot_traverse()
+//
+//   Traverse set rounds times by walking the slot vector directly, as
+//   a lower bound for ClauseSucc(). Print the time per visited
+//   clause.
+//
+// Global Variables: rounds
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void bench_slot_traverse(char* name, ClauseSet_p set)
+{
+   Clause_p  handle;
+   long      i, j, visited = 0, weight = 0;
+   long long start;
+
+   start = GetUSecTime();
+   for(i=0; i<rounds; i++)
+   {
+      for(j=0; j<ClauseSetSlotNo(set); j++)
+      {
+         handle = ClauseSetSlot(set, j);
+         if(handle)
+         {
+            weight += handle->weight;
+            visited++;
+         }
+      }
+   }
+   printf("%-28s %10.1f ns/clause\n", name,
+          1000.0*(GetUSecTime()-start)/visited);
+   UNUSED(weight); assert(visited == rounds*set->members);
+}
+#endif
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p   state;
+   ClauseSet_p walked, other;
+   PStack_p    members;
+   Clause_p    handle;
+   long        i;
+
+   assert(argv[0]);
+   InitError(argv[0]);
+
+   state = process_options(argc, argv);
+
+   walked  = ClauseSetAlloc();
+   other   = ClauseSetAlloc();
+   members = PStackAlloc();
+   for(i=0; i<size; i++)
+   {
+      handle = EmptyClauseAlloc();
+      handle->weight = i;
+      if(i%2)
+      {
+         ClauseSetInsert(other, handle);
+      }
+      else
+      {
+         ClauseSetInsert(walked, handle);
+         PStackPushP(members, handle);
+      }
+   }
+#ifdef COMPACT_CLAUSES
+   printf("# COMPACT_CLAUSES, ");
+#else
+   printf("# Linked clause sets, ");
+#endif
+   printf("%ld clauses, %ld in the traversed set, %ld rounds\n",
+          size, walked->members, rounds);
+   printf("%-28s %10ld bytes\n", "sizeof(ClauseCell)",
+          (long)sizeof(ClauseCell));
+#ifdef COMPACT_CLAUSES
+   printf("%-28s %10ld bytes\n", "Per set member",
+          (long)(sizeof(ClauseCell)+sizeof(Clause_p)));
+#else
+   printf("%-28s %10ld bytes\n", "Per set member",
+          (long)sizeof(ClauseCell));
+#endif
+
+   bench_traverse("ClauseSucc() full set", walked);
+#ifdef COMPACT_CLAUSES
+   bench_slot_traverse("Slot walk full set", walked);
+#endif
+
+   /* Remove two thirds of the members, as backward simplification
+      and processing do with the unprocessed clauses. */
+   for(i=0; i<PStackGetSP(members); i++)
+   {
+      if(i%3)
+      {
+         handle = PStackElementP(members, i);
+         ClauseSetExtractEntry(handle);
+         ClauseFree(handle);
+      }
+   }
+   bench_traverse("ClauseSucc() after removal", walked);
+#ifdef COMPACT_CLAUSES
+   bench_slot_traverse("Slot walk after removal", walked);
+#endif
+
+   PStackFree(members);
+   ClauseSetFree(walked);
+   ClauseSetFree(other);
+   CLStateFree(state);
+
+   return NO_ERROR;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, size, rounds
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_SIZE:
+            size = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+Usage: bench_clausesets [options]\n\
+\n\
+Report the size of clause cells and the time per clause for clause\n\
+set traversal, before and after removing two thirds of the members.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
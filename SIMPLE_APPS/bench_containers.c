@@ -0,0 +1,476 @@
+/*-----------------------------------------------------------------------
+
+File  : bench_containers.c
+
+Author: The E developers
+
+Contents
+
+  Microbenchmark comparing the splay trees (PTree, NumTree) with the
+  B-trees (PBTree, NumBTree) for insertion, lookup, ordered traversal
+  and deletion of random keys.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 13:20:07 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <clb_ptrees.h>
+#include <clb_numtrees.h>
+#include <clb_btrees.h>
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_SIZE,
+   OPT_ROUNDS
+}OptionCodes;
+
+typedef enum
+{
+   BInsert,
+   BFind,
+   BTraverse,
+   BDelete,
+   BOpNo
+}BenchOp;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_SIZE,
+    'n', "size",
+    ReqArg, NULL,
+    "Number of keys stored in each container (default 100000)."},
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of times the whole benchmark is repeated (default 10)."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+ProblemType problemType  = PROBLEM_NOT_INIT;
+
+static long  size   = 100000;
+static long  rounds = 10;
+
+static char* op_names[] = {"insert", "find", "traverse", "delete"};
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+void      print_help(FILE* out);
+CLState_p process_options(int argc, char* argv[]);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: shuffle()
+//
+//   Permute the array keys with a fixed pseudo-random sequence.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void shuffle(long *keys, long n, unsigned long seed)
+{
+   long i, j, tmp;
+
+   for(i=n-1; i>0; i--)
+   {
+      seed = seed*6364136223846793005ul+1442695040888963407ul;
+      j = (seed>>33)%(i+1);
+      tmp = keys[i]; keys[i] = keys[j]; keys[j] = tmp;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_ptree()
+//
+//   Run one round of all operations on a PTree, add the times to
+//   usec[].
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_ptree(long *keys, long n, long long *usec)
+{
+   PTree_p   root = NULL, cell;
+   PStack_p  trav;
+   long      i, found = 0;
+   long long start;
+
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      PTreeStore(&root, (void*)keys[i]);
+   }
+   usec[BInsert] += GetUSecTime()-start;
+
+   shuffle(keys, n, 17);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      found += PTreeFind(&root, (void*)keys[i])!=NULL;
+   }
+   usec[BFind] += GetUSecTime()-start;
+
+   start = GetUSecTime();
+   trav = PTreeTraverseInit(root);
+   while((cell = PTreeTraverseNext(trav)))
+   {
+      found--;
+   }
+   PTreeTraverseExit(trav);
+   usec[BTraverse] += GetUSecTime()-start;
+
+   shuffle(keys, n, 23);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      PTreeDeleteEntry(&root, (void*)keys[i]);
+   }
+   usec[BDelete] += GetUSecTime()-start;
+   UNUSED(found); assert(!found && !root);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_pbtree()
+//
+//   Run one round of all operations on a PBTree, add the times to
+//   usec[].
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_pbtree(long *keys, long n, long long *usec)
+{
+   PBTree_p      root = NULL;
+   BTreeIterCell iter;
+   long          i, found = 0;
+   long long     start;
+
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      PBTreeStore(&root, (void*)keys[i]);
+   }
+   usec[BInsert] += GetUSecTime()-start;
+
+   shuffle(keys, n, 17);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      found += PBTreeFind(root, (void*)keys[i])!=NULL;
+   }
+   usec[BFind] += GetUSecTime()-start;
+
+   start = GetUSecTime();
+   PBTreeIterInit(&iter, root);
+   while(PBTreeIterNext(&iter))
+   {
+      found--;
+   }
+   usec[BTraverse] += GetUSecTime()-start;
+
+   shuffle(keys, n, 23);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      PBTreeDeleteEntry(&root, (void*)keys[i]);
+   }
+   usec[BDelete] += GetUSecTime()-start;
+   UNUSED(found); assert(!found && !root);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_numtree()
+//
+//   Run one round of all operations on a NumTree, add the times to
+//   usec[].
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_numtree(long *keys, long n, long long *usec)
+{
+   NumTree_p root = NULL, cell;
+   PStack_p  trav;
+   IntOrP    val;
+   long      i, found = 0;
+   long long start;
+
+   val.p_val = NULL;
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      NumTreeStore(&root, keys[i], val, val);
+   }
+   usec[BInsert] += GetUSecTime()-start;
+
+   shuffle(keys, n, 17);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      found += NumTreeFind(&root, keys[i])!=NULL;
+   }
+   usec[BFind] += GetUSecTime()-start;
+
+   start = GetUSecTime();
+   trav = NumTreeTraverseInit(root);
+   while((cell = NumTreeTraverseNext(trav)))
+   {
+      found--;
+   }
+   NumTreeTraverseExit(trav);
+   usec[BTraverse] += GetUSecTime()-start;
+
+   shuffle(keys, n, 23);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      NumTreeDeleteEntry(&root, keys[i]);
+   }
+   usec[BDelete] += GetUSecTime()-start;
+   UNUSED(found); assert(!found && !root);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_numbtree()
+//
+//   Run one round of all operations on a NumBTree, add the times to
+//   usec[].
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_numbtree(long *keys, long n, long long *usec)
+{
+   NumBTree_p    tree = NumBTreeAlloc();
+   BTreeIterCell iter;
+   long          i, key, found = 0;
+   void*         val;
+   long long     start;
+
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      NumBTreeStore(tree, keys[i], NULL);
+   }
+   usec[BInsert] += GetUSecTime()-start;
+
+   shuffle(keys, n, 17);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      found += NumBTreeFindRef(tree, keys[i])!=NULL;
+   }
+   usec[BFind] += GetUSecTime()-start;
+
+   start = GetUSecTime();
+   NumBTreeIterInit(&iter, tree, LONG_MIN);
+   while(NumBTreeIterNext(&iter, &key, &val))
+   {
+      found--;
+   }
+   usec[BTraverse] += GetUSecTime()-start;
+
+   shuffle(keys, n, 23);
+   start = GetUSecTime();
+   for(i=0; i<n; i++)
+   {
+      NumBTreeDelete(tree, keys[i], NULL);
+   }
+   usec[BDelete] += GetUSecTime()-start;
+   UNUSED(found); assert(!found && !NumBTreeSize(tree));
+   NumBTreeFree(tree);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: print_result()
+//
+//   Print the average time per operation for one container.
+//
+// Global Variables: size, rounds, op_names
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void print_result(char* name, long long *usec)
+{
+   int op;
+
+   for(op=0; op<BOpNo; op++)
+   {
+      printf("%-10s %-9s %10.1f ns/op\n", name, op_names[op],
+             1000.0*usec[op]/((double)size*rounds));
+   }
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   long      i, *keys, *cells;
+   long long usec[4][BOpNo] = {{0}};
+
+   assert(argv[0]);
+   InitError(argv[0]);
+
+   state = process_options(argc, argv);
+
+   /* Pointer keys are the addresses of real (and therefore aligned,
+      clustered) memory cells, numeric keys are spread out randomly. */
+   cells = SizeMalloc(size*sizeof(long));
+   keys  = SizeMalloc(size*sizeof(long));
+   for(i=0; i<rounds; i++)
+   {
+      long j;
+
+      for(j=0; j<size; j++)
+      {
+         keys[j] = (long)&(cells[j]);
+      }
+      shuffle(keys, size, i);
+      bench_ptree(keys, size, usec[0]);
+      shuffle(keys, size, i);
+      bench_pbtree(keys, size, usec[1]);
+
+      for(j=0; j<size; j++)
+      {
+         keys[j] = j*2654435761l;
+      }
+      shuffle(keys, size, i);
+      bench_numtree(keys, size, usec[2]);
+      shuffle(keys, size, i);
+      bench_numbtree(keys, size, usec[3]);
+   }
+   printf("# %ld keys, %ld rounds\n", size, rounds);
+   print_result("PTree", usec[0]);
+   print_result("PBTree", usec[1]);
+   print_result("NumTree", usec[2]);
+   print_result("NumBTree", usec[3]);
+
+   SizeFree(keys, size*sizeof(long));
+   SizeFree(cells, size*sizeof(long));
+   CLStateFree(state);
+
+   return NO_ERROR;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, size, rounds
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_SIZE:
+            size = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+Usage: bench_containers [options]\n\
+\n\
+Compare the time per operation of the splay tree and B-tree\n\
+containers.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
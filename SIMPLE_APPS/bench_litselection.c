@@ -0,0 +1,270 @@
+/*-----------------------------------------------------------------------
+
+File  : bench_litselection.c
+
+Author: The E developers
+
+Contents
+
+  Microbenchmark for the literal selection functions: Read a clause
+  set (e.g. dumped with --print-saturated) and run every (or one)
+  selection function over all of its clauses, reporting the time per
+  clause.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 15:12:40 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <che_litselection.h>
+#include <che_to_autoselect.h>
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_ROUNDS,
+   OPT_SELECTION,
+   OPT_RESELECT
+}OptionCodes;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of times each selection function is run over the clause "
+    "set (default 10)."},
+   {OPT_SELECTION,
+    's', "selection",
+    ReqArg, NULL,
+    "Only benchmark the named literal selection function."},
+   {OPT_RESELECT,
+    '\0', "fresh-ordering",
+    NoArg, NULL,
+    "Force the recomputation of orientation and literal maximality "
+    "before each selection, i.e. measure selection on clauses that "
+    "have just been modified. By default, the clauses are left "
+    "unchanged between rounds, as for a clause that is re-selected "
+    "without having been simplified."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+bool app_encode = false;
+
+static long  rounds         = 10;
+static char* selection      = NULL;
+static bool  fresh_ordering = false;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+void      print_help(FILE* out);
+CLState_p process_options(int argc, char* argv[]);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_selection()
+//
+//   Run fun over all clauses of set with non-empty negative part
+//   rounds times. Return the average time per clause in ns, store a
+//   checksum of the selected literals in *selected.
+//
+// Global Variables: rounds, fresh_ordering
+//
+// Side Effects    : Changes selection and maximality in clauses
+//
+/----------------------------------------------------------------------*/
+
+static double bench_selection(OCB_p ocb, ClauseSet_p set,
+                              LiteralSelectionFun fun, long *selected)
+{
+   Clause_p  handle;
+   long      i, calls = 0;
+   long long start, ticks = 0;
+
+   *selected = 0;
+   for(i=0; i<rounds; i++)
+   {
+      for(handle = ClauseSucc(set->anchor);
+          handle != set->anchor;
+          handle = ClauseSucc(handle))
+      {
+         if(!handle->neg_lit_no)
+         {
+            continue;
+         }
+         if(fresh_ordering)
+         {
+            EqnListDelProp(handle->literals, EPMaxIsUpToDate);
+            ClauseMaxCacheInvalidate(handle);
+         }
+         start = PerfCtrTicks();
+         EqnListDelProp(handle->literals, EPIsSelected);
+         ClauseDelProp(handle, CPIsOriented);
+         fun(ocb, handle);
+         ClauseCondMarkMaximalTerms(ocb, handle);
+         ticks += PerfCtrTicks()-start;
+         calls++;
+         *selected += EqnListQueryPropNumber(handle->literals, EPIsSelected);
+      }
+   }
+   return calls?1000.0*PerfCtrTicksToUSec(ticks)/calls:0.0;
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p        state;
+   ProofState_p     proofstate;
+   HeuristicParms_p h_parms;
+   OCB_p            ocb;
+   Scanner_p        in;
+   LiteralSelectionFun fun;
+   char*            name;
+   long             selected;
+   int              i;
+   double           ns;
+
+   assert(argv[0]);
+   InitIO(argv[0]);
+
+   state = process_options(argc, argv);
+   if(state->argc ==  0)
+   {
+      CLStateInsertArg(state, "-");
+   }
+   proofstate = ProofStateAlloc(FPIgnoreProps);
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL, true);
+      ScannerSetFormat(in, AutoFormat);
+      ClauseSetParseList(in, proofstate->axioms, proofstate->terms);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   h_parms = HeuristicParmsAlloc();
+   ocb     = TOSelectOrdering(proofstate, h_parms, NULL);
+
+   printf("# %ld clauses, %ld rounds\n",
+          proofstate->axioms->members, rounds);
+   for(i=0; (name = LitSelGetNameByIndex(i)); i++)
+   {
+      if(selection && strcmp(selection, name)!=0)
+      {
+         continue;
+      }
+      fun = GetLitSelFun(name);
+      ns  = bench_selection(ocb, proofstate->axioms, fun, &selected);
+      printf("%-40s %10.1f ns/clause %10ld selected\n", name, ns, selected);
+   }
+
+   OCBFree(ocb);
+   HeuristicParmsFree(h_parms);
+   ProofStateFree(proofstate);
+   CLStateFree(state);
+
+   return NO_ERROR;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, rounds, selection, fresh_ordering
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_SELECTION:
+            if(!GetLitSelFun(arg))
+            {
+               Error("Option -s (--selection) requires a valid literal "
+                     "selection function name", USAGE_ERROR);
+            }
+            selection = arg;
+            break;
+      case OPT_RESELECT:
+            fresh_ordering = true;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+Usage: bench_litselection [options] [files]\n\
+\n\
+Read a set of clauses and report the average time per clause of each\n\
+literal selection function (including the marking of maximal\n\
+literals that goes with it).\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,1010 @@
+/*-----------------------------------------------------------------------
+
+File  : bench_primitives.c
+
+Author: The E developers
+
+Contents
+
+  Microbenchmark for the term bank, unification, matching and
+  indexing primitives: Generate a random clause set (or read one) and
+  run TBInsert(), SubstComputeMgu(), SubstComputeMatch(), the
+  fingerprint index, the perfect discrimination tree and the feature
+  vector index over it in isolation. For each primitive, the time per
+  operation, the number of cell allocations (SizeMalloc()) and system
+  allocations (SecureMalloc()) per operation (if built with
+  CLB_MEMORY_DEBUG), and the number of cache misses per operation (if
+  the Linux perf_event interface is available) are reported.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sun Oct 18 21:03:11 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cte_match_mgu_1-1.h>
+#include <cte_fp_index.h>
+#include <ccl_pdtrees.h>
+#include <ccl_fcvindexing.h>
+#include <ccl_proofstate.h>
+#include <che_to_autoselect.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_SIZE,
+   OPT_DEPTH,
+   OPT_SYMBOLS,
+   OPT_SEED,
+   OPT_ROUNDS,
+   OPT_BENCH,
+   OPT_FP_INDEX
+}OptionCodes;
+
+/* Accumulated cost of one primitive */
+
+typedef struct bench_measure_cell
+{
+   char      *name;
+   long      ops;
+   long long usec;
+   long      cells;
+   long      mallocs;
+   long long misses;
+   long      check;    /* Result checksum, e.g. number of unifiers */
+   /* Values at bench_start() */
+   long long start_usec;
+   long      start_cells;
+   long      start_mallocs;
+   long long start_misses;
+}BenchMeasureCell, *BenchMeasure_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_SIZE,
+    'n', "size",
+    ReqArg, NULL,
+    "Number of clauses generated if no input files are given "
+    "(default 10000)."},
+   {OPT_DEPTH,
+    'd', "depth",
+    ReqArg, NULL,
+    "Maximal depth of generated terms (default 4)."},
+   {OPT_SYMBOLS,
+    'S', "symbols",
+    ReqArg, NULL,
+    "Number of function symbols of generated terms (default 24). "
+    "Symbol i has arity i mod 4."},
+   {OPT_SEED,
+    '\0', "seed",
+    ReqArg, NULL,
+    "Seed for the generator (default 42)."},
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of times each benchmark is run over the corpus "
+    "(default 5)."},
+   {OPT_BENCH,
+    'b', "bench",
+    ReqArg, NULL,
+    "Only run the benchmarks whose name starts with the argument."},
+   {OPT_FP_INDEX,
+    '\0', "fp-index",
+    ReqArg, NULL,
+    "Fingerprint function used for the fingerprint index (default "
+    "FP7)."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+bool app_encode = false;
+
+static long  size      = 10000;
+static long  depth     = 4;
+static long  symbols   = 24;
+static long  rounds    = 5;
+static char* bench     = NULL;
+static char* fp_index  = "FP7";
+static unsigned long seed = 42;
+
+static int   perf_fd   = -1;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+void      print_help(FILE* out);
+CLState_p process_options(int argc, char* argv[]);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: rnd()
+//
+//   Return a pseudo-random number in [0,n).
+//
+// Global Variables: seed
+//
+// Side Effects    : Changes seed
+//
+/----------------------------------------------------------------------*/
+
+static long rnd(long n)
+{
+   seed = seed*6364136223846793005ul+1442695040888963407ul;
+   return (seed>>33)%n;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_counter_open()
+//
+//   Try to open a perf_event counter for the cache misses of this
+//   process. If this fails (not Linux, no permission, no hardware
+//   counters), perf_fd stays -1 and no misses are reported.
+//
+// Global Variables: perf_fd
+//
+// Side Effects    : System call
+//
+/----------------------------------------------------------------------*/
+
+static void cache_counter_open(void)
+{
+#ifdef __linux__
+   struct perf_event_attr attr;
+
+   memset(&attr, 0, sizeof(attr));
+   attr.type           = PERF_TYPE_HARDWARE;
+   attr.size           = sizeof(attr);
+   attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv     = 1;
+   perf_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+   if(perf_fd >= 0)
+   {
+      ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+   }
+#endif
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_counter_read()
+//
+//   Return the current value of the cache miss counter (0 if there
+//   is none).
+//
+// Global Variables: perf_fd
+//
+// Side Effects    : System call
+//
+/----------------------------------------------------------------------*/
+
+static long long cache_counter_read(void)
+{
+   long long res = 0;
+
+   if(perf_fd >= 0 && read(perf_fd, &res, sizeof(res)) != sizeof(res))
+   {
+      res = 0;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_start()
+//
+//   Start measuring a batch of operations.
+//
+// Global Variables: size_malloc_count, secure_malloc_count
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void bench_start(BenchMeasure_p m)
+{
+#ifdef CLB_MEMORY_DEBUG
+   m->start_cells   = size_malloc_count;
+   m->start_mallocs = secure_malloc_count;
+#endif
+   m->start_misses = cache_counter_read();
+   m->start_usec   = GetUSecTime();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_stop()
+//
+//   Stop measuring a batch of ops operations, add their cost to m.
+//
+// Global Variables: size_malloc_count, secure_malloc_count
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void bench_stop(BenchMeasure_p m, long ops)
+{
+   m->usec   += GetUSecTime()-m->start_usec;
+   m->misses += cache_counter_read()-m->start_misses;
+#ifdef CLB_MEMORY_DEBUG
+   m->cells   += size_malloc_count-m->start_cells;
+   m->mallocs += secure_malloc_count-m->start_mallocs;
+#endif
+   m->ops += ops;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_selected()
+//
+//   Return true if the benchmark name has been selected on the
+//   command line.
+//
+// Global Variables: bench
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool bench_selected(char* name)
+{
+   return !bench || strncmp(bench, name, strlen(bench))==0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_print()
+//
+//   Print the result line for m.
+//
+// Global Variables: perf_fd
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void bench_print(FILE* out, BenchMeasure_p m)
+{
+   double ops = m->ops?m->ops:1;
+
+   fprintf(out, "%-24s %10ld %10.1f", m->name, m->ops, 1000.0*m->usec/ops);
+#ifdef CLB_MEMORY_DEBUG
+   fprintf(out, " %10.3f %10.3f", m->cells/ops, m->mallocs/ops);
+#else
+   fprintf(out, " %10s %10s", "-", "-");
+#endif
+   if(perf_fd >= 0)
+   {
+      fprintf(out, " %10.3f", m->misses/ops);
+   }
+   else
+   {
+      fprintf(out, " %10s", "-");
+   }
+   fprintf(out, " %12ld\n", m->check);
+   fflush(out);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_term()
+//
+//   Append a random term of at most the given depth to str.
+//
+// Global Variables: symbols
+//
+// Side Effects    : Changes seed
+//
+/----------------------------------------------------------------------*/
+
+static void gen_term(DStr_p str, long max_depth)
+{
+   long f, i, arity;
+
+   if(rnd(4)==0)
+   {
+      DStrAppendChar(str, 'X');
+      DStrAppendInt(str, rnd(6));
+      return;
+   }
+   do
+   {
+      f = rnd(symbols);
+      arity = f%4;
+   }while(arity && max_depth<=1);
+
+   DStrAppendChar(str, 'f');
+   DStrAppendInt(str, f);
+   if(arity)
+   {
+      DStrAppendChar(str, '(');
+      for(i=0; i<arity; i++)
+      {
+         if(i)
+         {
+            DStrAppendChar(str, ',');
+         }
+         gen_term(str, max_depth-1);
+      }
+      DStrAppendChar(str, ')');
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_clauses()
+//
+//   Generate size random equational clauses and add them to set. Half
+//   of them are units. Each clause is parsed from its own string, as
+//   clause info records the source of the scanner.
+//
+// Global Variables: size, depth
+//
+// Side Effects    : Changes seed, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gen_clauses(ClauseSet_p set, TB_p bank)
+{
+   DStr_p    str = DStrAlloc();
+   Scanner_p in;
+   long      i, j, lits;
+
+   for(i=0; i<size; i++)
+   {
+      DStrReset(str);
+      DStrAppendStr(str, "cnf(c");
+      DStrAppendInt(str, i);
+      DStrAppendStr(str, ",plain,(");
+      lits = rnd(2)?1:2+rnd(3);
+      for(j=0; j<lits; j++)
+      {
+         if(j)
+         {
+            DStrAppendStr(str, "|");
+         }
+         gen_term(str, 1+rnd(depth));
+         DStrAppendStr(str, rnd(3)?"=":"!=");
+         gen_term(str, 1+rnd(depth));
+      }
+      DStrAppendStr(str, ")).");
+      in = CreateScanner(StreamTypeInternalString, DStrView(str),
+                         true, NULL, true);
+      ScannerSetFormat(in, TSTPFormat);
+      ClauseSetParseList(in, set, bank);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   DStrFree(str);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: collect_corpus()
+//
+//   Collect the literal sides of the clauses in set, all their
+//   non-variable subterms, and pairs of sides with the same top
+//   symbol.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes seed, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void collect_corpus(ClauseSet_p set, PStack_p sides,
+                           PStack_p subterms, PStack_p pairs)
+{
+   Clause_p  handle;
+   Eqn_p     eqn;
+   PStack_p  stack = PStackAlloc();
+   Term_p    s, t;
+   long      i, j, n;
+   int       k;
+
+   for(handle = ClauseSucc(set->anchor);
+       handle!=set->anchor;
+       handle=ClauseSucc(handle))
+   {
+      for(eqn = handle->literals; eqn; eqn = eqn->next)
+      {
+         PStackPushP(sides, eqn->lterm);
+         if(EqnIsEquLit(eqn))
+         {
+            PStackPushP(sides, eqn->rterm);
+         }
+      }
+   }
+   for(i=0; i<PStackGetSP(sides); i++)
+   {
+      PStackPushP(stack, PStackElementP(sides, i));
+      while(!PStackEmpty(stack))
+      {
+         t = PStackPopP(stack);
+         if(TermIsFreeVar(t))
+         {
+            continue;
+         }
+         PStackPushP(subterms, t);
+         for(k=0; k<t->arity; k++)
+         {
+            PStackPushP(stack, t->args[k]);
+         }
+      }
+   }
+   n = PStackGetSP(sides);
+   for(i=0; n && i<n; i++)
+   {
+      s = PStackElementP(sides, i);
+      for(j=0; j<8; j++)
+      {
+         t = PStackElementP(sides, rnd(n));
+         if(TermIsFreeVar(s) || TermIsFreeVar(t) || s->f_code == t->f_code)
+         {
+            break;
+         }
+      }
+      PStackPushP(pairs, s);
+      PStackPushP(pairs, t);
+   }
+   PStackFree(stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_tbinsert()
+//
+//   Insert unshared copies of the sides into an empty term bank (new)
+//   and into the corpus bank (existing).
+//
+// Global Variables: rounds
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_tbinsert(TB_p terms, PStack_p sides,
+                           BenchMeasure_p m_new, BenchMeasure_p m_old)
+{
+   PStack_p copies = PStackAlloc();
+   TB_p     bank;
+   long     r;
+   PStackPointer i;
+
+   for(r=0; r<rounds; r++)
+   {
+      bank = TBAlloc(terms->sig);
+      for(i=0; i<PStackGetSP(sides); i++)
+      {
+         PStackPushP(copies, TermCopy(PStackElementP(sides, i), bank->vars,
+                                      NULL, DEREF_NEVER));
+      }
+      bench_start(m_new);
+      for(i=0; i<PStackGetSP(copies); i++)
+      {
+         TBInsert(bank, PStackElementP(copies, i), DEREF_NEVER);
+      }
+      bench_stop(m_new, PStackGetSP(copies));
+      m_new->check = TBTermNodes(bank);
+      while(!PStackEmpty(copies))
+      {
+         TermFree(PStackPopP(copies));
+      }
+      bank->sig = NULL;
+      TBFree(bank);
+
+      for(i=0; i<PStackGetSP(sides); i++)
+      {
+         PStackPushP(copies, TermCopy(PStackElementP(sides, i), terms->vars,
+                                      NULL, DEREF_NEVER));
+      }
+      bench_start(m_old);
+      for(i=0; i<PStackGetSP(copies); i++)
+      {
+         TBInsert(terms, PStackElementP(copies, i), DEREF_NEVER);
+      }
+      bench_stop(m_old, PStackGetSP(copies));
+      m_old->check = TBTermNodes(terms);
+      while(!PStackEmpty(copies))
+      {
+         TermFree(PStackPopP(copies));
+      }
+   }
+   PStackFree(copies);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_unif()
+//
+//   Compute unifiers (and matches) for all pairs.
+//
+// Global Variables: rounds
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void bench_unif(PStack_p pairs, BenchMeasure_p m_mgu,
+                       BenchMeasure_p m_match)
+{
+   Subst_p       subst = SubstAlloc();
+   long          r;
+   PStackPointer i;
+
+   for(r=0; r<rounds; r++)
+   {
+      m_mgu->check = 0;
+      bench_start(m_mgu);
+      for(i=0; i<PStackGetSP(pairs); i+=2)
+      {
+         if(SubstComputeMgu(PStackElementP(pairs, i),
+                            PStackElementP(pairs, i+1), subst))
+         {
+            m_mgu->check++;
+         }
+         SubstBacktrack(subst);
+      }
+      bench_stop(m_mgu, PStackGetSP(pairs)/2);
+
+      m_match->check = 0;
+      bench_start(m_match);
+      for(i=0; i<PStackGetSP(pairs); i+=2)
+      {
+         if(SubstComputeMatch(PStackElementP(pairs, i),
+                              PStackElementP(pairs, i+1), subst))
+         {
+            m_match->check++;
+         }
+         SubstBacktrack(subst);
+      }
+      bench_stop(m_match, PStackGetSP(pairs)/2);
+   }
+   SubstFree(subst);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_payload_free()
+//
+//   Free the term tree stored at a fingerprint index leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fp_payload_free(void* junk)
+{
+   PTreeFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_fpindex()
+//
+//   Build a fingerprint index of all subterms and retrieve the
+//   unification candidates for all non-variable sides.
+//
+// Global Variables: rounds, fp_index
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_fpindex(Sig_p sig, PStack_p sides, PStack_p subterms,
+                          BenchMeasure_p m_insert, BenchMeasure_p m_find)
+{
+   PStack_p      collect = PStackAlloc();
+   FPIndex_p     index;
+   FPTree_p      leaf;
+   Term_p        t;
+   long          r, queries;
+   PStackPointer i;
+
+   for(r=0; r<rounds; r++)
+   {
+      index = FPIndexAlloc(GetFPIndexFunction(fp_index), sig,
+                           fp_payload_free);
+      bench_start(m_insert);
+      for(i=0; i<PStackGetSP(subterms); i++)
+      {
+         t = PStackElementP(subterms, i);
+         leaf = FPIndexInsert(index, t);
+         PTreeStore((PTree_p*)&(leaf->payload), t);
+      }
+      bench_stop(m_insert, PStackGetSP(subterms));
+      m_insert->check = FPIndexCollectLeaves(index, collect);
+      PStackReset(collect);
+
+      m_find->check = 0;
+      queries = 0;
+      bench_start(m_find);
+      for(i=0; i<PStackGetSP(sides); i++)
+      {
+         t = PStackElementP(sides, i);
+         if(TermIsFreeVar(t))
+         {
+            continue;
+         }
+         m_find->check += FPIndexFindUnifiable(index, t, collect);
+         PStackReset(collect);
+         queries++;
+      }
+      bench_stop(m_find, queries);
+      FPIndexFree(index);
+   }
+   PStackFree(collect);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_pdtree()
+//
+//   Build a discrimination tree of the (oriented) positive units and
+//   find all demodulators applicable to each subterm.
+//
+// Global Variables: rounds
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void bench_pdtree(OCB_p ocb, TB_p terms, ClauseSet_p set,
+                         PStack_p subterms, BenchMeasure_p m_insert,
+                         BenchMeasure_p m_find)
+{
+   Subst_p       subst = SubstAlloc();
+   PStack_p      units = PStackAlloc();
+   ClauseSet_p   demods;
+   Clause_p      handle, copy;
+   Eqn_p         eqn;
+   SysDate       date = SysDateCreationTime();
+   long          r;
+   PStackPointer i;
+
+   for(r=0; r<rounds; r++)
+   {
+      for(handle = ClauseSucc(set->anchor);
+          handle!=set->anchor;
+          handle=ClauseSucc(handle))
+      {
+         if(!ClauseIsUnit(handle) || !EqnIsPositive(handle->literals) ||
+            !EqnIsEquLit(handle->literals))
+         {
+            continue;
+         }
+         copy = ClauseCopy(handle, terms);
+         eqn  = copy->literals;
+         EqnOrient(ocb, eqn);
+         if(TermIsFreeVar(eqn->lterm) || eqn->lterm == eqn->rterm ||
+            (!EqnIsOriented(eqn) && TermIsFreeVar(eqn->rterm)))
+         {
+            ClauseFree(copy);
+            continue;
+         }
+         SysDateInc(&date);
+         copy->date = date;
+         PStackPushP(units, copy);
+      }
+      demods = ClauseSetAlloc();
+      demods->demod_index = PDTreeAlloc(terms);
+      bench_start(m_insert);
+      for(i=0; i<PStackGetSP(units); i++)
+      {
+         ClauseSetPDTIndexedInsert(demods, PStackElementP(units, i));
+      }
+      bench_stop(m_insert, PStackGetSP(units));
+      m_insert->check = demods->demod_index->node_count;
+      PStackReset(units);
+
+      m_find->check = 0;
+      bench_start(m_find);
+      for(i=0; i<PStackGetSP(subterms); i++)
+      {
+         PDTreeSearchInit(demods->demod_index, PStackElementP(subterms, i),
+                          SysDateCreationTime(), false);
+         while(PDTreeFindNextDemodulator(demods->demod_index, subst))
+         {
+            m_find->check++;
+         }
+         PDTreeSearchExit(demods->demod_index);
+      }
+      bench_stop(m_find, PStackGetSP(subterms));
+      SubstBacktrack(subst);
+      ClauseSetFree(demods);
+   }
+   PStackFree(units);
+   SubstFree(subst);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_fvindex()
+//
+//   Insert the feature vectors of all clauses into an empty feature
+//   vector index.
+//
+// Global Variables: rounds
+//
+// Side Effects    : Memory operations, sorts literals
+//
+/----------------------------------------------------------------------*/
+
+static void bench_fvindex(Sig_p sig, ClauseSet_p set, BenchMeasure_p m)
+{
+   PStack_p      packed = PStackAlloc();
+   FVCollect_p   cspec;
+   FVIAnchor_p   index;
+   Clause_p      handle;
+   long          r;
+   PStackPointer i;
+
+   cspec = BillFeaturesCollectAlloc(sig, sig->f_count*2+2);
+   for(r=0; r<rounds; r++)
+   {
+      index = FVIAnchorAlloc(cspec, PermVectorCompute(set, cspec, false));
+      for(handle = ClauseSucc(set->anchor);
+          handle!=set->anchor;
+          handle=ClauseSucc(handle))
+      {
+         PStackPushP(packed, FVIndexPackClause(handle, index));
+      }
+      bench_start(m);
+      for(i=0; i<PStackGetSP(packed); i++)
+      {
+         FVIndexInsert(index, PStackElementP(packed, i));
+      }
+      bench_stop(m, PStackGetSP(packed));
+      m->check = FVIndexCountNodes(index->index, false, false);
+      while(!PStackEmpty(packed))
+      {
+         FVUnpackClause(PStackPopP(packed));
+      }
+      FVIAnchorFree(index);
+   }
+   FVCollectFree(cspec);
+   PStackFree(packed);
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p        state;
+   ProofState_p     proofstate;
+   HeuristicParms_p h_parms;
+   OCB_p            ocb;
+   Scanner_p        in;
+   PStack_p         sides, subterms, pairs;
+   BenchMeasureCell m[] =
+      {{"TBInsert(new)"},   {"TBInsert(existing)"},
+       {"SubstComputeMgu"}, {"SubstComputeMatch"},
+       {"FPIndexInsert"},   {"FPIndexFindUnifiable"},
+       {"PDTreeInsert"},    {"PDTreeFindNextDemod"},
+       {"FVIndexInsert"}};
+   int              i;
+
+   assert(argv[0]);
+   InitIO(argv[0]);
+
+   state = process_options(argc, argv);
+   proofstate = ProofStateAlloc(FPIgnoreProps);
+   if(state->argc ==  0)
+   {
+      gen_clauses(proofstate->axioms, proofstate->terms);
+   }
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL, true);
+      ScannerSetFormat(in, AutoFormat);
+      ClauseSetParseList(in, proofstate->axioms, proofstate->terms);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   if(problemType == PROBLEM_HO)
+   {
+      Error("Only first-order problems are supported", USAGE_ERROR);
+   }
+   SetProblemType(PROBLEM_FO);
+   h_parms = HeuristicParmsAlloc();
+   ocb     = TOSelectOrdering(proofstate, h_parms, NULL);
+
+   sides    = PStackAlloc();
+   subterms = PStackAlloc();
+   pairs    = PStackAlloc();
+   collect_corpus(proofstate->axioms, sides, subterms, pairs);
+   cache_counter_open();
+
+   printf("# %ld clauses, %ld sides, %ld subterms, %ld rounds\n",
+          proofstate->axioms->members, (long)PStackGetSP(sides),
+          (long)PStackGetSP(subterms), rounds);
+   printf("# %-22s %10s %10s %10s %10s %10s %12s\n",
+          "primitive", "ops", "ns/op", "cells/op", "mallocs/op",
+          "misses/op", "check");
+   fflush(stdout);
+
+   if(bench_selected("TBInsert"))
+   {
+      bench_tbinsert(proofstate->terms, sides, &m[0], &m[1]);
+      bench_print(stdout, &m[0]);
+      bench_print(stdout, &m[1]);
+   }
+   if(bench_selected("SubstCompute"))
+   {
+      bench_unif(pairs, &m[2], &m[3]);
+      bench_print(stdout, &m[2]);
+      bench_print(stdout, &m[3]);
+   }
+   if(bench_selected("FPIndex"))
+   {
+      bench_fpindex(proofstate->signature, sides, subterms, &m[4], &m[5]);
+      bench_print(stdout, &m[4]);
+      bench_print(stdout, &m[5]);
+   }
+   if(bench_selected("PDTree"))
+   {
+      bench_pdtree(ocb, proofstate->terms, proofstate->axioms, subterms,
+                   &m[6], &m[7]);
+      bench_print(stdout, &m[6]);
+      bench_print(stdout, &m[7]);
+   }
+   if(bench_selected("FVIndex"))
+   {
+      bench_fvindex(proofstate->signature, proofstate->axioms, &m[8]);
+      bench_print(stdout, &m[8]);
+   }
+
+   if(perf_fd >= 0)
+   {
+      close(perf_fd);
+   }
+   PStackFree(sides);
+   PStackFree(subterms);
+   PStackFree(pairs);
+   OCBFree(ocb);
+   HeuristicParmsFree(h_parms);
+   ProofStateFree(proofstate);
+   CLStateFree(state);
+
+   return NO_ERROR;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, size, depth, symbols, seed, rounds, bench,
+//                   fp_index
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_SIZE:
+            size = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_DEPTH:
+            depth = CLStateGetIntArgCheckRange(handle, arg, 1, 64);
+            break;
+      case OPT_SYMBOLS:
+            symbols = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_SEED:
+            seed = CLStateGetIntArgCheckRange(handle, arg, 0, LONG_MAX);
+            break;
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_BENCH:
+            bench = arg;
+            break;
+      case OPT_FP_INDEX:
+            if(!GetFPIndexFunction(arg) || strcmp(arg, "NoIndex")==0)
+            {
+               Error("Option --fp-index requires a valid fingerprint "
+                     "function name", USAGE_ERROR);
+            }
+            fp_index = arg;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+Usage: bench_primitives [options] [files]\n\
+\n\
+Run the term bank, unification, matching and indexing primitives over\n\
+a clause corpus and report time, allocations and cache misses per\n\
+operation. If no files are given, a random corpus is generated.\n\
+The check column is a checksum of the results (e.g. the number of\n\
+unifiable pairs) that should not change with optimizations.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
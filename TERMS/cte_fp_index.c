@@ -18,6 +18,8 @@ Changes
 
 <1> Sun Feb 28 22:49:34 CET 2010
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    Adaptive indices with bucket leaves
 
 -----------------------------------------------------------------------*/
 
@@ -131,6 +133,530 @@ static FPTree_p fpindex_extract_alt(FPTree_p index, FunCode f_code)
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_alloc()
+//
+//   Allocate an empty bucket.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static FPBucket_p fp_bucket_alloc(void)
+{
+   FPBucket_p handle = FPBucketCellAlloc();
+
+   handle->size     = 0;
+   handle->capacity = 0;
+   handle->terms    = NULL;
+   handle->samples  = NULL;
+   handle->slots    = NULL;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_free()
+//
+//   Free a bucket, but not the slots it refers to.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fp_bucket_free(FPBucket_p junk)
+{
+   if(junk->capacity)
+   {
+      SizeFree(junk->terms, junk->capacity*sizeof(Term_p));
+      SizeFree(junk->samples, junk->capacity*FP_ADAPT_SAMPLES*sizeof(FPSample));
+      SizeFree(junk->slots, junk->capacity*sizeof(FPTree_p));
+   }
+   FPBucketCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_append()
+//
+//   Append an entry for term with the given samples (1..n of the
+//   fingerprint) and slot to bucket.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fp_bucket_append(FPBucket_p bucket, Term_p term,
+                             FPSample *samples, FPTree_p slot)
+{
+   if(bucket->size == bucket->capacity)
+   {
+      long     new_cap = bucket->capacity? 2*bucket->capacity : 4;
+      Term_p   *terms = SizeMalloc(new_cap*sizeof(Term_p));
+      FPSample *new_samples = SizeMalloc(new_cap*FP_ADAPT_SAMPLES*sizeof(FPSample));
+      FPTree_p *slots = SizeMalloc(new_cap*sizeof(FPTree_p));
+
+      if(bucket->capacity)
+      {
+         memcpy(terms, bucket->terms, bucket->size*sizeof(Term_p));
+         memcpy(new_samples, bucket->samples,
+                bucket->size*FP_ADAPT_SAMPLES*sizeof(FPSample));
+         memcpy(slots, bucket->slots, bucket->size*sizeof(FPTree_p));
+         SizeFree(bucket->terms, bucket->capacity*sizeof(Term_p));
+         SizeFree(bucket->samples,
+                  bucket->capacity*FP_ADAPT_SAMPLES*sizeof(FPSample));
+         SizeFree(bucket->slots, bucket->capacity*sizeof(FPTree_p));
+      }
+      bucket->terms    = terms;
+      bucket->samples  = new_samples;
+      bucket->slots    = slots;
+      bucket->capacity = new_cap;
+   }
+   bucket->terms[bucket->size] = term;
+   memcpy(&(bucket->samples[bucket->size*FP_ADAPT_SAMPLES]), samples,
+          FP_ADAPT_SAMPLES*sizeof(FPSample));
+   bucket->slots[bucket->size] = slot;
+   bucket->size++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_remove()
+//
+//   Remove entry i from bucket by moving the last entry into its
+//   place.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void fp_bucket_remove(FPBucket_p bucket, long i)
+{
+   assert(i < bucket->size);
+
+   bucket->size--;
+   if(i != bucket->size)
+   {
+      bucket->terms[i] = bucket->terms[bucket->size];
+      memcpy(&(bucket->samples[i*FP_ADAPT_SAMPLES]),
+             &(bucket->samples[bucket->size*FP_ADAPT_SAMPLES]),
+             FP_ADAPT_SAMPLES*sizeof(FPSample));
+      bucket->slots[i] = bucket->slots[bucket->size];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_find()
+//
+//   Return the position of term in bucket, or -1.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fp_bucket_find(FPBucket_p bucket, Term_p term)
+{
+   long i;
+
+   for(i=0; i<bucket->size; i++)
+   {
+      if(bucket->terms[i] == term)
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_split()
+//
+//   Turn the bucket leaf node into an inner node branching on sample
+//   current, with one new bucket leaf per occuring sample value.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes the index
+//
+/----------------------------------------------------------------------*/
+
+static void fp_bucket_split(FPTree_p node, int current)
+{
+   FPBucket_p bucket = node->bucket;
+   FPSample   *samples;
+   FPTree_p   *pos;
+   long       i;
+
+   assert(current <= FP_ADAPT_SAMPLES);
+
+   node->bucket = NULL;
+   for(i=0; i<bucket->size; i++)
+   {
+      samples = &(bucket->samples[i*FP_ADAPT_SAMPLES]);
+      pos = fpindex_alternative_ref(node, samples[current-1]);
+      if(!*pos)
+      {
+         *pos = FPTreeAlloc();
+         (*pos)->bucket = fp_bucket_alloc();
+         node->count++;
+      }
+      fp_bucket_append((*pos)->bucket, bucket->terms[i], samples,
+                       bucket->slots[i]);
+   }
+   fp_bucket_free(bucket);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_adapt_insert()
+//
+//   Return the slot for term (with fingerprint key) in the adaptive
+//   index at root, creating it if necessary. Full buckets are split
+//   on the way, as long as there are unused samples.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes the index
+//
+/----------------------------------------------------------------------*/
+
+static FPTree_p fp_adapt_insert(FPTree_p root, IndexFP_p key, Term_p term)
+{
+   FPTree_p node = root, *pos, res;
+   FPSample samples[FP_ADAPT_SAMPLES];
+   int      current = 1;
+   long     i;
+
+   assert(key[0] == FP_ADAPT_SAMPLES+1);
+
+   while(true)
+   {
+      if(!node->bucket)
+      {
+         pos = fpindex_alternative_ref(node, key[current]);
+         if(!*pos)
+         {
+            *pos = FPTreeAlloc();
+            (*pos)->bucket = fp_bucket_alloc();
+            node->count++;
+         }
+         node = *pos;
+         current++;
+         continue;
+      }
+      i = fp_bucket_find(node->bucket, term);
+      if(i != -1)
+      {
+         return node->bucket->slots[i];
+      }
+      if(node->bucket->size >= FP_ADAPT_BUCKET_SIZE && current < key[0])
+      {
+         fp_bucket_split(node, current);
+         continue;
+      }
+      break;
+   }
+   for(i=0; i<FP_ADAPT_SAMPLES; i++)
+   {
+      assert(key[i+1] >= INT_MIN && key[i+1] <= INT_MAX);
+      samples[i] = key[i+1];
+   }
+   res = FPTreeAlloc();
+   fp_bucket_append(node->bucket, term, samples, res);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_adapt_find()
+//
+//   Return the slot for term (with fingerprint key) in the adaptive
+//   index at root, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static FPTree_p fp_adapt_find(FPTree_p root, IndexFP_p key, Term_p term)
+{
+   FPTree_p node = root;
+   int      current = 1;
+   long     i;
+
+   while(node && !node->bucket)
+   {
+      node = fpindex_alternative(node, key[current]);
+      current++;
+   }
+   if(!node)
+   {
+      return NULL;
+   }
+   i = fp_bucket_find(node->bucket, term);
+   return (i == -1)? NULL : node->bucket->slots[i];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_adapt_rek_delete()
+//
+//   Remove the slot for term from the adaptive index at node if it
+//   has no payload, and delete nodes that became empty. Return true
+//   if node itself should be deleted.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes the index
+//
+/----------------------------------------------------------------------*/
+
+static bool fp_adapt_rek_delete(FPTree_p node, IndexFP_p key, Term_p term,
+                                int current)
+{
+   FPTree_p junk;
+   long     i;
+
+   if(!node)
+   {
+      return false;
+   }
+   if(node->bucket)
+   {
+      i = fp_bucket_find(node->bucket, term);
+      if(i != -1 && !node->bucket->slots[i]->payload)
+      {
+         FPTreeCellFree(node->bucket->slots[i]);
+         fp_bucket_remove(node->bucket, i);
+      }
+      return node->bucket->size == 0;
+   }
+   if(fp_adapt_rek_delete(fpindex_alternative(node, key[current]),
+                          key, term, current+1))
+   {
+      junk = fpindex_extract_alt(node, key[current]);
+      if(junk->bucket)
+      {
+         fp_bucket_free(junk->bucket);
+      }
+      if(junk->f_alternatives)
+      {
+         IntMapFree(junk->f_alternatives);
+      }
+      FPTreeCellFree(junk);
+   }
+   return node->count==0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_unif_compatible()
+//
+//   Return true if a term with sample value stored at a position may
+//   unify with a query term with sample value query there. This
+//   follows fp_index_rek_find_unif() below.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline bool fp_unif_compatible(Sig_p sig, FunCode query,
+                                      FunCode stored)
+{
+   if(query > 0)
+   {
+      return stored == query ||
+         ((stored == ANY_VAR || stored == BELOW_VAR) &&
+          SigSymbolUnifiesWithVar(sig, query));
+   }
+   if(query == NOT_IN_TERM)
+   {
+      return stored == NOT_IN_TERM || stored == BELOW_VAR;
+   }
+   if(stored < NOT_IN_TERM)
+   {
+      return true;
+   }
+   if(stored == NOT_IN_TERM)
+   {
+      return query == BELOW_VAR;
+   }
+   return SigSymbolUnifiesWithVar(sig, stored);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_match_compatible()
+//
+//   Return true if a term with sample value stored at a position may
+//   be an instance of a query term with sample value query
+//   there. This follows fp_index_rek_find_matchable() below.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline bool fp_match_compatible(Sig_p sig, FunCode query,
+                                       FunCode stored)
+{
+   if(query >= NOT_IN_TERM)
+   {
+      return stored == query;
+   }
+   if(stored == ANY_VAR)
+   {
+      return true;
+   }
+   if(stored <= NOT_IN_TERM)
+   {
+      return query == BELOW_VAR;
+   }
+   return SigSymbolUnifiesWithVar(sig, stored);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_find_unif()
+//
+//   Push the payloads of all entries in bucket that are
+//   unification-compatible with key in the samples from current
+//   on. Return number of payloads pushed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fp_bucket_find_unif(FPBucket_p bucket, IndexFP_p key,
+                                Sig_p sig, int current, PStack_p collect)
+{
+   FPSample *samples;
+   long     i, res = 0;
+   int      j;
+
+   for(i=0; i<bucket->size; i++)
+   {
+      samples = &(bucket->samples[i*FP_ADAPT_SAMPLES]);
+      for(j=current; j<key[0]; j++)
+      {
+         if(!fp_unif_compatible(sig, key[j], samples[j-1]))
+         {
+            break;
+         }
+      }
+      if(j==key[0])
+      {
+         PStackPushP(collect, bucket->slots[i]->payload);
+         res++;
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_bucket_find_matchable()
+//
+//   Push the payloads of all entries in bucket that are
+//   match-compatible with key in the samples from current on. Return
+//   number of payloads pushed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fp_bucket_find_matchable(FPBucket_p bucket, IndexFP_p key,
+                                     Sig_p sig, int current,
+                                     PStack_p collect)
+{
+   FPSample *samples;
+   long     i, res = 0;
+   int      j;
+
+   for(i=0; i<bucket->size; i++)
+   {
+      samples = &(bucket->samples[i*FP_ADAPT_SAMPLES]);
+      for(j=current; j<key[0]; j++)
+      {
+         if(!fp_match_compatible(sig, key[j], samples[j-1]))
+         {
+            break;
+         }
+      }
+      if(j==key[0])
+      {
+         PStackPushP(collect, bucket->slots[i]->payload);
+         res++;
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_leaf_terms()
+//
+//   Return the number of terms stored at a leaf.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long fp_leaf_terms(FPTree_p leaf)
+{
+   long i, res = 0;
+
+   if(!leaf->bucket)
+   {
+      return PObjTreeNodes(leaf->payload);
+   }
+   for(i=0; i<leaf->bucket->size; i++)
+   {
+      res += PObjTreeNodes(leaf->bucket->slots[i]->payload);
+   }
+   return res;
+}
+
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: fpindex_rek_delete()
@@ -201,6 +727,10 @@ static long fp_index_rek_find_unif(FPTree_p index, IndexFP_p key,
    {
       return 0;
    }
+   if(index->bucket)
+   {
+      return fp_bucket_find_unif(index->bucket, key, sig, current, collect);
+   }
    if(current == key[0])
    {
       PStackPushP(collect, index->payload);
@@ -316,6 +846,10 @@ static long fp_index_rek_find_matchable(FPTree_p index, IndexFP_p key,
    {
       return 0;
    }
+   if(index->bucket)
+   {
+      return fp_bucket_find_matchable(index->bucket, key, sig, current, collect);
+   }
    if(current == key[0])
    {
       PStackPushP(collect, index->payload);
@@ -409,7 +943,7 @@ void fp_index_leaf_prt_size(FILE* out, PStack_p stack, FPTree_p leaf)
    long tmp;
    fprintf(out, "# ");
    PStackPrintInt(out, "%4ld.", stack);
-   tmp =  PObjTreeNodes(leaf->payload);
+   tmp =  fp_leaf_terms(leaf);
    fprintf(out, ":%ld terms\n", tmp);
 }
 
@@ -438,10 +972,10 @@ static long fp_index_tree_print(FILE* out,
    long         i=0;
    FPTree_p    child;
 
-   if(index->payload)
+   if(index->payload || (index->bucket && index->bucket->size))
    {
       res++;
-      tmp =  PObjTreeNodes(index->payload);
+      tmp =  fp_leaf_terms(index);
       *entries += tmp;
       prtfun(out, stack, index);
    }
@@ -486,9 +1020,9 @@ long fp_index_tree_collect_distrib(FPTree_p index, PStack_p stack)
    FPTree_p     child;
    long         res = 1;
 
-   if(index->payload)
+   if(index->payload || (index->bucket && index->bucket->size))
    {
-      PStackPushInt(stack, PObjTreeNodes(index->payload));
+      PStackPushInt(stack, fp_leaf_terms(index));
    }
    if(index->f_alternatives)
    {
@@ -617,6 +1151,13 @@ void fp_index_tree_print_edges(FILE* out, FPTree_p index,
    long         i = 0;
    FPTree_p    child;
 
+   if(index->bucket)
+   {
+      for(i=0; i<index->bucket->size; i++)
+      {
+         fprintf(out, "   l%p -- l%p\n", index, index->bucket->slots[i]);
+      }
+   }
    if(index->f_alternatives)
    {
       iter = IntMapIterAlloc(index->f_alternatives, BELOW_VAR, LONG_MAX);
@@ -648,7 +1189,14 @@ void fp_index_collect_leaves(FPTree_p index, PStack_p result)
    long         i = 0;
    FPTree_p    child;
 
-   if(index->f_alternatives)
+   if(index->bucket)
+   {
+      for(i=0; i<index->bucket->size; i++)
+      {
+         PStackPushP(result, index->bucket->slots[i]);
+      }
+   }
+   else if(index->f_alternatives)
    {
       iter = IntMapIterAlloc(index->f_alternatives, BELOW_VAR, LONG_MAX);
       while((child=IntMapIterNext(iter, &i)))
@@ -938,6 +1486,7 @@ FPTree_p FPTreeAlloc(void)
    handle->f_alternatives = NULL;
    handle->count          = 0;
    handle->payload        = NULL;
+   handle->bucket         = NULL;
 
    return handle;
 }
@@ -965,6 +1514,14 @@ void FPTreeFree(FPTree_p index, FPTreeFreeFun payload_free)
    {
       payload_free(index->payload);
    }
+   if(index->bucket)
+   {
+      for(i=0; i<index->bucket->size; i++)
+      {
+         FPTreeFree(index->bucket->slots[i], payload_free);
+      }
+      fp_bucket_free(index->bucket);
+   }
    if(index->f_alternatives)
    {
       iter = IntMapIterAlloc(index->f_alternatives, BELOW_VAR, LONG_MAX);
@@ -1133,6 +1690,10 @@ FPIndex_p FPIndexAlloc(FPIndexFunction fp_fun,
    handle->sig          = sig;
    handle->payload_free = payload_free;
    handle->index        = FPTreeAlloc();
+   if(FPIndexIsAdaptive(handle))
+   {
+      handle->index->bucket = fp_bucket_alloc();
+   }
 
    return handle;
 }
@@ -1172,7 +1733,16 @@ void FPIndexFree(FPIndex_p index)
 FPTree_p FPIndexFind(FPIndex_p index, Term_p term)
 {
    IndexFP_p key = index->fp_fun(term);
-   FPTree_p res = FPTreeFind(index->index, key);
+   FPTree_p res;
+
+   if(FPIndexIsAdaptive(index))
+   {
+      res = fp_adapt_find(index->index, key, term);
+   }
+   else
+   {
+      res = FPTreeFind(index->index, key);
+   }
 
    IndexFPFree(key);
    return res;
@@ -1193,7 +1763,16 @@ FPTree_p FPIndexFind(FPIndex_p index, Term_p term)
 FPTree_p  FPIndexInsert(FPIndex_p index, Term_p term)
 {
    IndexFP_p key = index->fp_fun(term);
-   FPTree_p res = FPTreeInsert(index->index, key);
+   FPTree_p res;
+
+   if(FPIndexIsAdaptive(index))
+   {
+      res = fp_adapt_insert(index->index, key, term);
+   }
+   else
+   {
+      res = FPTreeInsert(index->index, key);
+   }
 
    IndexFPFree(key);
    return res;
@@ -1217,7 +1796,18 @@ void FPIndexDelete(FPIndex_p index, Term_p term)
 {
    IndexFP_p key = index->fp_fun(term);
 
-   FPTreeDelete(index->index, key);
+   if(FPIndexIsAdaptive(index))
+   {
+      fp_adapt_rek_delete(index->index, key, term, 1);
+      if(!index->index->bucket && !index->index->count)
+      {
+         index->index->bucket = fp_bucket_alloc();
+      }
+   }
+   else
+   {
+      FPTreeDelete(index->index, key);
+   }
    IndexFPFree(key);
 }
 
@@ -1392,6 +1982,71 @@ void FPIndexDistribDataPrint(FILE* out, FPIndex_p index)
            nodes, leaves, avg, stddev);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: FPIndexCollectOccupancy()
+//
+//   Push the number of terms stored at each leaf of the index onto
+//   occupancy. Return the number of nodes (not counting the slots of
+//   adaptive indices).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long FPIndexCollectOccupancy(FPIndex_p index, PStack_p occupancy)
+{
+   return fp_index_tree_collect_distrib(index->index, occupancy);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FPIndexOccupancyPrint()
+//
+//   Print a histogram of the number of terms per leaf, in classes
+//   of powers of 2.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void FPIndexOccupancyPrint(FILE* out, FPIndex_p index)
+{
+   PStack_p      occupancy = PStackAlloc();
+   long          classes[64] = {0};
+   long          nodes, terms = 0, max = 0, size, lo;
+   int           cls, max_cls = 0;
+   PStackPointer i;
+
+   nodes = FPIndexCollectOccupancy(index, occupancy);
+   for(i=0; i<PStackGetSP(occupancy); i++)
+   {
+      size = PStackElementInt(occupancy, i);
+      terms += size;
+      max = MAX(max, size);
+      for(cls = 0, lo = size; lo > 1; lo /= 2)
+      {
+         cls++;
+      }
+      classes[cls]++;
+      max_cls = MAX(max_cls, cls);
+   }
+   fprintf(out, "#   %ld nodes, %ld leaves, %ld terms, at most %ld terms/leaf\n",
+           nodes, (long)PStackGetSP(occupancy), terms, max);
+   for(cls = 0, lo = 1; PStackGetSP(occupancy) && cls <= max_cls; cls++, lo *= 2)
+   {
+      fprintf(out, "#   %6ld-%-6ld terms: %ld leaves\n",
+              lo, 2*lo-1, classes[cls]);
+   }
+   PStackFree(occupancy);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: FPIndexPrint()
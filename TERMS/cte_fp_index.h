@@ -10,6 +10,12 @@ Contents
   samples of symbols at different positions. The index is a try build
   over these vectors.
 
+  Indices using IndexFPAdaptCreate() are adaptive: Leaves are buckets
+  that store terms with their complete fingerprints in contiguous
+  arrays, and a bucket is only split on the next sample once it holds
+  more than FP_ADAPT_BUCKET_SIZE terms. Crowded regions of the term
+  space are thus indexed deeper than sparse ones.
+
   Copyright 2010 by the author.
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -20,6 +26,8 @@ Changes
 
 <1> Sat Feb 20 19:19:23 EET 2010
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    Adaptive indices with bucket leaves
 
 -----------------------------------------------------------------------*/
 
@@ -54,9 +62,29 @@ typedef struct fp_index_cell
    //struct fp_index_cell *any_var;
    long                 count;
    PObjTree_p           payload;
+   struct fp_bucket_cell *bucket;         /* Only in adaptive indices */
 }FPTreeCell, *FPTree_p;
 
 
+/* Leaf of an adaptive index. Entry i is the term terms[i], with the
+ * samples 1..FP_ADAPT_SAMPLES of its fingerprint at
+ * samples[i*FP_ADAPT_SAMPLES...], and the node slots[i] that carries
+ * the payload of the term (and that is returned to the user). */
+
+#define FP_ADAPT_BUCKET_SIZE 16
+
+typedef int FPSample;  /* Samples are small, and this halves the size */
+
+typedef struct fp_bucket_cell
+{
+   long     size;
+   long     capacity;
+   Term_p   *terms;
+   FPSample *samples;
+   FPTree_p *slots;
+}FPBucketCell, *FPBucket_p;
+
+
 typedef void (*FPTreeFreeFun)(void*);
 
 
@@ -86,6 +114,9 @@ PERF_CTR_DECL(IndexMatchTimer);
 #define FPTreeCellAlloc() (FPTreeCell*)SizeMalloc(sizeof(FPTreeCell))
 #define FPTreeCellFree(junk)         SizeFree(junk, sizeof(FPTreeCell))
 
+#define FPBucketCellAlloc() (FPBucketCell*)SizeMalloc(sizeof(FPBucketCell))
+#define FPBucketCellFree(junk)         SizeFree(junk, sizeof(FPBucketCell))
+
 
 FPTree_p FPTreeAlloc(void);
 void     FPTreeFree(FPTree_p index, FPTreeFreeFun payload_free);
@@ -113,6 +144,8 @@ FPIndex_p FPIndexAlloc(FPIndexFunction fp_fun, Sig_p sig,
                        FPTreeFreeFun payload_free);
 void      FPIndexFree(FPIndex_p index);
 
+#define   FPIndexIsAdaptive(index) ((index)->fp_fun == IndexFPAdaptCreate)
+
 FPTree_p FPIndexFind(FPIndex_p index, Term_p term);
 FPTree_p  FPIndexInsert(FPIndex_p index, Term_p term);
 void      FPIndexDelete(FPIndex_p index, Term_p term);
@@ -122,6 +155,8 @@ long      FPIndexFindMatchable(FPIndex_p index, Term_p term, PStack_p collect);
 
 void      FPIndexDistribPrint(FILE* out, FPIndex_p index);
 void      FPIndexDistribDataPrint(FILE* out, FPIndex_p index);
+long      FPIndexCollectOccupancy(FPIndex_p index, PStack_p occupancy);
+void      FPIndexOccupancyPrint(FILE* out, FPIndex_p index);
 
 void      FPIndexPrint(FILE* out, FPIndex_p index, FPLeafPrintFun prtfun);
 long      FPIndexCollectLeaves(FPIndex_p index, PStack_p result);
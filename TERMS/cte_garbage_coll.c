@@ -60,6 +60,7 @@ GCAdmin_p GCAdminAlloc()
 
    handle->clause_sets  = NULL;
    handle->formula_sets = NULL;
+   handle->nf_caches    = NULL;
 
    return handle;
 }
@@ -81,8 +82,9 @@ void GCAdminFree(GCAdmin_p junk)
 {
    assert(junk);
 
-   PTreeFree(junk->clause_sets);
-   PTreeFree(junk->formula_sets);
+   PBTreeFree(junk->clause_sets);
+   PBTreeFree(junk->formula_sets);
+   PBTreeFree(junk->nf_caches);
 
    GCAdminCellFree(junk);
 }
@@ -96,7 +98,7 @@ void GCAdminFree(GCAdmin_p junk)
 //
 // Global Variables: -
 //
-// Side Effects    : Via PTReeStore()
+// Side Effects    : Via PBTreeStore()
 //
 /----------------------------------------------------------------------*/
 
@@ -105,7 +107,7 @@ void GCRegisterFormulaSet(GCAdmin_p gc, void* set)
    assert(gc);
    assert(set);
    //printf("# GCRegisterFormulaSet(%p, %p)\n", gc, set);
-   PTreeStore(&(gc->formula_sets), set);
+   PBTreeStore(&(gc->formula_sets), set);
 }
 
 
@@ -117,7 +119,7 @@ void GCRegisterFormulaSet(GCAdmin_p gc, void* set)
 //
 // Global Variables: -
 //
-// Side Effects    : Via PTReeStore()
+// Side Effects    : Via PBTreeStore()
 //
 /----------------------------------------------------------------------*/
 
@@ -126,7 +128,7 @@ void GCRegisterClauseSet(GCAdmin_p gc, void* set)
    assert(gc);
    assert(set);
    //printf("# GCRegisterClauseSet(%p, %p)\n", gc, set);
-   PTreeStore(&(gc->clause_sets), set);
+   PBTreeStore(&(gc->clause_sets), set);
 }
 
 
@@ -138,7 +140,7 @@ void GCRegisterClauseSet(GCAdmin_p gc, void* set)
 //
 // Global Variables: -
 //
-// Side Effects    : Via PTreeDeleteEntry()
+// Side Effects    : Via PBTreeDeleteEntry()
 //
 /----------------------------------------------------------------------*/
 
@@ -147,7 +149,7 @@ void GCDeregisterFormulaSet(GCAdmin_p gc, void* set)
    assert(gc);
    assert(set);
    //printf("# GCDeregisterFormulaSet(%p, %p)\n", gc, set);
-   PTreeDeleteEntry(&(gc->formula_sets), set);
+   PBTreeDeleteEntry(&(gc->formula_sets), set);
 }
 
 
@@ -159,7 +161,7 @@ void GCDeregisterFormulaSet(GCAdmin_p gc, void* set)
 //
 // Global Variables: -
 //
-// Side Effects    : Via PTreeDeleteEntry()
+// Side Effects    : Via PBTreeDeleteEntry()
 //
 /----------------------------------------------------------------------*/
 
@@ -169,7 +171,48 @@ void GCDeregisterClauseSet(GCAdmin_p gc, void* set)
    assert(set);
 
    //printf("# GCDeregisterClauseSet(%p, %p)\n", gc, set);
-   PTreeDeleteEntry(&(gc->clause_sets), set);
+   PBTreeDeleteEntry(&(gc->clause_sets), set);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCRegisterNFCache()
+//
+//   Register a normal form cache whose entries have to survive
+//   garbage collection.
+//
+// Global Variables: -
+//
+// Side Effects    : Via PBTreeStore()
+//
+/----------------------------------------------------------------------*/
+
+void GCRegisterNFCache(GCAdmin_p gc, void* cache)
+{
+   assert(gc);
+   assert(cache);
+   PBTreeStore(&(gc->nf_caches), cache);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCDeregisterNFCache()
+//
+//   Unregister a normal form cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Via PBTreeDeleteEntry()
+//
+/----------------------------------------------------------------------*/
+
+void GCDeregisterNFCache(GCAdmin_p gc, void* cache)
+{
+   assert(gc);
+   assert(cache);
+   PBTreeDeleteEntry(&(gc->nf_caches), cache);
 }
 
 
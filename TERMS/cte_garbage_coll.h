@@ -27,6 +27,7 @@
 
 
 #include <clb_ptrees.h>
+#include <clb_btrees.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -36,8 +37,9 @@
 
 typedef struct gc_admin_cell
 {
-   PTree_p clause_sets;
-   PTree_p formula_sets;
+   PBTree_p clause_sets;
+   PBTree_p formula_sets;
+   PBTree_p nf_caches;    /* Normal form caches pinning terms */
 }GCAdminCell, *GCAdmin_p;
 
 
@@ -56,6 +58,8 @@ void      GCRegisterFormulaSet(GCAdmin_p gc, void* set);
 void      GCRegisterClauseSet(GCAdmin_p gc, void* set);
 void      GCDeregisterFormulaSet(GCAdmin_p gc, void *set);
 void      GCDeregisterClauseSet(GCAdmin_p gc, void* set);
+void      GCRegisterNFCache(GCAdmin_p gc, void* cache);
+void      GCDeregisterNFCache(GCAdmin_p gc, void* cache);
 
 //long      GCCollect(GCAdmin_p gc);
 
@@ -41,6 +41,8 @@ const StateTag_t DECOMPOSED_VAR = 3;
 
 #define BT_STEP_SIZE 4
 
+typedef struct csu_cache_entry CSUCacheEntryCell, *CSUCacheEntry_p;
+
 struct csu_iter 
 {
    PQueue_p constraints; // pairs of terms to unify
@@ -61,6 +63,15 @@ struct csu_iter
    PStack_p tmp_rigid_diff;
    PStack_p tmp_rigid_same;
    PStack_p tmp_flex;
+
+   // memoization of the unifier stream (NULL if not cached)
+   CSUCacheEntry_p cache_entry;
+   // unifiers of the cache entry already returned by this iterator
+   long replayed;
+   PStackPointer replay_pos;
+   // unifiers a restarted search passes over, as they have already
+   // been replayed
+   long skip;
 #ifndef NDEBUG
    Term_p orig_lhs;
    Term_p orig_rhs;
@@ -70,17 +81,66 @@ struct csu_iter
 #define GET_HEAD_ID(t) (TermIsPhonyApp(t) ? (t)->args[0]->f_code : (t)->f_code)
 #define CSUIterAlloc() (SizeMalloc(sizeof(struct csu_iter)))
 
+// Unifiers found for a pair of (shared) terms are stored as records
+// [number of bindings, cost in usec, number of fresh variables,
+// fresh1, fresh2, ..., var1, bind1, var2, bind2, ...]. The fresh
+// variables are those introduced by the search. The variable counters
+// are reset between searches, so they may have become clause
+// variables by the time the record is replayed, and are renamed
+// then. For the same reason, no search state is kept: If a stream
+// has to be extended, the search is restarted and passes over the
+// recorded unifiers.
+#define CSU_REC_HEADER 3
+#define CSU_ENTRY_STACK_SIZE 16
+
+struct csu_cache_entry
+{
+   Term_p          lhs;
+   Term_p          rhs;
+   PStack_p        unifiers;
+   long            unif_no;
+   bool            exhausted;
+   long long       fail_cost;
+   bool            in_use;
+   bool            dropped;
+   long            mem;
+   CSUCacheEntry_p pred;
+   CSUCacheEntry_p succ;
+};
+
+#define CSUCacheEntryCellAlloc() \
+   (CSUCacheEntryCell*)SizeMalloc(sizeof(CSUCacheEntryCell))
+#define CSUCacheEntryCellFree(junk) \
+   SizeFree(junk, sizeof(CSUCacheEntryCell))
+
+typedef struct csu_cache
+{
+   PObjTree_p        entries;
+   CSUCacheEntryCell lru_anchor;
+   TB_p              bank;
+   unsigned long     gc_sweeps;
+   long              mem;
+   long              lookups;
+   long              hits;
+   long              replayed;
+   long              restarted;
+   long              evicted;
+   long long         time_saved;
+}CSUCacheCell;
+
 /*---------------------------------------------------------------------*/
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
 static HeuristicParms_p params = NULL;
+static CSUCacheCell     csu_cache;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
 
 bool backtrack_iter(CSUIterator_p iter);
+void iter_free(CSUIterator_p iter);
 
 /*---------------------------------------------------------------------*/
 /*                         Internal Functions                          */
@@ -501,6 +561,414 @@ bool backtrack_iter(CSUIterator_p iter)
    return res;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: iter_free()
+//
+//   Free the iterator and its search state without touching the
+//   substitution.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void iter_free(CSUIterator_p iter)
+{
+   PStackPointer i = PStackGetSP(iter->backtrack_info);
+   while(i>=BT_STEP_SIZE)
+   {
+      PQueueFree(PStackElementP(iter->backtrack_info, i-4));
+      i-=4;
+   }
+   PStackFree(iter->backtrack_info);
+   PQueueFree(iter->constraints);
+   PStackFree(iter->tmp_rigid_diff);
+   PStackFree(iter->tmp_rigid_same);
+   PStackFree(iter->tmp_flex);
+   SizeFree(iter, sizeof(CSUIterator_t));
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_cache_entries()
+//
+//   Compare two cache entries by the addresses of the (shared) terms
+//   they are indexed by.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+int cmp_cache_entries(const void* e1, const void* e2)
+{
+   const CSUCacheEntryCell *entry1 = e1, *entry2 = e2;
+   int res = PCmp(entry1->lhs, entry2->lhs);
+
+   if(!res)
+   {
+      res = PCmp(entry1->rhs, entry2->rhs);
+   }
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: lru_unlink()
+//
+//   Remove the entry from the LRU list of the cache.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void lru_unlink(CSUCacheEntry_p entry)
+{
+   entry->pred->succ = entry->succ;
+   entry->succ->pred = entry->pred;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: lru_insert_first()
+//
+//   Make the entry the most recently used one.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void lru_insert_first(CSUCacheEntry_p entry)
+{
+   CSUCacheEntry_p anchor = &(csu_cache.lru_anchor);
+
+   entry->pred = anchor;
+   entry->succ = anchor->succ;
+   anchor->succ->pred = entry;
+   anchor->succ = entry;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: entry_free()
+//
+//   Free a cache entry.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void entry_free(CSUCacheEntry_p entry)
+{
+   PStackFree(entry->unifiers);
+   CSUCacheEntryCellFree(entry);
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: entry_update_mem()
+//
+//   Recompute the memory estimate of the entry and update the total
+//   of the cache accordingly.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void entry_update_mem(CSUCacheEntry_p entry)
+{
+   long mem = sizeof(CSUCacheEntryCell) + sizeof(PStackCell) +
+      entry->unifiers->size*sizeof(IntOrP);
+
+   if(!entry->dropped)
+   {
+      csu_cache.mem += mem - entry->mem;
+   }
+   entry->mem = mem;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_drop_entry()
+//
+//   Remove the entry from the cache. If it is currently iterated, it
+//   is only marked and freed by CSUIterDestroy().
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void cache_drop_entry(CSUCacheEntry_p entry)
+{
+   PTreeObjExtractObject(&csu_cache.entries, entry, cmp_cache_entries);
+   lru_unlink(entry);
+   csu_cache.mem -= entry->mem;
+   if(entry->in_use)
+   {
+      entry->dropped = true;
+   }
+   else
+   {
+      entry_free(entry);
+   }
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_flush()
+//
+//   Drop all entries of the cache.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void cache_flush(void)
+{
+   CSUCacheEntry_p anchor = &(csu_cache.lru_anchor);
+
+   while(anchor->succ != anchor)
+   {
+      cache_drop_entry(anchor->succ);
+   }
+   assert(!csu_cache.entries);
+   assert(csu_cache.mem == 0);
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_enforce_budget()
+//
+//   Evict least recently used entries until the cache fits into
+//   params->csu_cache_mem MB again.
+//
+// Global Variables: csu_cache, params
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void cache_enforce_budget(void)
+{
+   CSUCacheEntry_p anchor = &(csu_cache.lru_anchor), entry, pred;
+   long budget = params->csu_cache_mem*MEGA;
+
+   for(entry = anchor->pred;
+       csu_cache.mem > budget && entry != anchor;
+       entry = pred)
+   {
+      pred = entry->pred;
+      if(!entry->in_use)
+      {
+         cache_drop_entry(entry);
+         csu_cache.evicted++;
+      }
+   }
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: cache_find_entry()
+//
+//   Return the (locked) cache entry for lhs and rhs, creating it if
+//   necessary. Return NULL if the entry is already being iterated
+//   by another iterator. The cache is flushed whenever the term bank
+//   has been garbage collected since it was filled, as it holds
+//   references to (otherwise unreferenced) terms.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+CSUCacheEntry_p cache_find_entry(Term_p lhs, Term_p rhs, TB_p bank)
+{
+   CSUCacheEntryCell key;
+   CSUCacheEntry_p   res;
+
+   if(!csu_cache.lru_anchor.succ)
+   {
+      csu_cache.lru_anchor.succ = &(csu_cache.lru_anchor);
+      csu_cache.lru_anchor.pred = &(csu_cache.lru_anchor);
+   }
+   if(csu_cache.bank != bank || csu_cache.gc_sweeps != bank->gc_sweeps)
+   {
+      cache_flush();
+      csu_cache.bank = bank;
+      csu_cache.gc_sweeps = bank->gc_sweeps;
+   }
+   csu_cache.lookups++;
+
+   key.lhs = lhs;
+   key.rhs = rhs;
+   res = PTreeObjFindObj(&csu_cache.entries, &key, cmp_cache_entries);
+   if(res)
+   {
+      if(res->in_use)
+      {
+         return NULL;
+      }
+      csu_cache.hits++;
+      lru_unlink(res);
+   }
+   else
+   {
+      res = CSUCacheEntryCellAlloc();
+      res->lhs = lhs;
+      res->rhs = rhs;
+      res->unifiers = PStackVarAlloc(CSU_ENTRY_STACK_SIZE);
+      res->unif_no = 0;
+      res->exhausted = false;
+      res->fail_cost = 0;
+      res->dropped = false;
+      res->mem = 0;
+      PTreeObjStore(&csu_cache.entries, res, cmp_cache_entries);
+      entry_update_mem(res);
+   }
+   res->in_use = true;
+   lru_insert_first(res);
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: replay_unifier()
+//
+//   Set the substitution of the iterator to the next cached unifier,
+//   renaming the fresh variables of the record to variables that are
+//   fresh now.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Changes bindings, changes term bank
+//
+/----------------------------------------------------------------------*/
+
+bool replay_unifier(CSUIterator_p iter)
+{
+   CSUCacheEntry_p entry = iter->cache_entry;
+   PStack_p        rec = entry->unifiers;
+   PStackPointer   pos = iter->replay_pos, fresh_pos, i;
+   long            bindings = PStackElementInt(rec, pos);
+   long            fresh = PStackElementInt(rec, pos+2);
+   PStack_p        renamed = PStackAlloc();
+   Term_p          var;
+
+   SubstBacktrackToPos(iter->subst, iter->init_pos);
+   csu_cache.time_saved += PStackElementInt(rec, pos+1);
+
+   fresh_pos = pos+CSU_REC_HEADER;
+   if(fresh)
+   {
+      VarBankSetVCountsToUsed(iter->bank->vars);
+   }
+   for(i=fresh_pos; i<fresh_pos+fresh; i++)
+   {
+      var = PStackElementP(rec, i);
+      var->binding = VarBankGetFreshVar(iter->bank->vars, var->type);
+   }
+   for(pos = fresh_pos+fresh; bindings--; pos += 2)
+   {
+      var = PStackElementP(rec, pos);
+      PStackPushP(renamed, var->binding ? var->binding : var);
+      PStackPushP(renamed, TBInsert(iter->bank, PStackElementP(rec, pos+1),
+                                    DEREF_ALWAYS));
+   }
+   for(i=fresh_pos; i<fresh_pos+fresh; i++)
+   {
+      var = PStackElementP(rec, i);
+      var->binding = NULL;
+   }
+   for(i=0; i<PStackGetSP(renamed); i+=2)
+   {
+      SubstAddBinding(iter->subst, PStackElementP(renamed, i),
+                      PStackElementP(renamed, i+1));
+   }
+   PStackFree(renamed);
+
+   iter->replay_pos = pos;
+   iter->replayed++;
+   csu_cache.replayed++;
+   return true;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: record_unifier()
+//
+//   Append the unifier the iterator has just found to its cache
+//   entry. Variables that occur in the unifier but not in the
+//   unified terms have been introduced by the search and are listed
+//   as fresh.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void record_unifier(CSUIterator_p iter, long long cost)
+{
+   CSUCacheEntry_p entry = iter->cache_entry;
+   PStackPointer   i;
+   Term_p          var;
+   PTree_p         orig_vars = NULL, vars = NULL;
+   PStack_p        occ = PStackAlloc(), fresh = PStackAlloc();
+
+   TermCollectVariables(entry->lhs, &orig_vars);
+   TermCollectVariables(entry->rhs, &orig_vars);
+   for(i=iter->init_pos; i<PStackGetSP(iter->subst); i++)
+   {
+      var = PStackElementP(iter->subst, i);
+      PTreeStore(&vars, var);
+      TermCollectVariables(var->binding, &vars);
+   }
+   PTreeToPStack(occ, vars);
+   for(i=0; i<PStackGetSP(occ); i++)
+   {
+      var = PStackElementP(occ, i);
+      if(!PTreeFind(&orig_vars, var))
+      {
+         PStackPushP(fresh, var);
+      }
+   }
+   PStackFree(occ);
+   PTreeFree(orig_vars);
+   PTreeFree(vars);
+
+   PStackPushInt(entry->unifiers, PStackGetSP(iter->subst)-iter->init_pos);
+   PStackPushInt(entry->unifiers, cost);
+   PStackPushInt(entry->unifiers, PStackGetSP(fresh));
+   PStackPushStack(entry->unifiers, fresh);
+   PStackFree(fresh);
+   for(i=iter->init_pos; i<PStackGetSP(iter->subst); i++)
+   {
+      var = PStackElementP(iter->subst, i);
+      PStackPushP(entry->unifiers, var);
+      PStackPushP(entry->unifiers, var->binding);
+   }
+   entry->unif_no++;
+   iter->replayed++;
+   iter->replay_pos = PStackGetSP(entry->unifiers);
+   entry_update_mem(entry);
+}
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -523,24 +991,51 @@ bool backtrack_iter(CSUIterator_p iter)
 
 bool NextCSUElement(CSUIterator_p iter)
 {
-   bool res = backtrack_iter(iter);
-   iter->steps = 0;
-   if(res)
+   CSUCacheEntry_p entry = iter->cache_entry;
+   long long       start = 0;
+   bool            res;
+
+   if(entry)
    {
-      if(params->unif_mode == SingleUnif && iter->unifiers_returned == 0)
+      if(iter->replayed < entry->unif_no)
       {
-         res = SubstMguComplete(PQueueGetLastP(iter->constraints), PQueueGetLastP(iter->constraints),
-                               iter->subst);
-         // on the next call we destroy the iterator
-         PStackReset(iter->backtrack_info);
-         iter->unifiers_returned = 1;
+         return replay_unifier(iter);
       }
-      else
+      if(entry->exhausted)
+      {
+         csu_cache.time_saved += entry->fail_cost;
+         SubstBacktrackToPos(iter->subst, iter->init_pos);
+         return false;
+      }
+      if(iter->skip && !iter->unifiers_returned)
       {
-         res = forward_iter(iter);
-         iter->unifiers_returned += res ? 1 : 0;
+         SubstBacktrackToPos(iter->subst, iter->init_pos);
+         csu_cache.restarted++;
       }
+      start = GETTIME();
    }
+
+   do
+   {
+      res = backtrack_iter(iter);
+      iter->steps = 0;
+      if(res)
+      {
+         if(params->unif_mode == SingleUnif && iter->unifiers_returned == 0)
+         {
+            res = SubstMguComplete(PQueueGetLastP(iter->constraints), PQueueGetLastP(iter->constraints),
+                                   iter->subst);
+            // on the next call we destroy the iterator
+            PStackReset(iter->backtrack_info);
+            iter->unifiers_returned = 1;
+         }
+         else
+         {
+            res = forward_iter(iter);
+            iter->unifiers_returned += res ? 1 : 0;
+         }
+      }
+   }while(res && iter->unifiers_returned <= iter->skip);
    // fprintf(stderr, "problem(%d): ", iter->unifiers_returned);
    // DBG_PRINT(stderr, "", TermPrint(stderr, iter->orig_lhs, iter->bank->sig, DEREF_NEVER), " <> ");
    // DBG_PRINT(stderr, "", TermPrint(stderr, iter->orig_rhs, iter->bank->sig, DEREF_NEVER), ".\n");
@@ -554,6 +1049,18 @@ bool NextCSUElement(CSUIterator_p iter)
       assert(false);
    }
 #endif
+   if(entry)
+   {
+      if(res)
+      {
+         record_unifier(iter, GETTIME()-start);
+      }
+      else
+      {
+         entry->exhausted = true;
+         entry->fail_cost = GETTIME()-start;
+      }
+   }
    if(!res)
    {
       SubstBacktrackToPos(iter->subst, iter->init_pos);
@@ -601,6 +1108,20 @@ CSUIterator_p CSUIterInit(Term_p lhs, Term_p rhs, Subst_p subst, TB_p bank)
    res->tmp_rigid_diff = PStackAlloc();
    res->tmp_rigid_same = PStackAlloc();
    res->tmp_flex = PStackAlloc();
+
+   res->cache_entry = NULL;
+   res->replayed = 0;
+   res->replay_pos = 0;
+   res->skip = 0;
+   if(params->csu_cache_mem && params->unif_mode != SingleUnif &&
+      res->init_pos == 0)
+   {
+      res->cache_entry = cache_find_entry(lhs, rhs, bank);
+      if(res->cache_entry)
+      {
+         res->skip = res->cache_entry->unif_no;
+      }
+   }
 #ifndef NDEBUG
    res->orig_lhs = lhs;
    res->orig_rhs = rhs;
@@ -632,16 +1153,18 @@ Subst_p CSUIterGetCurrentSubst(CSUIterator_p iter)
 // Function: InitUnifLimits()
 //
 //   Store heuristic parameters locally and use them to pick up the 
-//   limits for unification.
+//   limits for unification. Any previously cached unifiers are
+//   discarded.
 //
-// Global Variables: -
+// Global Variables: params, csu_cache
 //
-// Side Effects    : -
+// Side Effects    : Frees cache entries
 //
 /----------------------------------------------------------------------*/
 
 void InitUnifLimits(HeuristicParms_p p)
 {
+   CSUCacheFree();
    params = p;
 }
 
@@ -660,17 +1183,73 @@ void InitUnifLimits(HeuristicParms_p p)
 
 void CSUIterDestroy(CSUIterator_p iter)
 {
-   PStackPointer i = PStackGetSP(iter->backtrack_info);
-   while(i>=BT_STEP_SIZE)
+   CSUCacheEntry_p entry = iter->cache_entry;
+
+   SubstBacktrackToPos(iter->subst, iter->init_pos);
+   if(entry)
    {
-      PQueueFree(PStackElementP(iter->backtrack_info, i-4));
-      i-=4;
+      entry->in_use = false;
+      if(entry->dropped)
+      {
+         entry_free(entry);
+      }
+      else
+      {
+         entry_update_mem(entry);
+         cache_enforce_budget();
+      }
+   }
+   iter_free(iter);
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSUCachePrintStatistics()
+//
+//   Print statistics about the unifier cache (if it has been used).
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void CSUCachePrintStatistics(FILE* out)
+{
+   if(csu_cache.lookups)
+   {
+      fprintf(out, "# CSU cache lookups                    : %ld\n",
+              csu_cache.lookups);
+      fprintf(out, "# CSU cache hits                       : %ld\n",
+              csu_cache.hits);
+      fprintf(out, "# CSU cache unifiers replayed          : %ld\n",
+              csu_cache.replayed);
+      fprintf(out, "# CSU cache searches restarted         : %ld\n",
+              csu_cache.restarted);
+      fprintf(out, "# CSU cache evictions                  : %ld\n",
+              csu_cache.evicted);
+      fprintf(out, "# CSU cache search time saved (est.)   : %.3fs\n",
+              csu_cache.time_saved/1000000.0);
+   }
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: CSUCacheFree()
+//
+//   Discard all cached unifier streams. Entries that are currently
+//   being iterated are freed once their iterator is destroyed.
+//
+// Global Variables: csu_cache
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void CSUCacheFree(void)
+{
+   if(csu_cache.lru_anchor.succ)
+   {
+      cache_flush();
    }
-   PStackFree(iter->backtrack_info);
-   PQueueFree(iter->constraints);
-   PStackFree(iter->tmp_rigid_diff);
-   PStackFree(iter->tmp_rigid_same);
-   PStackFree(iter->tmp_flex);
-   SubstBacktrackToPos(iter->subst, iter->init_pos);
-   SizeFree(iter, sizeof(CSUIterator_t));
 }
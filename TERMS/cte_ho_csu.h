@@ -52,6 +52,8 @@ void CSUIterDestroy(CSUIterator_p iter);
 Subst_p CSUIterGetCurrentSubst(CSUIterator_p iter);
 bool NextCSUElement(CSUIterator_p iter);
 void InitUnifLimits(HeuristicParms_p p);
+void CSUCachePrintStatistics(FILE* out);
+void CSUCacheFree(void);
 
 
 
@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created:  Wed Feb 24 01:28:18 EET 2010
+  Mon Oct 19 02:14:37 CEST 2026: Added FPAdapt
 
 -----------------------------------------------------------------------*/
 
@@ -41,6 +42,7 @@ char* FPIndexNames[] =
    "FP6M",
    "FP7",
    "FP7M",
+   "FPAdapt",
    "FP4X2_2",
    "FP3DFlex",
    "NPDT",
@@ -63,6 +65,7 @@ static FPIndexFunction fp_index_funs[] =
    IndexFP6MCreate,
    IndexFP7Create,
    IndexFP7MCreate,
+   IndexFPAdaptCreate,
    IndexFP4X2_2Create,
    IndexFP3DFlexCreate,
    IndexDTCreate,
@@ -733,6 +736,47 @@ IndexFP_p IndexFP7Create(Term_p t)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: IndexFPAdaptCreate()
+//
+//   Create a fingerprint structure with FP_ADAPT_SAMPLES samples, at
+//   the positions of FP7 followed by 2, 3, 0.2, 2.0, 0.0.0, 0.0.1,
+//   0.1.0, 1.0.0. This is meant for adaptive FP indices (see
+//   cte_fp_index.h), which only branch on as many of the samples as
+//   needed to keep the leaves small.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+IndexFP_p IndexFPAdaptCreate(Term_p t)
+{
+   IndexFP_p res = SizeMalloc(sizeof(FunCode)*(FP_ADAPT_SAMPLES+1));
+
+   res[0]  = FP_ADAPT_SAMPLES+1;
+   res[1]  = TermFPSample(t, -1);
+   res[2]  = TermFPSample(t, 0, -1);
+   res[3]  = TermFPSample(t, 1, -1);
+   res[4]  = TermFPSample(t, 0, 0, -1);
+   res[5]  = TermFPSample(t, 0, 1, -1);
+   res[6]  = TermFPSample(t, 1, 0, -1);
+   res[7]  = TermFPSample(t, 1, 1, -1);
+   res[8]  = TermFPSample(t, 2, -1);
+   res[9]  = TermFPSample(t, 3, -1);
+   res[10] = TermFPSample(t, 0, 2, -1);
+   res[11] = TermFPSample(t, 2, 0, -1);
+   res[12] = TermFPSample(t, 0, 0, 0, -1);
+   res[13] = TermFPSample(t, 0, 0, 1, -1);
+   res[14] = TermFPSample(t, 0, 1, 0, -1);
+   res[15] = TermFPSample(t, 1, 0, 0, -1);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: IndexFP7MCreate()
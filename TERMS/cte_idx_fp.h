@@ -21,6 +21,8 @@ Changes
 
 <1> Sat Feb 20 19:19:23 EET 2010
     New
+<2> Mon Oct 19 02:14:37 CEST 2026
+    Added FPAdapt
 
 -----------------------------------------------------------------------*/
 
@@ -58,6 +60,8 @@ extern char* FPIndexNames[];
 #define   ANY_VAR       -1
 #define   NOT_IN_TERM    0
 
+#define   FP_ADAPT_SAMPLES 15
+
 FunCode   TermFPSampleFO(Term_p term, va_list ap);
 FunCode   TermFPFlexSampleFO(Term_p term, IntOrP* *seq);
 FunCode   TermFPSample(Term_p term, ...);
@@ -82,6 +86,7 @@ IndexFP_p IndexFP5MCreate(Term_p t);
 IndexFP_p IndexFP6MCreate(Term_p t);
 IndexFP_p IndexFP7Create(Term_p t);
 IndexFP_p IndexFP7MCreate(Term_p t);
+IndexFP_p IndexFPAdaptCreate(Term_p t);
 IndexFP_p IndexFP4X2_2Create(Term_p t);
 IndexFP_p IndexFPFlexCreate(Term_p t, PStack_p pos, int len);
 IndexFP_p IndexFP3DFlexCreate(Term_p t);
@@ -517,7 +517,13 @@ Term_p do_eta_expand_db(TB_p bank, Term_p t)
 Term_p do_eta_reduce_db(TB_p bank, Term_p t)
 {
    Term_p res;
+   bool   cacheable = t->arity && TermIsShared(t) && TermGetBank(t) == bank;
    assert(bank);
+   if(cacheable && TermGetEtaNF(t))
+   {
+      return TermGetEtaNF(t);
+   }
+
    if(t->arity == 0 || !TermHasLambdaSubterm(t))
    {
       res = t; // optimization
@@ -567,6 +573,10 @@ Term_p do_eta_reduce_db(TB_p bank, Term_p t)
       res = TBTermTopInsert(bank, copy);
    }
 
+   if(cacheable)
+   {
+      TermSetEtaNF(t, res);
+   }
    return res;
 }
 
@@ -585,9 +595,15 @@ Term_p do_eta_reduce_db(TB_p bank, Term_p t)
 Term_p do_beta_normalize_db(TB_p bank, Term_p t)
 {
    Term_p res = NULL;
+   bool   cacheable = TermIsBetaReducible(t) && TermIsShared(t) &&
+                      TermGetBank(t) == bank;
    DBGTermCheckUnownedSubterm(stdout, t, "UnownedBN0");
 
-   if(TermIsPhonyApp(t) && TermIsLambda(t->args[0]))
+   if(cacheable && TermGetBetaNF(t))
+   {
+      res = TermGetBetaNF(t);
+   }
+   else if(TermIsPhonyApp(t) && TermIsLambda(t->args[0]))
    {
       res = WHNF_step(bank, t);
       DBGTermCheckUnownedSubterm(stdout, res, "UnownedBN1");
@@ -643,6 +659,10 @@ Term_p do_beta_normalize_db(TB_p bank, Term_p t)
          DBGTermCheckUnownedSubterm(stdout, res, "UnownedBN7");
       }
    }
+   if(cacheable)
+   {
+      TermSetBetaNF(t, res);
+   }
    DBGTermCheckUnownedSubterm(stdout, res, "UnownedBNX");
    return res;
 }
@@ -0,0 +1,530 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_path_index.c
+
+Author: The E developers
+
+Contents
+
+  Path indexing of terms for instance retrieval.
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 03:02:51 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "cte_path_index.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_node_alloc()
+//
+//   Allocate an empty node.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PathIndexNode_p path_index_node_alloc(void)
+{
+   PathIndexNode_p handle = PathIndexNodeCellAlloc();
+
+   handle->size  = 0;
+   handle->terms = NULL;
+   handle->args  = NULL;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_node_free()
+//
+//   Free a node and the subtrie below it. Return the number of nodes
+//   freed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long path_index_node_free(PathIndexNode_p junk)
+{
+   long            res = 1, i, f_code;
+   IntMap_p        map;
+   IntMapIter_p    iter;
+   PathIndexNode_p child;
+
+   if(junk->args)
+   {
+      for(i=0; i<PDArraySize(junk->args); i++)
+      {
+         map = PDArrayElementP(junk->args, i);
+         if(map)
+         {
+            iter = IntMapIterAlloc(map, 0, LONG_MAX);
+            while((child = IntMapIterNext(iter, &f_code)))
+            {
+               res += path_index_node_free(child);
+            }
+            IntMapIterFree(iter);
+            IntMapFree(map);
+         }
+      }
+      PDArrayFree(junk->args);
+   }
+   PTreeFree(junk->terms);
+   PathIndexNodeCellFree(junk);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_child()
+//
+//   Return the child of node for argument position i with symbol
+//   f_code, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static PathIndexNode_p path_index_child(PathIndexNode_p node, int i,
+                                        FunCode f_code)
+{
+   IntMap_p map;
+
+   if(!node->args || i >= PDArraySize(node->args))
+   {
+      return NULL;
+   }
+   map = PDArrayElementP(node->args, i);
+
+   return map? IntMapGetVal(map, f_code) : NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_child_ref()
+//
+//   Return the address of the child pointer of node for argument
+//   position i with symbol f_code, creating the map if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PathIndexNode_p* path_index_child_ref(PathIndexNode_p node, int i,
+                                             FunCode f_code)
+{
+   IntMap_p map;
+
+   if(!node->args)
+   {
+      node->args = PDArrayAlloc(4, 4);
+   }
+   map = PDArrayElementP(node->args, i);
+   if(!map)
+   {
+      map = IntMapAlloc();
+      PDArrayAssignP(node->args, i, map);
+   }
+   return (PathIndexNode_p*)IntMapGetRef(map, f_code);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_insert_paths()
+//
+//   Add term to node (the node for the path to subterm) and to the
+//   nodes for the paths through the non-variable arguments of
+//   subterm.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void path_index_insert_paths(PathIndex_p index, PathIndexNode_p node,
+                                    Term_p subterm, Term_p term, int depth)
+{
+   PathIndexNode_p *child;
+   int             i;
+
+   if(PTreeStore(&(node->terms), term))
+   {
+      node->size++;
+   }
+   if(depth == PATH_INDEX_MAX_DEPTH)
+   {
+      return;
+   }
+   for(i=0; i<subterm->arity; i++)
+   {
+      if(TermIsFreeVar(subterm->args[i]))
+      {
+         continue;
+      }
+      child = path_index_child_ref(node, i, subterm->args[i]->f_code);
+      if(!*child)
+      {
+         *child = path_index_node_alloc();
+         index->nodes++;
+      }
+      path_index_insert_paths(index, *child, subterm->args[i], term, depth+1);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_delete_paths()
+//
+//   Remove term from node and the nodes below it that are reached
+//   via the paths of subterm, and free nodes that become empty.
+//   Return true if node itself is empty.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool path_index_delete_paths(PathIndex_p index, PathIndexNode_p node,
+                                    Term_p subterm, Term_p term, int depth)
+{
+   PathIndexNode_p child;
+   int             i;
+
+   if(PTreeDeleteEntry(&(node->terms), term))
+   {
+      node->size--;
+   }
+   if(depth < PATH_INDEX_MAX_DEPTH)
+   {
+      for(i=0; i<subterm->arity; i++)
+      {
+         if(TermIsFreeVar(subterm->args[i]))
+         {
+            continue;
+         }
+         child = path_index_child(node, i, subterm->args[i]->f_code);
+         if(child &&
+            path_index_delete_paths(index, child, subterm->args[i],
+                                    term, depth+1))
+         {
+            IntMapDelKey(PDArrayElementP(node->args, i),
+                         subterm->args[i]->f_code);
+            index->nodes -= path_index_node_free(child);
+         }
+      }
+   }
+   return node->size == 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_collect_paths()
+//
+//   Push the nodes for the maximal paths of query (starting at node,
+//   the node for the path to query) onto nodes. Return false if a
+//   path of query is not in the index (so that it has no instances).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool path_index_collect_paths(PathIndexNode_p node, Term_p query,
+                                     int depth, PStack_p nodes)
+{
+   PathIndexNode_p child;
+   bool            maximal = true;
+   int             i;
+
+   if(depth < PATH_INDEX_MAX_DEPTH)
+   {
+      for(i=0; i<query->arity; i++)
+      {
+         if(TermIsFreeVar(query->args[i]))
+         {
+            continue;
+         }
+         child = path_index_child(node, i, query->args[i]->f_code);
+         if(!child ||
+            !path_index_collect_paths(child, query->args[i], depth+1, nodes))
+         {
+            return false;
+         }
+         maximal = false;
+      }
+   }
+   if(maximal)
+   {
+      PStackPushP(nodes, node);
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: path_index_node_cmp()
+//
+//   Compare two nodes by the number of terms.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int path_index_node_cmp(const void* n1, const void* n2)
+{
+   const IntOrP* node1 = (const IntOrP*) n1;
+   const IntOrP* node2 = (const IntOrP*) n2;
+
+   return CMP(((PathIndexNode_p)node1->p_val)->size,
+              ((PathIndexNode_p)node2->p_val)->size);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PathIndexAlloc()
+//
+//   Allocate an empty path index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+PathIndex_p PathIndexAlloc(void)
+{
+   PathIndex_p handle = PathIndexCellAlloc();
+
+   handle->top   = IntMapAlloc();
+   handle->terms = 0;
+   handle->nodes = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PathIndexFree()
+//
+//   Free a path index (but not the terms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void PathIndexFree(PathIndex_p junk)
+{
+   IntMapIter_p    iter;
+   PathIndexNode_p node;
+   long            f_code;
+
+   iter = IntMapIterAlloc(junk->top, 0, LONG_MAX);
+   while((node = IntMapIterNext(iter, &f_code)))
+   {
+      path_index_node_free(node);
+   }
+   IntMapIterFree(iter);
+   IntMapFree(junk->top);
+   PathIndexCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PathIndexInsert()
+//
+//   Insert a non-variable term into the index. Return false if it was
+//   already there.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool PathIndexInsert(PathIndex_p index, Term_p term)
+{
+   PathIndexNode_p *node;
+
+   assert(!TermIsFreeVar(term));
+
+   node = (PathIndexNode_p*)IntMapGetRef(index->top, term->f_code);
+   if(!*node)
+   {
+      *node = path_index_node_alloc();
+      index->nodes++;
+   }
+   else if(PTreeFindBinary((*node)->terms, term))
+   {
+      return false;
+   }
+   path_index_insert_paths(index, *node, term, term, 1);
+   index->terms++;
+
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PathIndexDelete()
+//
+//   Delete term from the index. Return false if it was not there.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool PathIndexDelete(PathIndex_p index, Term_p term)
+{
+   PathIndexNode_p node;
+
+   assert(!TermIsFreeVar(term));
+
+   node = IntMapGetVal(index->top, term->f_code);
+   if(!node || !PTreeFindBinary(node->terms, term))
+   {
+      return false;
+   }
+   if(path_index_delete_paths(index, node, term, term, 1))
+   {
+      IntMapDelKey(index->top, term->f_code);
+      index->nodes -= path_index_node_free(node);
+   }
+   index->terms--;
+
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: PathIndexFindInstances()
+//
+//   Push all indexed terms that contain all paths of query onto
+//   collect. If query is linear (and not deeper than
+//   PATH_INDEX_MAX_DEPTH), these are exactly its instances. If query
+//   is a variable, all terms are returned. Return number of terms
+//   pushed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long PathIndexFindInstances(PathIndex_p index, Term_p query,
+                            PStack_p collect)
+{
+   PStack_p        nodes = PStackAlloc();
+   PStack_p        iterstack;
+   PTree_p         cell;
+   PathIndexNode_p node;
+   PStackPointer   i;
+   long            res = 0, f_code;
+   IntMapIter_p    iter;
+
+   if(TermIsFreeVar(query))
+   {
+      iter = IntMapIterAlloc(index->top, 0, LONG_MAX);
+      while((node = IntMapIterNext(iter, &f_code)))
+      {
+         res += PTreeToPStack(collect, node->terms);
+      }
+      IntMapIterFree(iter);
+      PStackFree(nodes);
+      return res;
+   }
+   node = IntMapGetVal(index->top, query->f_code);
+   if(node && path_index_collect_paths(node, query, 1, nodes))
+   {
+      PStackSort(nodes, path_index_node_cmp);
+      node = PStackElementP(nodes, 0);
+      iterstack = PTreeTraverseInit(node->terms);
+      while((cell = PTreeTraverseNext(iterstack)))
+      {
+         for(i=1; i<PStackGetSP(nodes); i++)
+         {
+            node = PStackElementP(nodes, i);
+            if(!PTreeFindBinary(node->terms, cell->key))
+            {
+               break;
+            }
+         }
+         if(i==PStackGetSP(nodes))
+         {
+            PStackPushP(collect, cell->key);
+            res++;
+         }
+      }
+      PTreeTraverseExit(iterstack);
+   }
+   PStackFree(nodes);
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,95 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_path_index.h
+
+Author: The E developers
+
+Contents
+
+  Path indexing of (shared, first-order) terms for the retrieval of
+  instances. A path is a sequence f0.i1.f1...ik.fk of function
+  symbols and argument positions leading from the top symbol of a
+  term to one of its non-variable positions. The index is a trie over
+  paths, and each node holds the set of terms that contain its path.
+  Every term that is an instance of a query contains all paths of
+  the query, so the candidates are the intersection of the sets for
+  the maximal paths of the query. This is exact for linear queries
+  up to PATH_INDEX_MAX_DEPTH, which bounds the length of the paths
+  (and thus the size of the index for deep terms).
+
+  Copyright 2026 by the authors.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 03:02:51 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CTE_PATH_INDEX
+
+#define CTE_PATH_INDEX
+
+#include <clb_intmap.h>
+#include <clb_pdarrays.h>
+#include <clb_ptrees.h>
+#include <cte_termtypes.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define PATH_INDEX_NAME      "PathIndex"
+#define PATH_INDEX_MAX_DEPTH 6
+
+/* Node for the path ending in a symbol f. The children are found via
+   args (argument position i of f) and an IntMap of the symbols at
+   that position. */
+
+typedef struct path_index_node_cell
+{
+   long      size;    /* Number of terms... */
+   PTree_p   terms;   /* ...containing the path */
+   PDArray_p args;    /* Of IntMap_p, or NULL */
+}PathIndexNodeCell, *PathIndexNode_p;
+
+typedef struct path_index_cell
+{
+   IntMap_p  top;     /* Top symbol -> node */
+   long      terms;
+   long      nodes;
+}PathIndexCell, *PathIndex_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define PathIndexNodeCellAlloc() \
+   (PathIndexNodeCell*)SizeMalloc(sizeof(PathIndexNodeCell))
+#define PathIndexNodeCellFree(junk) \
+   SizeFree(junk, sizeof(PathIndexNodeCell))
+#define PathIndexCellAlloc() (PathIndexCell*)SizeMalloc(sizeof(PathIndexCell))
+#define PathIndexCellFree(junk) SizeFree(junk, sizeof(PathIndexCell))
+
+PathIndex_p PathIndexAlloc(void);
+void        PathIndexFree(PathIndex_p junk);
+
+bool        PathIndexInsert(PathIndex_p index, Term_p term);
+bool        PathIndexDelete(PathIndex_p index, Term_p term);
+long        PathIndexFindInstances(PathIndex_p index, Term_p query,
+                                   PStack_p collect);
+
+#define     PathIndexTerms(index) ((index)->terms)
+#define     PathIndexNodes(index) ((index)->nodes)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -32,6 +32,10 @@ extern TB_p bank;
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Number of times an existing rewrite link has been redirected or
+   removed. Rewrite chains computed earlier are only known to be
+   intact as long as this does not change. */
+long TermRWLinkChanges = 0;
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -57,7 +61,7 @@ extern TB_p bank;
 //   If demod is REWRITE_AT_SUBTERM, actual rewriting happened at a
 //   subterm.
 //
-// Global Variables: -
+// Global Variables: TermRWLinkChanges
 //
 // Side Effects    : As described
 //
@@ -70,6 +74,10 @@ void TermAddRWLink(Term_p term, Term_p replace, struct clause_cell *demod, bool
    assert(replace);
    assert(term!=replace);
 
+   if(TermIsRewritten(term) && (TermRWReplaceField(term) != replace))
+   {
+      TermRWLinkChanges++;
+   }
    TermCellSetProp(term, TPIsRewritten);
 
    if(type==RWAlwaysRewritable)
@@ -93,7 +101,7 @@ void TermAddRWLink(Term_p term, Term_p replace, struct clause_cell *demod, bool
 //
 //   Delete rewrite link from term.
 //
-// Global Variables: -
+// Global Variables: TermRWLinkChanges
 //
 // Side Effects    : As described
 //
@@ -103,6 +111,11 @@ void TermDeleteRWLink(Term_p term)
 {
    assert(term);
 
+   if(TermIsRewritten(term))
+   {
+      TermRWLinkChanges++;
+   }
+
    TermCellDelProp(term, TPIsRewritten|TPIsRRewritten|TPIsSOSRewritten);
 
    TermRWReplaceField(term) = NULL;
@@ -48,6 +48,7 @@ typedef enum
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+extern long TermRWLinkChanges;
 
 void   TermAddRWLink(Term_p term, Term_p replace,
                      struct clause_cell *demod,
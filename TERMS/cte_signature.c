@@ -66,11 +66,34 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: sig_entry_compare()
+//
+//   Compare two (PStack elements pointing to) f_index entries by
+//   name.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int sig_entry_compare(const void* e1, const void* e2)
+{
+   const StrHashEntry_p entry1 = ((const IntOrP*)e1)->p_val;
+   const StrHashEntry_p entry2 = ((const IntOrP*)e2)->p_val;
+
+   return strcmp(entry1->key, entry2->key);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: sig_compute_alpha_ranks()
 //
-//   For all symbols in sig compute the alpha-rank of the symbol.
+//   For all symbols in sig compute the alpha-rank of the symbol
+//   (i.e. its position in the lexicographic order of the names).
 //
 // Global Variables: -
 //
@@ -80,17 +103,22 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
 
 static void sig_compute_alpha_ranks(Sig_p sig)
 {
-   PStack_p stack;
-   long count = 0;
-   StrTree_p handle;
-
-   stack = StrTreeTraverseInit(sig->f_index);
+   PStack_p stack = PStackAlloc();
+   long count = 0, pos = 0;
+   StrHashEntry_p handle;
+   PStackPointer i;
 
-   while((handle = StrTreeTraverseNext(stack)))
+   while((handle = StrHashIterNext(sig->f_index, &pos)))
    {
-      sig->f_info[handle->val1.i_val].alpha_rank = count++;
+      PStackPushP(stack, handle);
    }
-   StrTreeTraverseExit(stack);
+   PStackSort(stack, sig_entry_compare);
+   for(i=0; i<PStackGetSP(stack); i++)
+   {
+      handle = PStackElementP(stack, i);
+      sig->f_info[handle->val].alpha_rank = count++;
+   }
+   PStackFree(stack);
 
    sig->alpha_ranks_valid = true;
 }
@@ -124,7 +152,7 @@ Sig_p SigAlloc(TypeBank_p bank)
    handle->f_count        = 0;
    handle->f_info         =
       SecureMalloc(sizeof(FuncCell)*DEFAULT_SIGNATURE_SIZE);
-   handle->f_index = NULL;
+   handle->f_index = StrHashAlloc();
    handle->ac_axioms = PStackAlloc();
 
    handle->type_bank = bank;
@@ -304,9 +332,9 @@ void SigFree(Sig_p junk)
    assert(junk->f_info);
 
    /* names are shared with junk->f_index and are free()ed by the
-      StrTreeFree() call below! */
+      StrHashFree() call below! */
    FREE(junk->f_info);
-   StrTreeFree(junk->f_index);
+   StrHashFree(junk->f_index);
    PStackFree(junk->ac_axioms);
    if(junk->orn_codes)
    {
@@ -342,13 +370,13 @@ void SigFree(Sig_p junk)
 
 FunCode SigFindFCode(Sig_p sig, const char* name)
 {
-   StrTree_p entry;
+   StrHashEntry_p entry;
 
-   entry = StrTreeFind(&(sig->f_index), name);
+   entry = StrHashFind(sig->f_index, name);
 
    if(entry)
    {
-      return entry->val1.i_val;
+      return entry->val;
    }
    return 0;
 }
@@ -628,7 +656,7 @@ void SigSetAllSpecial(Sig_p sig, bool value)
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 {
    long      pos;
-   StrTree_p new, test;
+   StrHashEntry_p new;
    DStr_p    fix_name = NULL;
 
    pos = SigFindFCode(sig, name);
@@ -675,18 +703,13 @@ FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 
    /* Insert the element in f_index and f_info */
    sig->f_count++;
-   sig->f_info[sig->f_count].name
-      = SecureStrdup(name);
+   new = StrHashStore(sig->f_index, name, sig->f_count);
+   assert(new);
+   sig->f_info[sig->f_count].name = new->key;
    sig->f_info[sig->f_count].arity = arity;
    sig->f_info[sig->f_count].properties = FPIgnoreProps;
    sig->f_info[sig->f_count].type = NULL;
    sig->f_info[sig->f_count].feature_offset = -1;
-   new = StrTreeCellAllocEmpty();
-   new->key = sig->f_info[sig->f_count].name;
-   new->val1.i_val = sig->f_count;
-
-   test = StrTreeInsert(&(sig->f_index), new);
-   UNUSED(test); assert(test == NULL);
    SigSetSpecial(sig,sig->f_count,special_id);
    sig->alpha_ranks_valid = false;
 
@@ -721,8 +744,8 @@ FunCode SigPopId(Sig_p sig)
    if(sig->f_count)
    {
       res = sig->f_count;
-      StrTreeDeleteEntry(&(sig->f_index), sig->f_info[sig->f_count].name);
-      // Identifier is freed (unexpectedly?) in StrTreeDeleteEntry()
+      StrHashDelete(sig->f_index, sig->f_info[sig->f_count].name);
+      // Identifier is freed (unexpectedly?) in StrHashDelete()
       //FREE(sig->f_info[sig->f_count].name);
       sig->f_count--;
    }
@@ -2037,17 +2060,15 @@ void SigEnterLetScope(Sig_p sig, PStack_p type_decls)
          PStackPushInt(scope, old_id);
          PStackPushP(scope, name);
 
-         StrTree_p node = StrTreeFind(&(sig->f_index), name);
-         node->val1.i_val = id;
+         StrHashEntry_p node = StrHashFind(sig->f_index, name);
+         node->val = id;
       }
       else
       {
          PStackPushInt(scope, TMP_LET_ID);
          PStackPushP(scope, name);
 
-         IntOrP id_tree = {.i_val = id}, dummy = {.i_val = 0};
-
-         StrTreeStore(&(sig->f_index), name, id_tree, dummy);
+         StrHashStore(sig->f_index, name, id);
       }
    }
 }
@@ -2076,12 +2097,12 @@ void SigExitLetScope(Sig_p sig)
 
       if(id != TMP_LET_ID)
       {
-         StrTree_p node = StrTreeFind(&(sig->f_index), name);
-         node->val1.i_val = id;
+         StrHashEntry_p node = StrHashFind(sig->f_index, name);
+         node->val = id;
       }
       else
       {
-         StrTreeDeleteEntry(&(sig->f_index), name);
+         StrHashDelete(sig->f_index, name);
       }
 
    }
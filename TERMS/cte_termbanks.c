@@ -751,6 +751,7 @@ TB_p TBAlloc(Sig_p sig)
    handle->rewrite_steps = 0;
    handle->ext_index = PDIntArrayAlloc(1,100000);
    handle->garbage_state = TPIgnoreProps;
+   handle->gc_sweeps = 0;
    handle->gc = GCAdminAlloc();
    handle->sig = sig;
    handle->vars = VarBankAlloc(sig->type_bank);
@@ -2076,10 +2077,20 @@ void TBGCMarkTerm(TB_p bank, Term_p term)
             PStackPushP(stack, TermRWReplaceField(term));
          }
 
-         if(TermIsAppliedFreeVar(term) && TermGetCache(term))
+         if(TermGetCache(term))
          {
             PStackPushP(stack, TermGetCache(term));
          }
+         /* Cached lambda normal forms stay valid as long as the term
+            itself survives */
+         if(TermGetBetaNF(term))
+         {
+            PStackPushP(stack, TermGetBetaNF(term));
+         }
+         if(TermGetEtaNF(term))
+         {
+            PStackPushP(stack, TermGetEtaNF(term));
+         }
       }
    }
    PStackFree(stack);
@@ -2096,7 +2107,8 @@ void TBGCMarkTerm(TB_p bank, Term_p term)
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, flips bank->garbage_state
+// Side Effects    : Memory operations, flips bank->garbage_state,
+//                   increases bank->gc_sweeps
 //
 /----------------------------------------------------------------------*/
 
@@ -2134,6 +2146,7 @@ long TBGCSweep(TB_p bank)
 #endif
    bank->garbage_state =
       bank->garbage_state?TPIgnoreProps:TPGarbageFlag;
+   bank->gc_sweeps++;
 
    return recovered;
 }
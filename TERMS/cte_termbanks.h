@@ -72,6 +72,11 @@ typedef struct tbcell
                                     get the new value, so that marking
                                     can be done by flipping in the
                                     term cell. */
+   unsigned long gc_sweeps;      /* How many sweeps have been done?
+                                    Caches holding term pointers that
+                                    are not visible to the garbage
+                                    collector compare this to detect
+                                    that they are stale. */
    GCAdmin_p      gc;     /* Higher level code can register
                                   * garbage collection information
                                   * here. This is only a convenience
@@ -195,6 +200,8 @@ Term_p TermApplyArg(TypeBank_p tb, Term_p s, Term_p arg);
 #define TBGCRegisterClauseSet(terms, set)    GCRegisterClauseSet((terms)->gc,(set))
 #define TBGCDeregisterFormulaSet(terms, set) GCDeregisterFormulaSet((terms)->gc,(set))
 #define TBGCDeregisterClauseSet(terms, set)  GCDeregisterClauseSet((terms)->gc,(set))
+#define TBGCRegisterNFCache(terms, cache)    GCRegisterNFCache((terms)->gc,(cache))
+#define TBGCDeregisterNFCache(terms, cache)  GCDeregisterNFCache((terms)->gc,(cache))
 
 
 /*---------------------------------------------------------------------*/
@@ -155,6 +155,9 @@ typedef struct termcell
 #ifdef ENABLE_LFHO
    struct termcell* binding_cache; /* For caching the term applied variable
                                       expands to. */
+   struct termcell* beta_nf;       /* Cached beta normal form of a shared
+                                      term (NULL if not yet computed) */
+   struct termcell* eta_nf;        /* Ditto for the eta-reduced form */
    struct tbcell* owner_bank;                /* Bank that owns this term cell and that
                                       is responsible for lifetime management
                                       of the term */
@@ -369,6 +372,10 @@ void    TermStackDelProps(PStack_p stack, TermProperties prop);
 #ifdef ENABLE_LFHO
 #define TermGetCache(t)    ((t)->binding_cache)
 #define TermSetCache(t,c)  ((t)->binding_cache = (c))
+#define TermGetBetaNF(t)   ((t)->beta_nf)
+#define TermSetBetaNF(t,n) ((t)->beta_nf = (n))
+#define TermGetEtaNF(t)    ((t)->eta_nf)
+#define TermSetEtaNF(t,n)  ((t)->eta_nf = (n))
 #define TermGetBank(t)     ((t)->owner_bank)
 #define TermSetBank(t,b)   ((t)->owner_bank = (b))
 Term_p TermFindUnownedSubterm(Term_p term);
@@ -381,6 +388,10 @@ void DBGTermCheckUnownedSubtermReal(FILE* out, Term_p t, char* location);
 #else
 #define TermGetCache(t)    (UNUSED(t), NULL)
 #define TermSetCache(t,c)  (UNUSED(t), UNUSED(c), UNUSED(NULL))
+#define TermGetBetaNF(t)   (UNUSED(t), NULL)
+#define TermSetBetaNF(t,n) (UNUSED(t), UNUSED(n), UNUSED(NULL))
+#define TermGetEtaNF(t)    (UNUSED(t), NULL)
+#define TermSetEtaNF(t,n)  (UNUSED(t), UNUSED(n), UNUSED(NULL))
 #define TermGetBank(t)     (UNUSED(t), NULL)
 #define TermFindUnownedSubterm(t) (UNUSED(t), NULL)
 #define DBGTermCheckUnownedSubterm(f, t, l) (UNUSED(f) (UNUSED(t), UNUSED(location))
@@ -690,6 +701,8 @@ static inline Term_p TermDefaultCellAlloc(void)
    handle->lson = NULL;
    handle->rson = NULL;
    TermSetCache(handle, NULL);
+   TermSetBetaNF(handle, NULL);
+   TermSetEtaNF(handle, NULL);
    TermSetBank(handle, NULL);
 
    return handle;
@@ -725,6 +738,8 @@ static inline Term_p TermDefaultCellArityAlloc(int arity)
    handle->lson = NULL;
    handle->rson = NULL;
    TermSetCache(handle, NULL);
+   TermSetBetaNF(handle, NULL);
+   TermSetEtaNF(handle, NULL);
    TermSetBank(handle, NULL);
 
    return handle;